@@ -0,0 +1,49 @@
+kind "ConsoleApp"
+
+files { "src/*.hpp", "src/*.inl", "src/*.cpp" }
+
+-- Les parseurs ne sont pas exports par leur module, ils sont donc compils directement
+files "../src/Nazara/Graphics/Loaders/OBJ/OBJParser.cpp"
+includedirs "../src"
+
+if (_OPTIONS["united"]) then
+	configuration "DebugStatic"
+		links "NazaraEngine-s-d"
+
+	configuration "ReleaseStatic"
+		links "NazaraEngine-s"
+
+	configuration "DebugDLL"
+		links "NazaraEngine-d"
+
+	configuration "ReleaseDLL"
+		links "NazaraEngine"
+else
+	configuration "DebugStatic"
+		links "NazaraGraphics-s-d"
+		links "NazaraRenderer-s-d"
+		links "NazaraNoise-s-d"
+		links "NazaraUtility-s-d"
+		links "NazaraCore-s-d"
+
+	configuration "ReleaseStatic"
+		links "NazaraGraphics-s"
+		links "NazaraRenderer-s"
+		links "NazaraNoise-s"
+		links "NazaraUtility-s"
+		links "NazaraCore-s"
+
+	configuration "DebugDLL"
+		links "NazaraGraphics-d"
+		links "NazaraRenderer-d"
+		links "NazaraNoise-d"
+		links "NazaraUtility-d"
+		links "NazaraCore-d"
+
+	configuration "ReleaseDLL"
+		links "NazaraGraphics"
+		links "NazaraRenderer"
+		links "NazaraNoise"
+		links "NazaraUtility"
+		links "NazaraCore"
+end
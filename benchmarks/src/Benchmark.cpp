@@ -0,0 +1,290 @@
+// Copyright (C) 2014 Jérôme Leclercq
+// This file is part of the "Nazara Engine - Benchmarks"
+// For conditions of distribution and use, see copyright notice in Config.hpp
+
+#include "Benchmark.hpp"
+#include <algorithm>
+#include <cstdio>
+#include <fstream>
+#include <iostream>
+
+namespace
+{
+	struct BenchmarkEntry
+	{
+		const char* group;
+		const char* name;
+		BenchmarkFunction function;
+	};
+
+	// Les benchmarks s'enregistrent pendant l'initialisation statique, l'ordre de celle-ci n'étant pas garanti
+	// le registre est construit au premier appel
+	std::vector<BenchmarkEntry>& GetRegistry()
+	{
+		static std::vector<BenchmarkEntry> registry;
+		return registry;
+	}
+
+	const nzUInt64 maxIterations = 1000000000ULL;
+
+	std::string EscapeJson(const std::string& string)
+	{
+		std::string escaped;
+		escaped.reserve(string.size());
+
+		for (char c : string)
+		{
+			switch (c)
+			{
+				case '"':
+					escaped += "\\\"";
+					break;
+
+				case '\\':
+					escaped += "\\\\";
+					break;
+
+				case '\n':
+					escaped += "\\n";
+					break;
+
+				default:
+					if (static_cast<unsigned char>(c) < 0x20)
+						escaped += ' ';
+					else
+						escaped += c;
+
+					break;
+			}
+		}
+
+		return escaped;
+	}
+
+	std::string FormatTime(double ns)
+	{
+		char buffer[32];
+		if (ns < 1e3)
+			std::sprintf(buffer, "%.2f ns", ns);
+		else if (ns < 1e6)
+			std::sprintf(buffer, "%.2f us", ns/1e3);
+		else if (ns < 1e9)
+			std::sprintf(buffer, "%.2f ms", ns/1e6);
+		else
+			std::sprintf(buffer, "%.2f s", ns/1e9);
+
+		return buffer;
+	}
+
+	std::string FormatRate(double rate, const char* unit)
+	{
+		if (rate <= 0.0)
+			return std::string();
+
+		static const char* prefixes[] = {"", "k", "M", "G", "T"};
+
+		unsigned int prefix = 0;
+		while (rate >= 1000.0 && prefix < 4)
+		{
+			rate /= 1000.0;
+			prefix++;
+		}
+
+		char buffer[32];
+		std::sprintf(buffer, "%.2f %s%s/s", rate, prefixes[prefix], unit);
+
+		return buffer;
+	}
+}
+
+std::vector<BenchmarkResult> BenchmarkRunner::Run(const Parameters& parameters)
+{
+	std::vector<BenchmarkEntry> entries = GetRegistry();
+	std::sort(entries.begin(), entries.end(), [](const BenchmarkEntry& lhs, const BenchmarkEntry& rhs)
+	{
+		int cmp = std::string(lhs.group).compare(rhs.group);
+		if (cmp != 0)
+			return cmp < 0;
+
+		return std::string(lhs.name).compare(rhs.name) < 0;
+	});
+
+	std::vector<BenchmarkResult> results;
+	for (const BenchmarkEntry& entry : entries)
+	{
+		std::string fullName = std::string(entry.group) + '/' + entry.name;
+		if (!parameters.filter.empty() && fullName.find(parameters.filter) == std::string::npos)
+			continue;
+
+		std::cout << fullName << "..." << std::flush;
+		results.push_back(RunBenchmark(entry.group, entry.name, entry.function, parameters));
+		std::cout << " done" << std::endl;
+	}
+
+	return results;
+}
+
+bool BenchmarkRunner::Register(const char* group, const char* name, BenchmarkFunction function)
+{
+	GetRegistry().push_back(BenchmarkEntry{group, name, function});
+	return true;
+}
+
+BenchmarkResult BenchmarkRunner::RunBenchmark(const char* group, const char* name, BenchmarkFunction function, const Parameters& parameters)
+{
+	BenchmarkResult result;
+	result.group = group;
+	result.name = name;
+	result.bytesPerSecond = 0.0;
+	result.itemsPerSecond = 0.0;
+	result.iterations = 0;
+	result.maxNs = 0.0;
+	result.meanNs = 0.0;
+	result.medianNs = 0.0;
+	result.minNs = 0.0;
+	result.samples = 0;
+	result.skipped = false;
+
+	// Calibration: on augmente le nombre d'itérations jusqu'à ce qu'un échantillon dure suffisamment longtemps
+	nzUInt64 iterations = 1;
+	for (;;)
+	{
+		BenchmarkState state(iterations);
+		function(state);
+
+		if (state.m_skipped)
+		{
+			result.skipped = true;
+			result.skipReason = state.m_skipReason;
+			return result;
+		}
+
+		double elapsed = std::chrono::duration<double>(state.m_elapsed).count();
+		if (elapsed >= parameters.minSampleTime || iterations >= maxIterations)
+			break;
+
+		nzUInt64 next;
+		if (elapsed <= parameters.minSampleTime/100.0)
+			next = iterations*100;
+		else
+			next = static_cast<nzUInt64>(iterations*parameters.minSampleTime*1.2/elapsed);
+
+		iterations = std::min(std::max(next, iterations+1), maxIterations);
+	}
+
+	// Mesures
+	std::vector<double> times;
+	times.reserve(parameters.sampleCount);
+
+	double bytesPerIteration = 0.0;
+	double itemsPerIteration = 0.0;
+	for (unsigned int i = 0; i < std::max(parameters.sampleCount, 1U); ++i)
+	{
+		BenchmarkState state(iterations);
+		function(state);
+
+		times.push_back(std::chrono::duration<double, std::nano>(state.m_elapsed).count()/iterations);
+		bytesPerIteration = static_cast<double>(state.m_bytesProcessed)/iterations;
+		itemsPerIteration = static_cast<double>(state.m_itemsProcessed)/iterations;
+		result.label = state.m_label;
+	}
+
+	std::sort(times.begin(), times.end());
+
+	double sum = 0.0;
+	for (double time : times)
+		sum += time;
+
+	unsigned int count = times.size();
+
+	result.iterations = iterations;
+	result.maxNs = times.back();
+	result.meanNs = sum/count;
+	result.medianNs = (count % 2 == 0) ? (times[count/2 - 1] + times[count/2])/2.0 : times[count/2];
+	result.minNs = times.front();
+	result.samples = count;
+
+	// Les débits sont calculés à partir de la médiane, moins sensible aux interruptions
+	if (result.medianNs > 0.0)
+	{
+		result.bytesPerSecond = bytesPerIteration*1e9/result.medianNs;
+		result.itemsPerSecond = itemsPerIteration*1e9/result.medianNs;
+	}
+
+	return result;
+}
+
+bool WriteConsoleReport(const std::vector<BenchmarkResult>& results)
+{
+	std::printf("\n%-40s %14s %14s %14s %16s\n", "Benchmark", "Median", "Min", "Mean", "Throughput");
+	std::printf("%s\n", std::string(102, '-').c_str());
+
+	for (const BenchmarkResult& result : results)
+	{
+		std::string fullName = result.group + '/' + result.name;
+		if (result.skipped)
+		{
+			std::printf("%-40s skipped: %s\n", fullName.c_str(), result.skipReason.c_str());
+			continue;
+		}
+
+		std::string throughput = (result.bytesPerSecond > 0.0) ? FormatRate(result.bytesPerSecond, "B") : FormatRate(result.itemsPerSecond, "items");
+
+		std::printf("%-40s %14s %14s %14s %16s", fullName.c_str(), FormatTime(result.medianNs).c_str(), FormatTime(result.minNs).c_str(),
+		            FormatTime(result.meanNs).c_str(), throughput.c_str());
+
+		if (!result.label.empty())
+			std::printf("  %s", result.label.c_str());
+
+		std::printf("\n");
+	}
+
+	return true;
+}
+
+bool WriteJsonReport(const std::vector<BenchmarkResult>& results, const std::string& filePath)
+{
+	std::ofstream file(filePath.c_str(), std::ios::out | std::ios::trunc);
+	if (!file.is_open())
+	{
+		std::cerr << "Failed to open \"" << filePath << '"' << std::endl;
+		return false;
+	}
+
+	// Format stable, une entrée par benchmark, pour permettre le suivi des performances par l'intégration continue
+	file << "{\n\t\"version\": 1,\n\t\"benchmarks\": [";
+
+	bool first = true;
+	for (const BenchmarkResult& result : results)
+	{
+		if (!first)
+			file << ',';
+
+		first = false;
+
+		file << "\n\t\t{\"group\": \"" << EscapeJson(result.group) << "\", \"name\": \"" << EscapeJson(result.name) << '"';
+		if (result.skipped)
+			file << ", \"skipped\": true, \"reason\": \"" << EscapeJson(result.skipReason) << '"';
+		else
+		{
+			file << ", \"iterations\": " << result.iterations << ", \"samples\": " << result.samples;
+			file << ", \"median_ns\": " << result.medianNs << ", \"min_ns\": " << result.minNs;
+			file << ", \"mean_ns\": " << result.meanNs << ", \"max_ns\": " << result.maxNs;
+
+			if (result.bytesPerSecond > 0.0)
+				file << ", \"bytes_per_second\": " << result.bytesPerSecond;
+
+			if (result.itemsPerSecond > 0.0)
+				file << ", \"items_per_second\": " << result.itemsPerSecond;
+
+			if (!result.label.empty())
+				file << ", \"label\": \"" << EscapeJson(result.label) << '"';
+		}
+
+		file << '}';
+	}
+
+	file << "\n\t]\n}\n";
+
+	return file.good();
+}
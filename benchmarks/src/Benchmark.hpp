@@ -0,0 +1,111 @@
+// Copyright (C) 2014 Jérôme Leclercq
+// This file is part of the "Nazara Engine - Benchmarks"
+// For conditions of distribution and use, see copyright notice in Config.hpp
+
+#pragma once
+
+#ifndef NAZARA_BENCHMARKS_BENCHMARK_HPP
+#define NAZARA_BENCHMARKS_BENCHMARK_HPP
+
+#include <Nazara/Prerequesites.hpp>
+#include <chrono>
+#include <string>
+#include <vector>
+
+class BenchmarkState
+{
+	friend class BenchmarkRunner;
+
+	public:
+		BenchmarkState(nzUInt64 iterations);
+
+		// À utiliser comme condition de boucle: while (state.KeepRunning()) { ... }
+		bool KeepRunning();
+
+		// Permet d'exclure une préparation du temps mesuré
+		void PauseTiming();
+		void ResumeTiming();
+
+		void SetBytesProcessed(nzUInt64 bytes);
+		void SetItemsProcessed(nzUInt64 items);
+		void SetLabel(const std::string& label); // Information libre affichée avec les résultats (Mémoire utilisée, ...)
+		void Skip(const std::string& reason);
+
+		nzUInt64 GetIterationCount() const;
+
+	private:
+		using Clock = std::chrono::high_resolution_clock;
+
+		Clock::duration m_elapsed;
+		Clock::time_point m_start;
+		std::string m_label;
+		std::string m_skipReason;
+		nzUInt64 m_bytesProcessed;
+		nzUInt64 m_iterations;
+		nzUInt64 m_itemsProcessed;
+		nzUInt64 m_remaining;
+		bool m_running;
+		bool m_skipped;
+};
+
+using BenchmarkFunction = void (*)(BenchmarkState& state);
+
+struct BenchmarkResult
+{
+	std::string group;
+	std::string label;
+	std::string name;
+	std::string skipReason;
+	double bytesPerSecond;
+	double itemsPerSecond;
+	double maxNs;    // Par itération
+	double meanNs;   // Par itération
+	double medianNs; // Par itération
+	double minNs;    // Par itération
+	nzUInt64 iterations;
+	unsigned int samples;
+	bool skipped;
+};
+
+class BenchmarkRunner
+{
+	public:
+		struct Parameters
+		{
+			std::string filter;
+			double minSampleTime = 0.05; // En secondes
+			unsigned int sampleCount = 5;
+		};
+
+		static std::vector<BenchmarkResult> Run(const Parameters& parameters);
+
+		static bool Register(const char* group, const char* name, BenchmarkFunction function);
+
+	private:
+		static BenchmarkResult RunBenchmark(const char* group, const char* name, BenchmarkFunction function, const Parameters& parameters);
+};
+
+bool WriteConsoleReport(const std::vector<BenchmarkResult>& results);
+bool WriteJsonReport(const std::vector<BenchmarkResult>& results, const std::string& filePath);
+
+// Empêche le compilateur d'éliminer un calcul dont le résultat n'est pas utilisé
+template<typename T>
+inline void DoNotOptimize(const T& value)
+{
+	#if defined(NAZARA_COMPILER_GCC) || defined(NAZARA_COMPILER_CLANG)
+	asm volatile("" : : "g"(&value) : "memory");
+	#else
+	static volatile const void* sink;
+	sink = &value;
+	#endif
+}
+
+// Déclare et enregistre automatiquement un benchmark, dont le corps suit la macro
+#define NAZARA_BENCHMARK(group, name) \
+	static void Benchmark_##group##_##name(BenchmarkState& state); \
+	static bool s_benchmark_##group##_##name = BenchmarkRunner::Register(#group, #name, &Benchmark_##group##_##name); \
+	static void Benchmark_##group##_##name(BenchmarkState& state)
+
+#include "Benchmark.inl"
+
+#endif // NAZARA_BENCHMARKS_BENCHMARK_HPP
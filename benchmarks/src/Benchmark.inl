@@ -0,0 +1,85 @@
+// Copyright (C) 2014 Jérôme Leclercq
+// This file is part of the "Nazara Engine - Benchmarks"
+// For conditions of distribution and use, see copyright notice in Config.hpp
+
+inline BenchmarkState::BenchmarkState(nzUInt64 iterations) :
+m_elapsed(Clock::duration::zero()),
+m_bytesProcessed(0),
+m_iterations(iterations),
+m_itemsProcessed(0),
+m_remaining(iterations),
+m_running(false),
+m_skipped(false)
+{
+}
+
+inline bool BenchmarkState::KeepRunning()
+{
+	if (m_remaining == 0)
+	{
+		if (m_running)
+		{
+			m_elapsed += Clock::now() - m_start;
+			m_running = false;
+		}
+
+		return false;
+	}
+
+	if (!m_running && m_remaining == m_iterations)
+	{
+		// Premier passage
+		if (m_skipped)
+			return false;
+
+		m_running = true;
+		m_start = Clock::now();
+	}
+
+	m_remaining--;
+	return true;
+}
+
+inline void BenchmarkState::PauseTiming()
+{
+	if (m_running)
+	{
+		m_elapsed += Clock::now() - m_start;
+		m_running = false;
+	}
+}
+
+inline void BenchmarkState::ResumeTiming()
+{
+	if (!m_running)
+	{
+		m_running = true;
+		m_start = Clock::now();
+	}
+}
+
+inline void BenchmarkState::SetBytesProcessed(nzUInt64 bytes)
+{
+	m_bytesProcessed = bytes;
+}
+
+inline void BenchmarkState::SetItemsProcessed(nzUInt64 items)
+{
+	m_itemsProcessed = items;
+}
+
+inline void BenchmarkState::SetLabel(const std::string& label)
+{
+	m_label = label;
+}
+
+inline void BenchmarkState::Skip(const std::string& reason)
+{
+	m_skipReason = reason;
+	m_skipped = true;
+}
+
+inline nzUInt64 BenchmarkState::GetIterationCount() const
+{
+	return m_iterations;
+}
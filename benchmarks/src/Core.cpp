@@ -0,0 +1,240 @@
+// Copyright (C) 2014 Jérôme Leclercq
+// This file is part of the "Nazara Engine - Benchmarks"
+// For conditions of distribution and use, see copyright notice in Config.hpp
+
+#include <Nazara/Core/MemoryArena.hpp>
+#include <Nazara/Core/MemoryPool.hpp>
+#include <Nazara/Core/String.hpp>
+#include <Nazara/Core/StringView.hpp>
+#include <Nazara/Core/Hash/CRC32.hpp>
+#include <Nazara/Core/Hash/XXH64.hpp>
+#include "Benchmark.hpp"
+#include <map>
+#include <memory>
+#include <random>
+#include <vector>
+
+namespace
+{
+	const unsigned int bufferSize = 1024*1024;
+
+	// Texte pseudo-aléatoire reproductible, l'aiguille n'apparaît qu'à la fin
+	NzString MakeHaystack(unsigned int size)
+	{
+		static const char alphabet[] = "abcdefghijklmnopqrstuvwxyz ABCDEFGHIJKLMNOPQRSTUVWXYZ";
+
+		std::mt19937 generator(42);
+		std::uniform_int_distribution<unsigned int> distribution(0, sizeof(alphabet)-2);
+
+		NzString string(size, ' ');
+		for (unsigned int i = 0; i < size; ++i)
+			string[i] = alphabet[distribution(generator)];
+
+		string += "NeedleInTheHaystack";
+		return string;
+	}
+
+	std::vector<nzUInt8> MakeBuffer(unsigned int size)
+	{
+		std::mt19937 generator(1337);
+
+		std::vector<nzUInt8> buffer(size);
+		for (nzUInt8& byte : buffer)
+			byte = static_cast<nzUInt8>(generator());
+
+		return buffer;
+	}
+
+	const unsigned int allocationCount = 1024;
+
+	struct Object
+	{
+		float values[12];
+	};
+}
+
+NAZARA_BENCHMARK(String, Find)
+{
+	NzString haystack = MakeHaystack(64*1024);
+
+	while (state.KeepRunning())
+		DoNotOptimize(haystack.Find("NeedleInTheHaystack"));
+
+	state.SetBytesProcessed(state.GetIterationCount()*haystack.GetSize());
+}
+
+NAZARA_BENCHMARK(String, FindCaseInsensitive)
+{
+	NzString haystack = MakeHaystack(64*1024);
+
+	while (state.KeepRunning())
+		DoNotOptimize(haystack.Find("needleinthehaystack", 0, NzString::CaseInsensitive));
+
+	state.SetBytesProcessed(state.GetIterationCount()*haystack.GetSize());
+}
+
+NAZARA_BENCHMARK(String, Concatenate)
+{
+	while (state.KeepRunning())
+	{
+		NzString string;
+		for (unsigned int i = 0; i < 64; ++i)
+			string += "token ";
+
+		DoNotOptimize(string);
+	}
+
+	state.SetItemsProcessed(state.GetIterationCount()*64);
+}
+
+NAZARA_BENCHMARK(String, Number)
+{
+	long long value = 0;
+	while (state.KeepRunning())
+		DoNotOptimize(NzString::Number(value++));
+
+	state.SetItemsProcessed(state.GetIterationCount());
+}
+
+NAZARA_BENCHMARK(String, Split)
+{
+	NzString text = MakeHaystack(16*1024);
+	std::vector<NzString> words;
+
+	while (state.KeepRunning())
+	{
+		words.clear();
+		DoNotOptimize(text.Split(words));
+	}
+
+	state.SetBytesProcessed(state.GetIterationCount()*text.GetSize());
+}
+
+NAZARA_BENCHMARK(String, Tokenize)
+{
+	NzString text = MakeHaystack(16*1024);
+
+	while (state.KeepRunning())
+	{
+		NzStringTokenizer tokenizer = NzStringTokenizer::Words(text);
+
+		NzStringView token;
+		unsigned int count = 0;
+		while (tokenizer.GetNext(&token))
+			count++;
+
+		DoNotOptimize(count);
+	}
+
+	state.SetBytesProcessed(state.GetIterationCount()*text.GetSize());
+}
+
+NAZARA_BENCHMARK(Hash, CRC32)
+{
+	std::vector<nzUInt8> buffer = MakeBuffer(bufferSize);
+	NzHashCRC32 hash;
+
+	while (state.KeepRunning())
+	{
+		hash.Begin();
+		hash.Append(buffer.data(), buffer.size());
+		DoNotOptimize(hash.End());
+	}
+
+	state.SetBytesProcessed(state.GetIterationCount()*buffer.size());
+}
+
+NAZARA_BENCHMARK(Hash, XXH64)
+{
+	std::vector<nzUInt8> buffer = MakeBuffer(bufferSize);
+	NzHashXXH64 hash;
+
+	while (state.KeepRunning())
+	{
+		hash.Begin();
+		hash.Append(buffer.data(), buffer.size());
+		DoNotOptimize(hash.End());
+	}
+
+	state.SetBytesProcessed(state.GetIterationCount()*buffer.size());
+}
+
+NAZARA_BENCHMARK(Memory, NewDelete)
+{
+	std::vector<Object*> objects(allocationCount);
+
+	while (state.KeepRunning())
+	{
+		for (Object*& object : objects)
+			object = new Object;
+
+		DoNotOptimize(objects);
+
+		for (Object* object : objects)
+			delete object;
+	}
+
+	state.SetItemsProcessed(state.GetIterationCount()*allocationCount);
+}
+
+NAZARA_BENCHMARK(Memory, Pool)
+{
+	NzMemoryPool pool(sizeof(Object), allocationCount);
+	std::vector<void*> blocks(allocationCount);
+
+	while (state.KeepRunning())
+	{
+		for (void*& block : blocks)
+			block = pool.Allocate();
+
+		DoNotOptimize(blocks);
+
+		for (void* block : blocks)
+			pool.Free(block);
+	}
+
+	state.SetItemsProcessed(state.GetIterationCount()*allocationCount);
+}
+
+NAZARA_BENCHMARK(Memory, Arena)
+{
+	NzMemoryArena arena;
+
+	while (state.KeepRunning())
+	{
+		for (unsigned int i = 0; i < allocationCount; ++i)
+			DoNotOptimize(arena.AllocateArray<Object>(1));
+
+		arena.Reset();
+	}
+
+	state.SetItemsProcessed(state.GetIterationCount()*allocationCount);
+}
+
+NAZARA_BENCHMARK(Memory, MapStdAllocator)
+{
+	while (state.KeepRunning())
+	{
+		std::map<unsigned int, float> map;
+		for (unsigned int i = 0; i < allocationCount; ++i)
+			map[(i*7919) % allocationCount] = static_cast<float>(i);
+
+		DoNotOptimize(map);
+	}
+
+	state.SetItemsProcessed(state.GetIterationCount()*allocationCount);
+}
+
+NAZARA_BENCHMARK(Memory, MapPoolAllocator)
+{
+	while (state.KeepRunning())
+	{
+		std::map<unsigned int, float, std::less<unsigned int>, NzPoolAllocator<std::pair<const unsigned int, float>>> map;
+		for (unsigned int i = 0; i < allocationCount; ++i)
+			map[(i*7919) % allocationCount] = static_cast<float>(i);
+
+		DoNotOptimize(map);
+	}
+
+	state.SetItemsProcessed(state.GetIterationCount()*allocationCount);
+}
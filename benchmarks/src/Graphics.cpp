@@ -0,0 +1,262 @@
+// Copyright (C) 2014 Jérôme Leclercq
+// This file is part of the "Nazara Engine - Benchmarks"
+// For conditions of distribution and use, see copyright notice in Config.hpp
+
+#include <Nazara/Core/MemoryStream.hpp>
+#include <Nazara/Core/PrimitiveList.hpp>
+#include <Nazara/Core/StringStream.hpp>
+#include <Nazara/Graphics/AbstractViewer.hpp>
+#include <Nazara/Graphics/ForwardRenderQueue.hpp>
+#include <Nazara/Graphics/Loaders/OBJ/OBJParser.hpp>
+#include <Nazara/Renderer/Material.hpp>
+#include <Nazara/Renderer/Renderer.hpp>
+#include <Nazara/Utility/Mesh.hpp>
+#include <Nazara/Utility/StaticMesh.hpp>
+#include "Benchmark.hpp"
+#include <random>
+#include <vector>
+
+namespace
+{
+	// Point de vue minimal, le tri de la file de rendu n'a besoin que de la caméra et de son frustum
+	class BenchmarkViewer : public NzAbstractViewer
+	{
+		public:
+			BenchmarkViewer()
+			{
+				m_eye.Set(0.f, 0.f, 50.f);
+				m_frustum.Build(70.f, 16.f/9.f, 1.f, 1000.f, m_eye, NzVector3f::Zero());
+				m_projectionMatrix.MakePerspective(70.f, 16.f/9.f, 1.f, 1000.f);
+				m_viewMatrix.MakeLookAt(m_eye, NzVector3f::Zero());
+				m_viewport.Set(0, 0, 1280, 720);
+			}
+
+			void ApplyView() const override
+			{
+			}
+
+			float GetAspectRatio() const override
+			{
+				return 16.f/9.f;
+			}
+
+			NzVector3f GetEyePosition() const override
+			{
+				return m_eye;
+			}
+
+			NzVector3f GetForward() const override
+			{
+				return NzVector3f::Forward();
+			}
+
+			const NzFrustumf& GetFrustum() const override
+			{
+				return m_frustum;
+			}
+
+			const NzMatrix4f& GetProjectionMatrix() const override
+			{
+				return m_projectionMatrix;
+			}
+
+			const NzRenderTarget* GetTarget() const override
+			{
+				return nullptr;
+			}
+
+			const NzMatrix4f& GetViewMatrix() const override
+			{
+				return m_viewMatrix;
+			}
+
+			const NzRecti& GetViewport() const override
+			{
+				return m_viewport;
+			}
+
+			float GetZFar() const override
+			{
+				return 1000.f;
+			}
+
+			float GetZNear() const override
+			{
+				return 1.f;
+			}
+
+		private:
+			NzFrustumf m_frustum;
+			NzMatrix4f m_projectionMatrix;
+			NzMatrix4f m_viewMatrix;
+			NzRecti m_viewport;
+			NzVector3f m_eye;
+	};
+
+	const unsigned int instanceCount = 4096;
+	const unsigned int materialCount = 16;
+
+	// Scène type: quelques meshs partagés par de nombreuses instances
+	// Le regroupement des modèles opaques trie par programme de shader, et nécessite donc le Renderer
+	struct RenderQueueScene
+	{
+		RenderQueueScene(bool opaque)
+		{
+			NzPrimitiveList primitives;
+			primitives.AddBox(NzVector3f(1.f));
+			primitives.AddCubicSphere(1.f, 2);
+			primitives.AddIcoSphere(1.f, 2);
+			primitives.AddUVSphere(1.f, 8, 8);
+
+			NzMeshParams params;
+			params.storage = nzBufferStorage_Software;
+
+			mesh.CreateStatic();
+			mesh.BuildSubMeshes(primitives, params);
+
+			for (unsigned int i = 0; i < materialCount; ++i)
+				materials[i].Enable(nzRendererParameter_Blend, !opaque || i % 4 == 0);
+
+			std::mt19937 generator(42);
+			std::uniform_real_distribution<float> distribution(-100.f, 100.f);
+
+			instances.resize(instanceCount);
+			for (unsigned int i = 0; i < instanceCount; ++i)
+			{
+				Instance& instance = instances[i];
+				instance.material = &materials[i % materialCount];
+				instance.subMesh = mesh.GetSubMesh(i % mesh.GetSubMeshCount());
+				instance.transformMatrix.MakeTranslation(NzVector3f(distribution(generator), distribution(generator), distribution(generator)));
+			}
+		}
+
+		void Fill(NzForwardRenderQueue& renderQueue) const
+		{
+			for (const Instance& instance : instances)
+				renderQueue.AddSubMesh(instance.material, instance.subMesh, instance.transformMatrix);
+		}
+
+		struct Instance
+		{
+			const NzMaterial* material;
+			const NzSubMesh* subMesh;
+			NzMatrix4f transformMatrix;
+		};
+
+		std::vector<Instance> instances;
+		BenchmarkViewer viewer;
+		NzMaterial materials[materialCount];
+		NzMesh mesh;
+	};
+
+	NzString MakeOBJ()
+	{
+		const unsigned int gridSize = 128;
+
+		NzStringStream stream;
+		stream << "# Grille générée pour les benchmarks\n";
+		stream << "mtllib benchmark.mtl\n";
+		stream << "o Grid\n";
+
+		for (unsigned int y = 0; y < gridSize; ++y)
+			for (unsigned int x = 0; x < gridSize; ++x)
+				stream << "v " << static_cast<float>(x)*0.5f << " 0 " << static_cast<float>(y)*0.5f << '\n';
+
+		for (unsigned int y = 0; y < gridSize; ++y)
+			for (unsigned int x = 0; x < gridSize; ++x)
+				stream << "vt " << static_cast<float>(x)/gridSize << ' ' << static_cast<float>(y)/gridSize << '\n';
+
+		stream << "vn 0 1 0\n";
+
+		for (unsigned int y = 0; y < gridSize-1; ++y)
+		{
+			// Deux matériaux en alternance, pour forcer la création de plusieurs meshs
+			stream << "usemtl Material" << y % 2 << '\n';
+
+			for (unsigned int x = 0; x < gridSize-1; ++x)
+			{
+				unsigned int i = y*gridSize + x + 1; // Les index OBJ commencent à 1
+				unsigned int j = i + gridSize;
+
+				stream << "f " << i << '/' << i << "/1 " << j << '/' << j << "/1 " << j+1 << '/' << j+1 << "/1 " << i+1 << '/' << i+1 << "/1\n";
+			}
+		}
+
+		return stream;
+	}
+}
+
+NAZARA_BENCHMARK(Parser, OBJ)
+{
+	NzString source = MakeOBJ();
+
+	while (state.KeepRunning())
+	{
+		NzMemoryStream stream(source.GetConstBuffer(), source.GetSize());
+
+		NzOBJParser parser(stream);
+		if (!parser.Parse())
+		{
+			state.Skip("Failed to parse generated OBJ");
+			break;
+		}
+
+		DoNotOptimize(parser);
+	}
+
+	state.SetBytesProcessed(state.GetIterationCount()*source.GetSize());
+}
+
+NAZARA_BENCHMARK(RenderQueue, ForwardFill)
+{
+	// Un quart des instances est transparent
+	if (!NzRenderer::IsInitialized())
+	{
+		state.Skip("Requires the renderer (--renderer)");
+		return;
+	}
+
+	RenderQueueScene scene(true);
+	NzForwardRenderQueue renderQueue;
+
+	while (state.KeepRunning())
+	{
+		renderQueue.Clear(false);
+		scene.Fill(renderQueue);
+	}
+
+	state.SetItemsProcessed(state.GetIterationCount()*instanceCount);
+}
+
+NAZARA_BENCHMARK(RenderQueue, ForwardFillTransparent)
+{
+	RenderQueueScene scene(false);
+	NzForwardRenderQueue renderQueue;
+
+	while (state.KeepRunning())
+	{
+		renderQueue.Clear(false);
+		scene.Fill(renderQueue);
+	}
+
+	state.SetItemsProcessed(state.GetIterationCount()*instanceCount);
+}
+
+NAZARA_BENCHMARK(RenderQueue, ForwardSort)
+{
+	// Seuls les modèles transparents sont triés par distance
+	RenderQueueScene scene(false);
+	NzForwardRenderQueue renderQueue;
+
+	while (state.KeepRunning())
+	{
+		state.PauseTiming();
+		renderQueue.Clear(false);
+		scene.Fill(renderQueue);
+		state.ResumeTiming();
+
+		renderQueue.Sort(&scene.viewer);
+	}
+
+	state.SetItemsProcessed(state.GetIterationCount()*instanceCount);
+}
@@ -0,0 +1,601 @@
+// Copyright (C) 2014 Jérôme Leclercq
+// This file is part of the "Nazara Engine - Benchmarks"
+// For conditions of distribution and use, see copyright notice in Config.hpp
+
+#include <Nazara/Core/Simd.hpp>
+#include <Nazara/Math/Algorithm.hpp>
+#include <Nazara/Math/BVH.hpp>
+#include <Nazara/Math/Box.hpp>
+#include <Nazara/Math/EulerAngles.hpp>
+#include <Nazara/Math/Frustum.hpp>
+#include <Nazara/Math/Matrix4.hpp>
+#include <Nazara/Math/Quaternion.hpp>
+#include <Nazara/Math/Sphere.hpp>
+#include <Nazara/Math/Vector3.hpp>
+#include <Nazara/Math/Vector4.hpp>
+#include "Benchmark.hpp"
+#include <algorithm>
+#include <random>
+#include <vector>
+
+namespace
+{
+	// Les opérations portent sur des tableaux pour que le compilateur ne puisse pas précalculer les résultats
+	const unsigned int elementCount = 1024;
+
+	std::vector<NzVector3f> MakePositions(unsigned int count, float range)
+	{
+		std::mt19937 generator(42);
+		std::uniform_real_distribution<float> distribution(-range, range);
+
+		std::vector<NzVector3f> positions(count);
+		for (NzVector3f& position : positions)
+			position.Set(distribution(generator), distribution(generator), distribution(generator));
+
+		return positions;
+	}
+
+	std::vector<NzQuaternionf> MakeRotations(unsigned int count)
+	{
+		std::mt19937 generator(1337);
+		std::uniform_real_distribution<float> distribution(-180.f, 180.f);
+
+		std::vector<NzQuaternionf> rotations(count);
+		for (NzQuaternionf& rotation : rotations)
+			rotation = NzQuaternionf(NzEulerAnglesf(distribution(generator), distribution(generator), distribution(generator)));
+
+		return rotations;
+	}
+
+	std::vector<NzMatrix4f> MakeMatrices(unsigned int count)
+	{
+		std::vector<NzVector3f> positions = MakePositions(count, 100.f);
+		std::vector<NzQuaternionf> rotations = MakeRotations(count);
+
+		std::vector<NzMatrix4f> matrices(count);
+		for (unsigned int i = 0; i < count; ++i)
+			matrices[i].MakeTransform(positions[i], rotations[i]);
+
+		return matrices;
+	}
+
+	// Force les noyaux scalaires de NzSimd le temps d'un benchmark, pour comparaison avec les versions SIMD
+	class ScalarKernels
+	{
+		public:
+			ScalarKernels() :
+			m_wasEnabled(NzSimd::IsEnabled())
+			{
+				NzSimd::Enable(false);
+			}
+
+			~ScalarKernels()
+			{
+				NzSimd::Enable(m_wasEnabled);
+			}
+
+		private:
+			bool m_wasEnabled;
+	};
+
+	void MatrixConcatenate(BenchmarkState& state)
+	{
+		std::vector<NzMatrix4f> matrices = MakeMatrices(elementCount);
+		NzMatrix4f viewProj = NzMatrix4f::LookAt(NzVector3f(0.f, 10.f, 10.f), NzVector3f::Zero());
+		viewProj.Concatenate(NzMatrix4f::Perspective(70.f, 16.f/9.f, 1.f, 500.f));
+
+		std::vector<NzMatrix4f> results(elementCount);
+		while (state.KeepRunning())
+		{
+			for (unsigned int i = 0; i < elementCount; ++i)
+			{
+				results[i] = matrices[i];
+				results[i].Concatenate(viewProj);
+			}
+
+			DoNotOptimize(results);
+		}
+
+		state.SetItemsProcessed(state.GetIterationCount()*elementCount);
+	}
+
+	void MatrixConcatenateAffine(BenchmarkState& state)
+	{
+		std::vector<NzMatrix4f> matrices = MakeMatrices(elementCount);
+		std::vector<NzMatrix4f> parents = MakeMatrices(elementCount);
+
+		std::vector<NzMatrix4f> results(elementCount);
+		while (state.KeepRunning())
+		{
+			for (unsigned int i = 0; i < elementCount; ++i)
+			{
+				results[i] = parents[i];
+				results[i].ConcatenateAffine(matrices[i]);
+			}
+
+			DoNotOptimize(results);
+		}
+
+		state.SetItemsProcessed(state.GetIterationCount()*elementCount);
+	}
+
+	void MatrixInverseAffine(BenchmarkState& state)
+	{
+		std::vector<NzMatrix4f> matrices = MakeMatrices(elementCount);
+
+		std::vector<NzMatrix4f> results(elementCount);
+		while (state.KeepRunning())
+		{
+			for (unsigned int i = 0; i < elementCount; ++i)
+				matrices[i].GetInverseAffine(&results[i]);
+
+			DoNotOptimize(results);
+		}
+
+		state.SetItemsProcessed(state.GetIterationCount()*elementCount);
+	}
+
+	// Disposition d'un sommet typique, les positions et normales sont entrelacées avec d'autres attributs
+	struct BatchVertex
+	{
+		NzVector3f position;
+		NzVector3f normal;
+		float uv[2];
+	};
+
+	const unsigned int batchSize = 4096;
+
+	std::vector<BatchVertex> MakeBatchVertices()
+	{
+		std::vector<NzVector3f> positions = MakePositions(batchSize, 100.f);
+		std::vector<NzVector3f> normals = MakePositions(batchSize, 1.f);
+
+		std::vector<BatchVertex> vertices(batchSize);
+		for (unsigned int i = 0; i < batchSize; ++i)
+		{
+			vertices[i].position = positions[i];
+			vertices[i].normal = normals[i].GetNormal();
+		}
+
+		return vertices;
+	}
+
+	void BatchTransformNormals(BenchmarkState& state)
+	{
+		std::vector<BatchVertex> vertices = MakeBatchVertices();
+		NzMatrix4f matrix = MakeMatrices(1)[0];
+
+		while (state.KeepRunning())
+		{
+			NzTransformNormals(matrix, &vertices[0].normal, &vertices[0].normal, batchSize, sizeof(BatchVertex), sizeof(BatchVertex));
+			DoNotOptimize(vertices);
+		}
+
+		state.SetItemsProcessed(state.GetIterationCount()*batchSize);
+	}
+
+	void BatchTransformPositions(BenchmarkState& state)
+	{
+		std::vector<BatchVertex> vertices = MakeBatchVertices();
+		NzMatrix4f matrix = MakeMatrices(1)[0];
+
+		std::vector<NzVector3f> results(batchSize);
+		while (state.KeepRunning())
+		{
+			NzTransformPositions(matrix, &vertices[0].position, results.data(), batchSize, sizeof(BatchVertex));
+			DoNotOptimize(results);
+		}
+
+		state.SetItemsProcessed(state.GetIterationCount()*batchSize);
+	}
+
+	void BatchTransformPositionsSoA(BenchmarkState& state)
+	{
+		std::vector<NzVector3f> positions = MakePositions(batchSize, 100.f);
+		NzMatrix4f matrix = MakeMatrices(1)[0];
+
+		std::vector<float> x(batchSize), y(batchSize), z(batchSize);
+		for (unsigned int i = 0; i < batchSize; ++i)
+		{
+			x[i] = positions[i].x;
+			y[i] = positions[i].y;
+			z[i] = positions[i].z;
+		}
+
+		std::vector<float> resultX(batchSize), resultY(batchSize), resultZ(batchSize);
+		while (state.KeepRunning())
+		{
+			NzTransformPositions(matrix, x.data(), y.data(), z.data(), resultX.data(), resultY.data(), resultZ.data(), batchSize);
+			DoNotOptimize(resultX);
+			DoNotOptimize(resultY);
+			DoNotOptimize(resultZ);
+		}
+
+		state.SetItemsProcessed(state.GetIterationCount()*batchSize);
+	}
+
+	NzFrustumf MakeFrustum()
+	{
+		NzFrustumf frustum;
+		frustum.Build(70.f, 16.f/9.f, 1.f, 500.f, NzVector3f::Zero(), NzVector3f::Forward());
+
+		return frustum;
+	}
+
+	// Scène type pour les hiérarchies de volumes: de nombreux petits objets répartis dans un grand volume
+	const unsigned int sceneObjectCount = 65536;
+
+	std::vector<NzBoxf> MakeSceneBoxes()
+	{
+		std::vector<NzVector3f> positions = MakePositions(sceneObjectCount, 500.f);
+
+		std::vector<NzBoxf> boxes(sceneObjectCount);
+		for (unsigned int i = 0; i < sceneObjectCount; ++i)
+			boxes[i].Set(positions[i].x, positions[i].y, positions[i].z, 2.f, 2.f, 2.f);
+
+		return boxes;
+	}
+
+	void BuildBVH(BenchmarkState& state, bool parallel)
+	{
+		std::vector<NzBoxf> boxes = MakeSceneBoxes();
+
+		NzBVHf bvh;
+		while (state.KeepRunning())
+		{
+			if (parallel)
+				bvh.BuildParallel(boxes.data(), sceneObjectCount);
+			else
+				bvh.Build(boxes.data(), sceneObjectCount);
+
+			DoNotOptimize(bvh);
+		}
+
+		state.SetItemsProcessed(state.GetIterationCount()*sceneObjectCount);
+	}
+}
+
+NAZARA_BENCHMARK(Math, MatrixConcatenate)
+{
+	MatrixConcatenate(state);
+}
+
+NAZARA_BENCHMARK(Math, MatrixConcatenateScalar)
+{
+	ScalarKernels scalar;
+	MatrixConcatenate(state);
+}
+
+NAZARA_BENCHMARK(Math, MatrixConcatenateAffine)
+{
+	MatrixConcatenateAffine(state);
+}
+
+NAZARA_BENCHMARK(Math, MatrixConcatenateAffineScalar)
+{
+	ScalarKernels scalar;
+	MatrixConcatenateAffine(state);
+}
+
+NAZARA_BENCHMARK(Math, MatrixInverse)
+{
+	std::vector<NzMatrix4f> matrices = MakeMatrices(elementCount);
+
+	std::vector<NzMatrix4f> results(elementCount);
+	while (state.KeepRunning())
+	{
+		for (unsigned int i = 0; i < elementCount; ++i)
+			matrices[i].GetInverse(&results[i]);
+
+		DoNotOptimize(results);
+	}
+
+	state.SetItemsProcessed(state.GetIterationCount()*elementCount);
+}
+
+NAZARA_BENCHMARK(Math, MatrixInverseAffine)
+{
+	MatrixInverseAffine(state);
+}
+
+NAZARA_BENCHMARK(Math, MatrixInverseAffineScalar)
+{
+	ScalarKernels scalar;
+	MatrixInverseAffine(state);
+}
+
+NAZARA_BENCHMARK(Math, MatrixMakeTransform)
+{
+	std::vector<NzVector3f> positions = MakePositions(elementCount, 100.f);
+	std::vector<NzQuaternionf> rotations = MakeRotations(elementCount);
+
+	std::vector<NzMatrix4f> results(elementCount);
+	while (state.KeepRunning())
+	{
+		for (unsigned int i = 0; i < elementCount; ++i)
+			results[i].MakeTransform(positions[i], rotations[i], NzVector3f(2.f));
+
+		DoNotOptimize(results);
+	}
+
+	state.SetItemsProcessed(state.GetIterationCount()*elementCount);
+}
+
+NAZARA_BENCHMARK(Math, MatrixTransformVector)
+{
+	std::vector<NzVector3f> positions = MakePositions(elementCount, 100.f);
+	NzMatrix4f matrix = MakeMatrices(1)[0];
+
+	std::vector<NzVector3f> results(elementCount);
+	while (state.KeepRunning())
+	{
+		for (unsigned int i = 0; i < elementCount; ++i)
+			results[i] = matrix.Transform(positions[i]);
+
+		DoNotOptimize(results);
+	}
+
+	state.SetItemsProcessed(state.GetIterationCount()*elementCount);
+}
+
+NAZARA_BENCHMARK(Math, MatrixTransformVector4)
+{
+	std::vector<NzVector3f> positions = MakePositions(elementCount, 100.f);
+	NzMatrix4f matrix = NzMatrix4f::Perspective(70.f, 16.f/9.f, 1.f, 500.f);
+
+	std::vector<NzVector4f> vectors(elementCount);
+	for (unsigned int i = 0; i < elementCount; ++i)
+		vectors[i].Set(positions[i], 1.f);
+
+	std::vector<NzVector4f> results(elementCount);
+	while (state.KeepRunning())
+	{
+		for (unsigned int i = 0; i < elementCount; ++i)
+			results[i] = matrix.Transform(vectors[i]);
+
+		DoNotOptimize(results);
+	}
+
+	state.SetItemsProcessed(state.GetIterationCount()*elementCount);
+}
+
+NAZARA_BENCHMARK(Math, QuaternionMultiply)
+{
+	std::vector<NzQuaternionf> rotations = MakeRotations(elementCount);
+	NzQuaternionf rotation(NzEulerAnglesf(10.f, 20.f, 30.f));
+
+	std::vector<NzQuaternionf> results(elementCount);
+	while (state.KeepRunning())
+	{
+		for (unsigned int i = 0; i < elementCount; ++i)
+			results[i] = rotations[i] * rotation;
+
+		DoNotOptimize(results);
+	}
+
+	state.SetItemsProcessed(state.GetIterationCount()*elementCount);
+}
+
+NAZARA_BENCHMARK(Math, QuaternionRotateVector)
+{
+	std::vector<NzQuaternionf> rotations = MakeRotations(elementCount);
+	std::vector<NzVector3f> positions = MakePositions(elementCount, 100.f);
+
+	std::vector<NzVector3f> results(elementCount);
+	while (state.KeepRunning())
+	{
+		for (unsigned int i = 0; i < elementCount; ++i)
+			results[i] = rotations[i] * positions[i];
+
+		DoNotOptimize(results);
+	}
+
+	state.SetItemsProcessed(state.GetIterationCount()*elementCount);
+}
+
+NAZARA_BENCHMARK(Math, QuaternionSlerp)
+{
+	std::vector<NzQuaternionf> from = MakeRotations(elementCount);
+	std::vector<NzQuaternionf> to = MakeRotations(elementCount+1);
+
+	std::vector<NzQuaternionf> results(elementCount);
+	while (state.KeepRunning())
+	{
+		for (unsigned int i = 0; i < elementCount; ++i)
+			results[i] = NzQuaternionf::Slerp(from[i], to[i+1], 0.3f);
+
+		DoNotOptimize(results);
+	}
+
+	state.SetItemsProcessed(state.GetIterationCount()*elementCount);
+}
+
+NAZARA_BENCHMARK(Math, BatchTransformNormals)
+{
+	BatchTransformNormals(state);
+}
+
+NAZARA_BENCHMARK(Math, BatchTransformNormalsScalar)
+{
+	ScalarKernels scalar;
+	BatchTransformNormals(state);
+}
+
+NAZARA_BENCHMARK(Math, BatchTransformPositions)
+{
+	BatchTransformPositions(state);
+}
+
+NAZARA_BENCHMARK(Math, BatchTransformPositionsScalar)
+{
+	ScalarKernels scalar;
+	BatchTransformPositions(state);
+}
+
+NAZARA_BENCHMARK(Math, BatchTransformPositionsSoA)
+{
+	BatchTransformPositionsSoA(state);
+}
+
+NAZARA_BENCHMARK(Math, BatchTransformPositionsSoAScalar)
+{
+	ScalarKernels scalar;
+	BatchTransformPositionsSoA(state);
+}
+
+NAZARA_BENCHMARK(Math, FrustumBuild)
+{
+	std::vector<NzVector3f> eyes = MakePositions(elementCount, 100.f);
+
+	NzFrustumf frustum;
+	while (state.KeepRunning())
+	{
+		for (unsigned int i = 0; i < elementCount; ++i)
+		{
+			frustum.Build(70.f, 16.f/9.f, 1.f, 500.f, eyes[i], NzVector3f::Zero());
+			DoNotOptimize(frustum);
+		}
+	}
+
+	state.SetItemsProcessed(state.GetIterationCount()*elementCount);
+}
+
+NAZARA_BENCHMARK(Math, FrustumExtract)
+{
+	std::vector<NzVector3f> eyes = MakePositions(elementCount, 100.f);
+	NzMatrix4f projection = NzMatrix4f::Perspective(70.f, 16.f/9.f, 1.f, 500.f);
+
+	std::vector<NzMatrix4f> views(elementCount);
+	for (unsigned int i = 0; i < elementCount; ++i)
+		views[i].MakeLookAt(eyes[i], NzVector3f::Zero());
+
+	NzFrustumf frustum;
+	while (state.KeepRunning())
+	{
+		for (unsigned int i = 0; i < elementCount; ++i)
+		{
+			frustum.Extract(views[i], projection);
+			DoNotOptimize(frustum);
+		}
+	}
+
+	state.SetItemsProcessed(state.GetIterationCount()*elementCount);
+}
+
+NAZARA_BENCHMARK(Math, FrustumIntersectBox)
+{
+	NzFrustumf frustum = MakeFrustum();
+	std::vector<NzVector3f> positions = MakePositions(elementCount, 300.f);
+
+	std::vector<NzBoxf> boxes(elementCount);
+	for (unsigned int i = 0; i < elementCount; ++i)
+		boxes[i].Set(positions[i].x, positions[i].y, positions[i].z, 5.f, 5.f, 5.f);
+
+	while (state.KeepRunning())
+	{
+		unsigned int visible = 0;
+		for (const NzBoxf& box : boxes)
+		{
+			if (frustum.Intersect(box) != nzIntersectionSide_Outside)
+				visible++;
+		}
+
+		DoNotOptimize(visible);
+	}
+
+	state.SetItemsProcessed(state.GetIterationCount()*elementCount);
+}
+
+NAZARA_BENCHMARK(Math, FrustumIntersectSphere)
+{
+	NzFrustumf frustum = MakeFrustum();
+	std::vector<NzVector3f> positions = MakePositions(elementCount, 300.f);
+
+	std::vector<NzSpheref> spheres(elementCount);
+	for (unsigned int i = 0; i < elementCount; ++i)
+		spheres[i].Set(positions[i], 5.f);
+
+	while (state.KeepRunning())
+	{
+		unsigned int visible = 0;
+		for (const NzSpheref& sphere : spheres)
+		{
+			if (frustum.Intersect(sphere) != nzIntersectionSide_Outside)
+				visible++;
+		}
+
+		DoNotOptimize(visible);
+	}
+
+	state.SetItemsProcessed(state.GetIterationCount()*elementCount);
+}
+
+NAZARA_BENCHMARK(Math, BVHBuild)
+{
+	BuildBVH(state, false);
+}
+
+NAZARA_BENCHMARK(Math, BVHBuildParallel)
+{
+	BuildBVH(state, true);
+}
+
+NAZARA_BENCHMARK(Math, BVHQueryFrustum)
+{
+	std::vector<NzBoxf> boxes = MakeSceneBoxes();
+	NzFrustumf frustum = MakeFrustum();
+
+	NzBVHf bvh;
+	bvh.Build(boxes.data(), sceneObjectCount);
+
+	while (state.KeepRunning())
+	{
+		unsigned int visible = 0;
+		bvh.QueryFrustum(frustum, [&](unsigned int primitive)
+		{
+			if (frustum.Intersect(boxes[primitive]) != nzIntersectionSide_Outside)
+				visible++;
+		});
+
+		DoNotOptimize(visible);
+	}
+
+	state.SetItemsProcessed(state.GetIterationCount()*sceneObjectCount);
+}
+
+NAZARA_BENCHMARK(Math, BVHRaycast)
+{
+	// Rayons partant de l'origine, le test exact est celui de la boîte de chaque objet
+	std::vector<NzBoxf> boxes = MakeSceneBoxes();
+	std::vector<NzVector3f> directions = MakePositions(elementCount, 1.f);
+
+	NzBVHf bvh;
+	bvh.Build(boxes.data(), sceneObjectCount);
+
+	while (state.KeepRunning())
+	{
+		for (const NzVector3f& direction : directions)
+		{
+			NzVector3f invDirection(1.f/direction.x, 1.f/direction.y, 1.f/direction.z);
+
+			float distance;
+			bool hit = bvh.Raycast(NzVector3f::Zero(), direction, 1000.f, [&](unsigned int primitive, float* maxDistance)
+			{
+				NzVector3f near = boxes[primitive].GetMinimum()*invDirection;
+				NzVector3f far = boxes[primitive].GetMaximum()*invDirection;
+
+				float entry = std::max({0.f, std::min(near.x, far.x), std::min(near.y, far.y), std::min(near.z, far.z)});
+				float exit = std::min({*maxDistance, std::max(near.x, far.x), std::max(near.y, far.y), std::max(near.z, far.z)});
+				if (entry > exit)
+					return false;
+
+				*maxDistance = entry;
+				return true;
+			}, &distance);
+
+			DoNotOptimize(hit);
+		}
+	}
+
+	state.SetItemsProcessed(state.GetIterationCount()*elementCount);
+}
@@ -0,0 +1,109 @@
+// Copyright (C) 2014 Jérôme Leclercq
+// This file is part of the "Nazara Engine - Benchmarks"
+// For conditions of distribution and use, see copyright notice in Config.hpp
+
+#include <Nazara/Noise/FBM2D.hpp>
+#include <Nazara/Noise/Perlin2D.hpp>
+#include <Nazara/Noise/Perlin3D.hpp>
+#include <Nazara/Noise/Perlin4D.hpp>
+#include <Nazara/Noise/Simplex2D.hpp>
+#include <Nazara/Noise/Simplex3D.hpp>
+#include <Nazara/Noise/Simplex4D.hpp>
+#include "Benchmark.hpp"
+
+namespace
+{
+	// Chaque itération échantillonne une carte de hauteur complète
+	const unsigned int mapSize = 64;
+	const float resolution = 0.05f;
+
+	template<typename Noise>
+	void Sample2D(BenchmarkState& state, Noise& noise)
+	{
+		while (state.KeepRunning())
+		{
+			float sum = 0.f;
+			for (unsigned int y = 0; y < mapSize; ++y)
+				for (unsigned int x = 0; x < mapSize; ++x)
+					sum += noise.GetValue(static_cast<float>(x), static_cast<float>(y), resolution);
+
+			DoNotOptimize(sum);
+		}
+
+		state.SetItemsProcessed(state.GetIterationCount()*mapSize*mapSize);
+	}
+
+	template<typename Noise>
+	void Sample3D(BenchmarkState& state, Noise& noise)
+	{
+		while (state.KeepRunning())
+		{
+			float sum = 0.f;
+			for (unsigned int y = 0; y < mapSize; ++y)
+				for (unsigned int x = 0; x < mapSize; ++x)
+					sum += noise.GetValue(static_cast<float>(x), static_cast<float>(y), 0.5f, resolution);
+
+			DoNotOptimize(sum);
+		}
+
+		state.SetItemsProcessed(state.GetIterationCount()*mapSize*mapSize);
+	}
+
+	template<typename Noise>
+	void Sample4D(BenchmarkState& state, Noise& noise)
+	{
+		while (state.KeepRunning())
+		{
+			float sum = 0.f;
+			for (unsigned int y = 0; y < mapSize; ++y)
+				for (unsigned int x = 0; x < mapSize; ++x)
+					sum += noise.GetValue(static_cast<float>(x), static_cast<float>(y), 0.5f, 0.25f, resolution);
+
+			DoNotOptimize(sum);
+		}
+
+		state.SetItemsProcessed(state.GetIterationCount()*mapSize*mapSize);
+	}
+}
+
+NAZARA_BENCHMARK(Noise, Perlin2D)
+{
+	NzPerlin2D noise(42);
+	Sample2D(state, noise);
+}
+
+NAZARA_BENCHMARK(Noise, Perlin3D)
+{
+	NzPerlin3D noise(42);
+	Sample3D(state, noise);
+}
+
+NAZARA_BENCHMARK(Noise, Perlin4D)
+{
+	NzPerlin4D noise(42);
+	Sample4D(state, noise);
+}
+
+NAZARA_BENCHMARK(Noise, Simplex2D)
+{
+	NzSimplex2D noise(42);
+	Sample2D(state, noise);
+}
+
+NAZARA_BENCHMARK(Noise, Simplex3D)
+{
+	NzSimplex3D noise(42);
+	Sample3D(state, noise);
+}
+
+NAZARA_BENCHMARK(Noise, Simplex4D)
+{
+	NzSimplex4D noise(42);
+	Sample4D(state, noise);
+}
+
+NAZARA_BENCHMARK(Noise, FBM2D)
+{
+	NzFBM2D noise(SIMPLEX, 42);
+	Sample2D(state, noise);
+}
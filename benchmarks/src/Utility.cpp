@@ -0,0 +1,707 @@
+// Copyright (C) 2014 Jérôme Leclercq
+// This file is part of the "Nazara Engine - Benchmarks"
+// For conditions of distribution and use, see copyright notice in Config.hpp
+
+#include <Nazara/Core/MemoryStream.hpp>
+#include <Nazara/Core/PrimitiveList.hpp>
+#include <Nazara/Core/StringStream.hpp>
+#include <Nazara/Math/EulerAngles.hpp>
+#include <Nazara/Utility/Algorithm.hpp>
+#include <Nazara/Utility/Animation.hpp>
+#include <Nazara/Utility/AnimationInstancer.hpp>
+#include <Nazara/Utility/Image.hpp>
+#include <Nazara/Utility/IndexBuffer.hpp>
+#include <Nazara/Utility/IndexIterator.hpp>
+#include <Nazara/Utility/IndexMapper.hpp>
+#include <Nazara/Utility/Joint.hpp>
+#include <Nazara/Utility/Mesh.hpp>
+#include <Nazara/Utility/PixelFormat.hpp>
+#include <Nazara/Utility/SkeletalMesh.hpp>
+#include <Nazara/Utility/SkeletalPose.hpp>
+#include <Nazara/Utility/SkeletalPosePool.hpp>
+#include <Nazara/Utility/Skeleton.hpp>
+#include <Nazara/Utility/StaticMesh.hpp>
+#include "Benchmark.hpp"
+#include <algorithm>
+#include <cmath>
+#include <memory>
+#include <random>
+#include <string>
+#include <utility>
+#include <vector>
+
+namespace
+{
+	const unsigned int imageSize = 512;
+
+	std::vector<nzUInt8> MakePixels(nzPixelFormat format)
+	{
+		std::mt19937 generator(42);
+
+		std::vector<nzUInt8> pixels(imageSize*imageSize*NzPixelFormat::GetBytesPerPixel(format));
+		for (nzUInt8& byte : pixels)
+			byte = static_cast<nzUInt8>(generator());
+
+		return pixels;
+	}
+
+	void Convert(BenchmarkState& state, nzPixelFormat srcFormat, nzPixelFormat dstFormat)
+	{
+		std::vector<nzUInt8> src = MakePixels(srcFormat);
+		std::vector<nzUInt8> dst(imageSize*imageSize*NzPixelFormat::GetBytesPerPixel(dstFormat));
+
+		if (!NzPixelFormat::IsConversionSupported(srcFormat, dstFormat))
+		{
+			state.Skip("Conversion from " + NzPixelFormat::ToString(srcFormat) + " to " + NzPixelFormat::ToString(dstFormat) + " is not supported");
+			return;
+		}
+
+		while (state.KeepRunning())
+		{
+			NzPixelFormat::Convert(srcFormat, dstFormat, src.data(), src.data() + src.size(), dst.data());
+			DoNotOptimize(dst);
+		}
+
+		state.SetBytesProcessed(state.GetIterationCount()*src.size());
+	}
+
+	// Grille de gridSize*gridSize sommets, chacun influencé par deux joints voisins
+	const unsigned int gridSize = 64;
+	const unsigned int jointCount = 32;
+
+	NzMesh* MakeSkeletalMesh()
+	{
+		std::unique_ptr<NzMesh> mesh(new NzMesh);
+		mesh->SetPersistent(false);
+		mesh->CreateSkeletal(jointCount);
+
+		NzSkeleton* skeleton = mesh->GetSkeleton();
+		for (unsigned int i = 0; i < jointCount; ++i)
+		{
+			NzJoint* joint = skeleton->GetJoint(i);
+			if (i > 0)
+				joint->SetParent(skeleton->GetJoint(i-1));
+
+			joint->SetPosition(NzVector3f(0.f, 1.f, 0.f));
+			joint->SetRotation(NzEulerAnglesf(2.f, 0.f, 1.f));
+			joint->SetInverseBindMatrix(NzMatrix4f::Translate(NzVector3f(0.f, -static_cast<float>(i+1), 0.f)));
+		}
+
+		const unsigned int vertexCount = gridSize*gridSize;
+
+		std::unique_ptr<NzSkeletalMesh> subMesh(new NzSkeletalMesh(mesh.get()));
+		subMesh->Create(vertexCount, vertexCount*2);
+
+		NzMeshVertex* vertices = subMesh->GetBindPoseBuffer();
+		NzWeight* weights = subMesh->GetWeight();
+		for (unsigned int i = 0; i < vertexCount; ++i)
+		{
+			float x = static_cast<float>(i % gridSize)/gridSize;
+			float y = static_cast<float>(i / gridSize)/gridSize;
+
+			vertices[i].position.Set(x, y*jointCount, 0.f);
+			vertices[i].normal = NzVector3f::Forward();
+			vertices[i].tangent = NzVector3f::Right();
+			vertices[i].uv.Set(x, y);
+
+			unsigned int joint = std::min(static_cast<unsigned int>(y*jointCount), jointCount-2);
+
+			NzVertexWeight* vertexWeight = subMesh->GetVertexWeight(i);
+			vertexWeight->weights.resize(2);
+			vertexWeight->weights[0] = i*2;
+			vertexWeight->weights[1] = i*2 + 1;
+
+			weights[i*2].jointIndex = joint;
+			weights[i*2].weight = 0.75f;
+			weights[i*2 + 1].jointIndex = joint+1;
+			weights[i*2 + 1].weight = 0.25f;
+		}
+
+		mesh->AddSubMesh(subMesh.release());
+
+		return mesh.release();
+	}
+
+	// Animation de la chaîne de joints de MakeSkeletalMesh: un quart des joints reste immobile, les autres oscillent
+	const unsigned int animationFrameCount = 1024;
+
+	NzAnimation* MakeSkeletalAnimation()
+	{
+		std::unique_ptr<NzAnimation> animation(new NzAnimation);
+		animation->SetPersistent(false);
+		animation->CreateSkeletal(animationFrameCount, jointCount);
+
+		for (unsigned int i = 0; i < animationFrameCount; ++i)
+		{
+			float time = static_cast<float>(i)/30.f;
+
+			NzSequenceJoint* sequenceJoints = animation->GetSequenceJoints(i);
+			for (unsigned int j = 0; j < jointCount; ++j)
+			{
+				if (j % 4 == 3)
+					sequenceJoints[j].rotation = NzEulerAnglesf(2.f, 0.f, 1.f);
+				else
+					sequenceJoints[j].rotation = NzEulerAnglesf(20.f*std::sin(time + j), 10.f*std::cos(0.7f*time + j), 5.f*std::sin(1.3f*time));
+
+				sequenceJoints[j].position = (j == 0) ? NzVector3f(0.f, 0.1f*std::sin(5.f*time), time) : NzVector3f(0.f, 1.f, 0.f);
+				sequenceJoints[j].scale = NzVector3f(1.f);
+			}
+		}
+
+		NzSequence sequence;
+		sequence.firstFrame = 0;
+		sequence.frameCount = animationFrameCount;
+		sequence.frameRate = 30;
+		sequence.name = "Benchmark";
+
+		animation->AddSequence(sequence);
+
+		return animation.release();
+	}
+
+	void SampleAnimation(BenchmarkState& state, bool compress)
+	{
+		NzAnimationRef animation = MakeSkeletalAnimation();
+		if (compress && !animation->Compress())
+		{
+			state.Skip("Failed to compress animation");
+			return;
+		}
+
+		NzSkeleton skeleton;
+		skeleton.Create(jointCount);
+
+		// Chaque itération avance d'une frame, comme un personnage animé à la cadence de l'animation
+		unsigned int frame = 0;
+		while (state.KeepRunning())
+		{
+			animation->AnimateSkeleton(&skeleton, frame, frame+1, 0.5f);
+			DoNotOptimize(skeleton);
+
+			frame = (frame+1) % (animationFrameCount-1);
+		}
+
+		state.SetItemsProcessed(state.GetIterationCount()*jointCount);
+		state.SetLabel(std::to_string(animation->GetMemoryUsage()/1024) + " KiB");
+	}
+
+	NzString MakeMD5Mesh()
+	{
+		NzStringStream stream;
+		stream << "MD5Version 10\n";
+		stream << "commandline \"\"\n\n";
+		stream << "numJoints " << jointCount << '\n';
+		stream << "numMeshes 1\n\n";
+
+		stream << "joints {\n";
+		for (unsigned int i = 0; i < jointCount; ++i)
+			stream << "\t\"joint" << i << "\" " << static_cast<int>(i)-1 << " ( 0 " << i << " 0 ) ( 0 0 0 )\n";
+		stream << "}\n\n";
+
+		const unsigned int vertexCount = gridSize*gridSize;
+		const unsigned int triangleCount = (gridSize-1)*(gridSize-1)*2;
+
+		stream << "mesh {\n";
+		stream << "\tshader \"benchmark\"\n\n";
+
+		stream << "\tnumverts " << vertexCount << '\n';
+		for (unsigned int i = 0; i < vertexCount; ++i)
+		{
+			float u = static_cast<float>(i % gridSize)/gridSize;
+			float v = static_cast<float>(i / gridSize)/gridSize;
+
+			stream << "\tvert " << i << " ( " << u << ' ' << v << " ) " << i*2 << " 2\n";
+		}
+
+		stream << "\n\tnumtris " << triangleCount << '\n';
+		unsigned int triangle = 0;
+		for (unsigned int y = 0; y < gridSize-1; ++y)
+		{
+			for (unsigned int x = 0; x < gridSize-1; ++x)
+			{
+				unsigned int i = y*gridSize + x;
+				stream << "\ttri " << triangle++ << ' ' << i << ' ' << i + gridSize << ' ' << i + 1 << '\n';
+				stream << "\ttri " << triangle++ << ' ' << i + 1 << ' ' << i + gridSize << ' ' << i + gridSize + 1 << '\n';
+			}
+		}
+
+		stream << "\n\tnumweights " << vertexCount*2 << '\n';
+		for (unsigned int i = 0; i < vertexCount; ++i)
+		{
+			unsigned int joint = std::min((i / gridSize)*jointCount/gridSize, jointCount-2);
+			float x = static_cast<float>(i % gridSize)/gridSize;
+
+			stream << "\tweight " << i*2 << ' ' << joint << " 0.75 ( " << x << " 0.5 0 )\n";
+			stream << "\tweight " << i*2 + 1 << ' ' << joint+1 << " 0.25 ( " << x << " -0.5 0 )\n";
+		}
+
+		stream << "}\n";
+
+		return stream;
+	}
+
+	NzPrimitiveList MakePrimitives()
+	{
+		NzPrimitiveList primitives;
+		primitives.AddBox(NzVector3f(1.f), NzVector3ui(3));
+		primitives.AddCubicSphere(1.f, 4);
+		primitives.AddIcoSphere(1.f, 4);
+		primitives.AddUVSphere(1.f, 32, 32);
+
+		return primitives;
+	}
+
+	NzMeshParams MakeSoftwareParams(bool optimize)
+	{
+		NzMeshParams params;
+		params.optimizeIndexBuffers = optimize;
+		params.storage = nzBufferStorage_Software;
+
+		return params;
+	}
+
+	// Sphère d'environ un demi-million de triangles pour les tests de rayon
+	NzStaticMesh* MakePickingMesh(NzMesh& mesh)
+	{
+		NzPrimitiveList primitives;
+		primitives.AddUVSphere(10.f, 512, 512);
+
+		mesh.CreateStatic();
+		mesh.BuildSubMeshes(primitives, MakeSoftwareParams(false));
+
+		return static_cast<NzStaticMesh*>(mesh.GetSubMesh(0));
+	}
+
+	// Rayons partant d'une sphère englobante vers des points proches du centre, la moitié environ manque le mesh
+	std::vector<std::pair<NzVector3f, NzVector3f>> MakePickingRays(unsigned int count)
+	{
+		std::mt19937 generator(42);
+		std::uniform_real_distribution<float> distribution(-1.f, 1.f);
+
+		std::vector<std::pair<NzVector3f, NzVector3f>> rays(count);
+		for (std::pair<NzVector3f, NzVector3f>& ray : rays)
+		{
+			NzVector3f origin(distribution(generator), distribution(generator), distribution(generator));
+			origin.Normalize();
+			origin *= 50.f;
+
+			NzVector3f target(distribution(generator), distribution(generator), distribution(generator));
+			target *= 15.f;
+
+			ray.first = origin;
+			ray.second = target - origin;
+		}
+
+		return rays;
+	}
+
+	// Foule de personnages répartis en quelques groupes jouant la même animation en phase
+	const unsigned int crowdSize = 64;
+	const unsigned int crowdGroupCount = 4;
+
+	void AnimateCrowd(BenchmarkState& state, bool shared)
+	{
+		NzMeshRef mesh = MakeSkeletalMesh();
+		NzAnimationRef animation = MakeSkeletalAnimation();
+		const NzSkeletalMesh* subMesh = static_cast<const NzSkeletalMesh*>(mesh->GetSubMesh(0));
+
+		NzAnimationInstancer instancer;
+		std::vector<NzAnimationInstancer::Instance*> instances(crowdSize, nullptr);
+		std::vector<NzSkeleton> skeletons(crowdSize, *mesh->GetSkeleton());
+		std::vector<NzMeshVertex> output(subMesh->GetVertexCount());
+
+		unsigned int frame = 0;
+		while (state.KeepRunning())
+		{
+			for (unsigned int i = 0; i < crowdSize; ++i)
+			{
+				unsigned int characterFrame = (frame + (i % crowdGroupCount)*16) % (animationFrameCount-1);
+				if (shared)
+				{
+					NzAnimationInstancer::Instance* instance = instancer.Acquire(mesh, animation, characterFrame, characterFrame+1, 0.5f);
+					if (instances[i])
+						instancer.Release(instances[i]);
+
+					instances[i] = instance;
+					DoNotOptimize(instance->GetSkinnedVertices(0));
+				}
+				else
+				{
+					animation->AnimateSkeleton(&skeletons[i], characterFrame, characterFrame+1, 0.5f);
+					subMesh->Skin(output.data(), &skeletons[i]);
+					DoNotOptimize(output);
+				}
+			}
+
+			frame = (frame+1) % (animationFrameCount-1);
+		}
+
+		for (NzAnimationInstancer::Instance* instance : instances)
+		{
+			if (instance)
+				instancer.Release(instance);
+		}
+
+		state.SetItemsProcessed(state.GetIterationCount()*crowdSize);
+	}
+}
+
+NAZARA_BENCHMARK(PixelFormat, ConvertBGR8ToRGBA8)
+{
+	Convert(state, nzPixelFormat_BGR8, nzPixelFormat_RGBA8);
+}
+
+NAZARA_BENCHMARK(PixelFormat, ConvertRGBA8ToBGRA8)
+{
+	Convert(state, nzPixelFormat_RGBA8, nzPixelFormat_BGRA8);
+}
+
+NAZARA_BENCHMARK(PixelFormat, ConvertRGBA8ToL8)
+{
+	Convert(state, nzPixelFormat_RGBA8, nzPixelFormat_L8);
+}
+
+NAZARA_BENCHMARK(PixelFormat, ConvertRGBA8ToRGB8)
+{
+	Convert(state, nzPixelFormat_RGBA8, nzPixelFormat_RGB8);
+}
+
+NAZARA_BENCHMARK(Image, FlipHorizontally)
+{
+	NzImage image;
+	image.Create(nzImageType_2D, nzPixelFormat_RGBA8, imageSize, imageSize);
+
+	while (state.KeepRunning())
+		image.FlipHorizontally();
+
+	state.SetBytesProcessed(state.GetIterationCount()*imageSize*imageSize*4);
+}
+
+NAZARA_BENCHMARK(Image, FlipVertically)
+{
+	NzImage image;
+	image.Create(nzImageType_2D, nzPixelFormat_RGBA8, imageSize, imageSize);
+
+	while (state.KeepRunning())
+		image.FlipVertically();
+
+	state.SetBytesProcessed(state.GetIterationCount()*imageSize*imageSize*4);
+}
+
+NAZARA_BENCHMARK(Image, CopyRegion)
+{
+	// Copie d'une région dans une image plus grande, comme lors de la construction d'un atlas
+	std::vector<nzUInt8> src = MakePixels(nzPixelFormat_RGBA8);
+	std::vector<nzUInt8> dst(imageSize*imageSize*4*4);
+
+	while (state.KeepRunning())
+	{
+		NzImage::Copy(dst.data(), src.data(), 4, imageSize, imageSize, 1, imageSize*2, imageSize*2);
+		DoNotOptimize(dst);
+	}
+
+	state.SetBytesProcessed(state.GetIterationCount()*src.size());
+}
+
+NAZARA_BENCHMARK(Mesh, BuildSubMeshes)
+{
+	NzPrimitiveList primitives = MakePrimitives();
+	NzMeshParams params = MakeSoftwareParams(false);
+
+	while (state.KeepRunning())
+	{
+		NzMesh mesh;
+		mesh.CreateStatic();
+		mesh.BuildSubMeshes(primitives, params);
+
+		DoNotOptimize(mesh);
+	}
+
+	state.SetItemsProcessed(state.GetIterationCount()*primitives.GetSize());
+}
+
+NAZARA_BENCHMARK(Mesh, BuildSubMeshesOptimized)
+{
+	NzPrimitiveList primitives = MakePrimitives();
+	NzMeshParams params = MakeSoftwareParams(true);
+
+	while (state.KeepRunning())
+	{
+		NzMesh mesh;
+		mesh.CreateStatic();
+		mesh.BuildSubMeshes(primitives, params);
+
+		DoNotOptimize(mesh);
+	}
+
+	state.SetItemsProcessed(state.GetIterationCount()*primitives.GetSize());
+}
+
+NAZARA_BENCHMARK(Mesh, GenerateUvSphere)
+{
+	unsigned int indexCount;
+	unsigned int vertexCount;
+	NzComputeUvSphereIndexVertexCount(64, 64, &indexCount, &vertexCount);
+
+	NzIndexBuffer indexBuffer(vertexCount > 0xFFFF, indexCount);
+	std::vector<NzMeshVertex> vertices(vertexCount);
+
+	NzIndexMapper indexMapper(&indexBuffer, nzBufferAccess_WriteOnly);
+	while (state.KeepRunning())
+	{
+		NzGenerateUvSphere(1.f, 64, 64, NzMatrix4f::Identity(), NzRectf(0.f, 0.f, 1.f, 1.f), vertices.data(), indexMapper.begin());
+		DoNotOptimize(vertices);
+	}
+
+	state.SetItemsProcessed(state.GetIterationCount()*vertexCount);
+}
+
+NAZARA_BENCHMARK(Mesh, BuildTriangleBVH)
+{
+	NzMesh mesh;
+	NzStaticMesh* subMesh = MakePickingMesh(mesh);
+
+	while (state.KeepRunning())
+	{
+		subMesh->InvalidateTriangleBVH();
+		DoNotOptimize(subMesh->GetTriangleBVH());
+	}
+
+	state.SetItemsProcessed(state.GetIterationCount()*subMesh->GetTriangleCount());
+}
+
+NAZARA_BENCHMARK(Mesh, Raycast)
+{
+	NzMesh mesh;
+	NzStaticMesh* subMesh = MakePickingMesh(mesh);
+	std::vector<std::pair<NzVector3f, NzVector3f>> rays = MakePickingRays(1024);
+
+	subMesh->GetTriangleBVH(); // Construction hors de la mesure
+
+	while (state.KeepRunning())
+	{
+		for (const std::pair<NzVector3f, NzVector3f>& ray : rays)
+		{
+			NzTriangleHit hit;
+			DoNotOptimize(subMesh->Raycast(ray.first, ray.second, 1.f, &hit));
+		}
+	}
+
+	state.SetItemsProcessed(state.GetIterationCount()*rays.size());
+}
+
+NAZARA_BENCHMARK(Mesh, RaycastAny)
+{
+	NzMesh mesh;
+	NzStaticMesh* subMesh = MakePickingMesh(mesh);
+	std::vector<std::pair<NzVector3f, NzVector3f>> rays = MakePickingRays(1024);
+
+	subMesh->GetTriangleBVH(); // Construction hors de la mesure
+
+	while (state.KeepRunning())
+	{
+		for (const std::pair<NzVector3f, NzVector3f>& ray : rays)
+			DoNotOptimize(subMesh->RaycastAny(ray.first, ray.second, 1.f));
+	}
+
+	state.SetItemsProcessed(state.GetIterationCount()*rays.size());
+}
+
+NAZARA_BENCHMARK(Mesh, OptimizeIndices)
+{
+	unsigned int indexCount;
+	unsigned int vertexCount;
+	NzComputeUvSphereIndexVertexCount(64, 64, &indexCount, &vertexCount);
+
+	NzIndexBuffer indexBuffer(vertexCount > 0xFFFF, indexCount);
+	std::vector<NzMeshVertex> vertices(vertexCount);
+
+	NzIndexMapper indexMapper(&indexBuffer, nzBufferAccess_ReadWrite);
+	NzGenerateUvSphere(1.f, 64, 64, NzMatrix4f::Identity(), NzRectf(0.f, 0.f, 1.f, 1.f), vertices.data(), indexMapper.begin());
+
+	std::vector<nzUInt32> original(indexCount);
+	for (unsigned int i = 0; i < indexCount; ++i)
+		original[i] = indexMapper.Get(i);
+
+	while (state.KeepRunning())
+	{
+		// L'optimisation est refaite à chaque fois sur les indices d'origine
+		state.PauseTiming();
+		for (unsigned int i = 0; i < indexCount; ++i)
+			indexMapper.Set(i, original[i]);
+		state.ResumeTiming();
+
+		NzOptimizeIndices(indexMapper.begin(), indexCount);
+	}
+
+	state.SetItemsProcessed(state.GetIterationCount()*indexCount/3);
+}
+
+NAZARA_BENCHMARK(Mesh, GenerateNormalsAndTangents)
+{
+	NzMesh mesh;
+	mesh.CreateStatic();
+	mesh.BuildSubMeshes(MakePrimitives(), MakeSoftwareParams(false));
+
+	while (state.KeepRunning())
+		mesh.GenerateNormalsAndTangents();
+
+	state.SetItemsProcessed(state.GetIterationCount()*mesh.GetVertexCount());
+}
+
+NAZARA_BENCHMARK(Mesh, Transform)
+{
+	NzMesh mesh;
+	mesh.CreateStatic();
+	mesh.BuildSubMeshes(MakePrimitives(), MakeSoftwareParams(false));
+
+	NzMatrix4f matrix = NzMatrix4f::Transform(NzVector3f(0.f, 0.01f, 0.f), NzEulerAnglesf(0.f, 1.f, 0.f));
+	while (state.KeepRunning())
+		mesh.Transform(matrix);
+
+	state.SetItemsProcessed(state.GetIterationCount()*mesh.GetVertexCount());
+}
+
+NAZARA_BENCHMARK(Animation, Skinning)
+{
+	NzMeshRef mesh = MakeSkeletalMesh();
+	const NzSkeletalMesh* subMesh = static_cast<const NzSkeletalMesh*>(mesh->GetSubMesh(0));
+
+	std::vector<NzMeshVertex> output(subMesh->GetVertexCount());
+	while (state.KeepRunning())
+	{
+		subMesh->Skin(output.data(), mesh->GetSkeleton());
+		DoNotOptimize(output);
+	}
+
+	state.SetItemsProcessed(state.GetIterationCount()*output.size());
+}
+
+NAZARA_BENCHMARK(Animation, Compress)
+{
+	while (state.KeepRunning())
+	{
+		state.PauseTiming();
+		NzAnimationRef animation = MakeSkeletalAnimation();
+		state.ResumeTiming();
+
+		if (!animation->Compress())
+		{
+			state.Skip("Failed to compress animation");
+			break;
+		}
+
+		DoNotOptimize(animation);
+	}
+
+	state.SetItemsProcessed(state.GetIterationCount()*animationFrameCount*jointCount);
+}
+
+NAZARA_BENCHMARK(Animation, Sample)
+{
+	SampleAnimation(state, false);
+}
+
+NAZARA_BENCHMARK(Animation, SampleCompressed)
+{
+	SampleAnimation(state, true);
+}
+
+NAZARA_BENCHMARK(Animation, BlendPoses)
+{
+	// Fondu entre deux animations, plus une couche masquée sur la seconde moitié des joints et une couche additive
+	NzAnimationRef animation = MakeSkeletalAnimation();
+
+	NzSkeletalPosePool pool(jointCount);
+	NzSkeletalPose additivePose(&pool);
+	NzSkeletalPose layerPose(&pool);
+	NzSkeletalPose poseA(&pool);
+	NzSkeletalPose poseB(&pool);
+
+	animation->AnimatePose(&poseA, 0, 0, 0.f);
+	animation->AnimatePose(&poseB, 30, 30, 0.f);
+	additivePose.MakeAdditive(poseB, poseA);
+
+	std::vector<float> mask(jointCount);
+	for (unsigned int i = 0; i < jointCount; ++i)
+		mask[i] = (i >= jointCount/2) ? 1.f : 0.f;
+
+	NzSkeleton skeleton;
+	skeleton.Create(jointCount);
+
+	unsigned int frame = 0;
+	while (state.KeepRunning())
+	{
+		NzSkeletalPose pose(&pool);
+		animation->AnimatePose(&poseA, frame, frame+1, 0.5f);
+		animation->AnimatePose(&poseB, animationFrameCount-2 - frame, animationFrameCount-1 - frame, 0.5f);
+		animation->AnimatePose(&layerPose, (frame*2) % (animationFrameCount-1), (frame*2) % (animationFrameCount-1) + 1, 0.5f);
+
+		pose.Blend(poseA, poseB, 0.3f);
+		pose.Blend(pose, layerPose, 1.f, mask.data());
+		pose.AddAdditive(additivePose, 0.5f);
+		pose.Apply(&skeleton);
+
+		DoNotOptimize(skeleton);
+
+		frame = (frame+1) % (animationFrameCount-2);
+	}
+
+	state.SetItemsProcessed(state.GetIterationCount()*jointCount);
+}
+
+NAZARA_BENCHMARK(Animation, BlendSkeletons)
+{
+	// Même fondu entre deux animations en passant par des squelettes complets (Sans couches)
+	NzAnimationRef animation = MakeSkeletalAnimation();
+
+	NzSkeleton skeleton;
+	skeleton.Create(jointCount);
+
+	NzSkeleton skeletonA(skeleton);
+	NzSkeleton skeletonB(skeleton);
+
+	unsigned int frame = 0;
+	while (state.KeepRunning())
+	{
+		animation->AnimateSkeleton(&skeletonA, frame, frame+1, 0.5f);
+		animation->AnimateSkeleton(&skeletonB, animationFrameCount-2 - frame, animationFrameCount-1 - frame, 0.5f);
+		skeleton.Interpolate(skeletonA, skeletonB, 0.3f);
+
+		DoNotOptimize(skeleton);
+
+		frame = (frame+1) % (animationFrameCount-2);
+	}
+
+	state.SetItemsProcessed(state.GetIterationCount()*jointCount);
+}
+
+NAZARA_BENCHMARK(Animation, Crowd)
+{
+	AnimateCrowd(state, false);
+}
+
+NAZARA_BENCHMARK(Animation, CrowdInstanced)
+{
+	AnimateCrowd(state, true);
+}
+
+NAZARA_BENCHMARK(Parser, MD5Mesh)
+{
+	NzString source = MakeMD5Mesh();
+	NzMeshParams params = MakeSoftwareParams(false);
+
+	while (state.KeepRunning())
+	{
+		NzMesh mesh;
+		if (!mesh.LoadFromMemory(source.GetConstBuffer(), source.GetSize(), params))
+		{
+			state.Skip("Failed to load generated MD5 mesh");
+			break;
+		}
+
+		DoNotOptimize(mesh);
+	}
+
+	state.SetBytesProcessed(state.GetIterationCount()*source.GetSize());
+}
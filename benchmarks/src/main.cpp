@@ -0,0 +1,101 @@
+/*
+** Benchmarks - Mesure des performances des chemins critiques du moteur
+** Prérequis: Aucun
+** Utilisation du noyau et des modules utilitaire, de bruit et graphique (Sans contexte de rendu par défaut)
+** Options:
+** --filter=<texte>  N'exécute que les benchmarks dont le nom (groupe/nom) contient le texte
+** --json=<fichier>  Écrit les résultats au format JSON, pour le suivi des performances par l'intégration continue
+** --min-time=<s>    Durée minimale d'un échantillon (0.05 par défaut)
+** --renderer        Initialise le module graphique (Et donc un contexte OpenGL), pour les benchmarks en ayant besoin
+** --samples=<n>     Nombre d'échantillons par benchmark (5 par défaut)
+*/
+
+#include <Nazara/Core/Initializer.hpp>
+#include <Nazara/Graphics/Graphics.hpp>
+#include <Nazara/Utility/Utility.hpp>
+#include "Benchmark.hpp"
+#include <algorithm>
+#include <cstdlib>
+#include <cstring>
+#include <iostream>
+#include <memory>
+
+namespace
+{
+	bool ParseOption(const char* argument, const char* option, std::string* value)
+	{
+		std::size_t length = std::strlen(option);
+		if (std::strncmp(argument, option, length) != 0 || argument[length] != '=')
+			return false;
+
+		*value = &argument[length+1];
+		return true;
+	}
+}
+
+int main(int argc, char* argv[])
+{
+	BenchmarkRunner::Parameters parameters;
+	std::string jsonPath;
+	bool useRenderer = false;
+
+	for (int i = 1; i < argc; ++i)
+	{
+		std::string value;
+		if (ParseOption(argv[i], "--filter", &value))
+			parameters.filter = value;
+		else if (ParseOption(argv[i], "--json", &value))
+			jsonPath = value;
+		else if (ParseOption(argv[i], "--min-time", &value))
+			parameters.minSampleTime = std::max(std::atof(value.c_str()), 0.001);
+		else if (std::strcmp(argv[i], "--renderer") == 0)
+			useRenderer = true;
+		else if (ParseOption(argv[i], "--samples", &value))
+			parameters.sampleCount = std::max(std::atoi(value.c_str()), 1);
+		else
+		{
+			std::cerr << "Unknown option: " << argv[i] << std::endl;
+			std::cerr << "Usage: " << argv[0] << " [--filter=<text>] [--json=<file>] [--min-time=<seconds>] [--renderer] [--samples=<count>]" << std::endl;
+			return EXIT_FAILURE;
+		}
+	}
+
+	// Par défaut, le module graphique n'est pas initialisé afin de pouvoir tourner sur une machine sans affichage
+	// les benchmarks ayant besoin d'un contexte sont alors ignorés
+	NzInitializer<NzUtility> utility;
+	if (!utility)
+	{
+		std::cerr << "Failed to initialize Utility module" << std::endl;
+		return EXIT_FAILURE;
+	}
+
+	std::unique_ptr<NzInitializer<NzGraphics>> graphics;
+	if (useRenderer)
+	{
+		graphics.reset(new NzInitializer<NzGraphics>);
+		if (!*graphics)
+		{
+			std::cerr << "Failed to initialize Graphics module" << std::endl;
+			return EXIT_FAILURE;
+		}
+	}
+
+	std::vector<BenchmarkResult> results = BenchmarkRunner::Run(parameters);
+	if (results.empty())
+	{
+		std::cerr << "No benchmark matches the filter" << std::endl;
+		return EXIT_FAILURE;
+	}
+
+	WriteConsoleReport(results);
+
+	if (!jsonPath.empty())
+	{
+		if (!WriteJsonReport(results, jsonPath))
+			return EXIT_FAILURE;
+
+		std::cout << "Results written to " << jsonPath << std::endl;
+	}
+
+	return EXIT_SUCCESS;
+}
@@ -13,6 +13,11 @@ newoption {
 	description = "Builds the extern libraries"
 }
 
+newoption {
+	trigger     = "with-benchmarks",
+	description = "Builds the benchmarks"
+}
+
 newoption {
 	trigger     = "with-examples",
 	description = "Builds the examples"
@@ -89,3 +94,12 @@ if (_OPTIONS["with-examples"]) then
 		end
 	end
 end
+
+if (_OPTIONS["with-benchmarks"]) then
+	solution "NazaraBenchmarks"
+	loadfile("scripts/common_benchmarks.lua")()
+
+	project "NazaraBenchmarks"
+	dofile("../benchmarks/build.lua")
+	configuration {} -- Désactivation du filtre
+end
@@ -0,0 +1,44 @@
+newoption {
+	trigger     = "benchmark-filter",
+	value       = "TEXT",
+	description = "Only runs the benchmarks whose name contains this text"
+}
+
+newoption {
+	trigger     = "benchmark-json",
+	value       = "FILE",
+	description = "Output file of the benchmarks results, relative to benchmarks/bin (default: results.json)"
+}
+
+function runBenchmarks()
+	local executable = "../benchmarks/bin/NazaraBenchmarks"
+	if (os.is("windows")) then
+		executable = executable .. ".exe"
+	end
+
+	if (not os.isfile(executable)) then
+		error("Benchmark executable not found (" .. executable .. "), generate the project with --with-benchmarks and build it first")
+	end
+
+	local jsonPath = _OPTIONS["benchmark-json"] or "results.json"
+	local command = 'cd ../benchmarks/bin && "' .. path.translate(path.getabsolute(executable)) .. '" --json=' .. jsonPath
+	if (_OPTIONS["benchmark-filter"]) then
+		command = command .. " --filter=" .. _OPTIONS["benchmark-filter"]
+	end
+
+	print("Running benchmarks ...")
+	local startTime = os.time()
+
+	if (os.execute(command) ~= 0) then
+		error("Benchmarks failed")
+	end
+
+	print("Finished (took " .. os.difftime(os.time(), startTime) .. "s, results: " .. jsonPath .. ")")
+end
+
+newaction
+{
+	trigger     = "benchmarks",
+	description = "Run the benchmarks and write their results as JSON",
+	execute     = runBenchmarks
+}
@@ -32,6 +32,15 @@
 // Duplique la sortie du log sur le flux de sortie standard (cout)
 #define NAZARA_CORE_DUPLICATE_LOG_TO_COUT 0
 
+// Nombre de lignes que peut contenir la file du log asynchrone (Arrondi à la puissance de deux supérieure)
+#define NAZARA_CORE_LOG_ASYNC_CAPACITY 1024
+
+// Intervalle entre deux écritures groupées du log asynchrone (En millisecondes)
+#define NAZARA_CORE_LOG_ASYNC_INTERVAL 10
+
+// Taille maximale d'une ligne du log asynchrone, les lignes plus longues sont tronquées (En octets)
+#define NAZARA_CORE_LOG_ASYNC_LINESIZE 512
+
 // Teste les assertions
 #define NAZARA_CORE_ENABLE_ASSERTS 0
 
@@ -47,6 +56,15 @@
 // Utilise un tracker pour repérer les éventuels leaks (Ralentit l'exécution)
 #define NAZARA_CORE_MEMORYLEAKTRACKER 0
 
+// Taux d'échantillonnage initial du tracker de leaks (0: suivi exact avec un verrou global, N: suivi par thread sans verrou d'un bloc sur N)
+#define NAZARA_CORE_MEMORYLEAKTRACKER_SAMPLING 0
+
+// Active les compteurs de performance (NzPerformanceCounters), les incrémentations sont sinon retirées à la compilation
+#define NAZARA_CORE_PERFORMANCECOUNTERS 1
+
+// Active le profileur (NzProfiler), les zones sont sinon entièrement retirées à la compilation
+#define NAZARA_CORE_PROFILER 0
+
 // Précision des réels lors de la transformation en texte (Max. chiffres après la virgule)
 #define NAZARA_CORE_REAL_PRECISION 6
 
@@ -64,6 +82,7 @@
 #define NAZARA_THREADSAFETY_HASHDIGEST 0   // NzHashDigest
 #define NAZARA_THREADSAFETY_LOG 1          // NzLog
 #define NAZARA_THREADSAFETY_RESOURCE 1     // NzResource
+#define NAZARA_THREADSAFETY_RESOURCEMANAGER 1 // NzResourceManager
 #define NAZARA_THREADSAFETY_STRINGSTREAM 0 // NzStringStream
 
 // Le nombre de spinlocks à utiliser avec les critical sections de Windows (0 pour désactiver)
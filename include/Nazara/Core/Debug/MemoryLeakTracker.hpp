@@ -14,13 +14,30 @@
 class NAZARA_API NzMemoryManager
 {
 	public:
+		struct FileUsage
+		{
+			const char* file;
+			nzUInt64 allocationCount; // Depuis le lancement
+			std::size_t currentSize;
+			std::size_t peakSize;
+		};
+
 		NzMemoryManager();
 		~NzMemoryManager();
 
 		static void* Allocate(std::size_t size, bool multi, const char* file = nullptr, unsigned int line = 0);
 		static void Free(void* pointer, bool multi);
+
+		static std::size_t GetAllocatedSize();
+		static nzUInt64 GetAllocationCount();
+		static unsigned int GetFileUsage(FileUsage* usages, unsigned int maxCount);
+		static std::size_t GetModuleAllocatedSize(const char* module);
+		static unsigned int GetSamplingRate();
+
 		static void NextFree(const char* file, unsigned int line);
 
+		static void SetSamplingRate(unsigned int samplingRate);
+
 	private:
 		static void Initialize();
 		static char* TimeInfo();
@@ -57,7 +57,23 @@ enum nzHash
 	nzHash_SHA256,
 	nzHash_SHA384,
 	nzHash_SHA512,
-	nzHash_Whirlpool
+	nzHash_Whirlpool,
+	nzHash_XXH64
+};
+
+enum nzPerformanceCounter
+{
+	nzPerformanceCounter_BufferMaps,
+	nzPerformanceCounter_CulledNodes,
+	nzPerformanceCounter_DrawCalls,
+	nzPerformanceCounter_DrawnInstances,
+	nzPerformanceCounter_ProgramBinds,
+	nzPerformanceCounter_SkinnedVertices,
+	nzPerformanceCounter_StateUpdates,
+	nzPerformanceCounter_TextureBinds,
+	nzPerformanceCounter_VisibleNodes,
+
+	nzPerformanceCounter_Max = nzPerformanceCounter_VisibleNodes
 };
 
 enum nzPlugin
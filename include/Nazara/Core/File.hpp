@@ -81,6 +81,7 @@ class NAZARA_API NzFile : public NzHashable, public NzInputStream, NzNonCopyable
 
 		std::size_t Read(void* buffer, std::size_t size);
 		std::size_t Read(void* buffer, std::size_t typeSize, unsigned int count);
+		std::size_t ReadAt(void* buffer, std::size_t size, nzUInt64 offset);
 		bool Rename(const NzString& newFilePath);
 
 		bool SetCursorPos(CursorPosition pos, nzInt64 offset = 0);
@@ -115,7 +116,11 @@ class NAZARA_API NzFile : public NzHashable, public NzInputStream, NzNonCopyable
 	private:
 		bool FillHash(NzAbstractHash* hash) const;
 
-		NazaraMutexAttrib(m_mutex, mutable)
+		// Versions sans verrou de Close et Open, l'appelant doit déjà posséder le verrou en écriture
+		void CloseFile();
+		bool OpenFile(unsigned long openMode);
+
+		NazaraRWMutexAttrib(m_mutex, mutable)
 
 		nzEndianness m_endianness;
 		NzString m_filePath;
@@ -0,0 +1,57 @@
+// Copyright (C) 2014 Jérôme Leclercq
+// This file is part of the "Nazara Engine - Core module"
+// For conditions of distribution and use, see copyright notice in Config.hpp
+
+#pragma once
+
+#ifndef NAZARA_FILETREEHASH_HPP
+#define NAZARA_FILETREEHASH_HPP
+
+#include <Nazara/Prerequesites.hpp>
+#include <Nazara/Core/Enums.hpp>
+#include <Nazara/Core/HashDigest.hpp>
+#include <Nazara/Core/String.hpp>
+#include <ctime>
+#include <vector>
+
+// Hash d'un fichier découpé en morceaux de taille fixe, hashés en parallèle puis combinés en un hash racine
+// Le résultat diffère donc de NzFile::GetHash, même avec le même algorithme
+class NAZARA_API NzFileTreeHash
+{
+	public:
+		NzFileTreeHash(nzHash hash = nzHash_XXH64, unsigned int chunkSize = 4*1024*1024);
+		~NzFileTreeHash() = default;
+
+		void Clear();
+
+		bool Compute(const NzString& filePath);
+
+		unsigned int GetChunkCount() const;
+		const NzHashDigest& GetChunkDigest(unsigned int chunk) const;
+		unsigned int GetChunkSize() const;
+		const NzString& GetFilePath() const;
+		nzUInt64 GetFileSize() const;
+		const NzHashDigest& GetRootDigest() const;
+
+		void Invalidate(nzUInt64 offset, nzUInt64 size);
+
+		bool IsUpToDate() const;
+		bool IsValid() const;
+
+		bool Update(unsigned int* rehashedChunkCount = nullptr);
+
+	private:
+		bool HashChunks(const std::vector<unsigned int>& chunks);
+		void UpdateRoot();
+
+		std::vector<bool> m_invalidatedChunks;
+		std::vector<NzHashDigest> m_chunkDigests;
+		NzHashDigest m_rootDigest;
+		NzString m_filePath;
+		nzHash m_hash;
+		nzUInt64 m_fileSize;
+		time_t m_lastWriteTime;
+		unsigned int m_chunkSize;
+};
+
+#endif // NAZARA_FILETREEHASH_HPP
@@ -7,7 +7,9 @@
 #ifndef NAZARA_FUNCTOR_HPP
 #define NAZARA_FUNCTOR_HPP
 
+#include <Nazara/Core/MemoryPool.hpp>
 #include <Nazara/Core/Tuple.hpp>
+#include <new>
 
 // Inspiré du code de la SFML par Laurent Gomila
 
@@ -16,6 +18,31 @@ struct NzFunctor
 	virtual ~NzFunctor() {}
 
 	virtual void Run() = 0;
+
+	// Les foncteurs sont créés et détruits à chaque tâche, on les sert donc depuis les pools partagés
+	// (Définis ici car le tracker de leaks redéfinit le mot-clé new dans les fichiers .inl)
+	static void* operator new(std::size_t size)
+	{
+		void* ptr = NzMemoryPool::AllocateShared(size);
+		if (!ptr)
+			throw std::bad_alloc();
+
+		return ptr;
+	}
+
+	static void* operator new(std::size_t size, const char* file, unsigned int line)
+	{
+		NazaraUnused(file);
+		NazaraUnused(line);
+
+		return operator new(size);
+	}
+
+	// Le destructeur étant virtuel, la taille reçue est celle du type réel
+	static void operator delete(void* ptr, std::size_t size)
+	{
+		NzMemoryPool::FreeShared(ptr, size);
+	}
 };
 
 template<typename F>
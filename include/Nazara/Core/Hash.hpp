@@ -22,6 +22,8 @@ class NAZARA_API NzHash : NzNonCopyable
 
 		NzHashDigest Hash(const NzHashable& hashable);
 
+		static NzAbstractHash* Create(nzHash hash);
+
 	private:
 		NzAbstractHash* m_impl;
 };
@@ -0,0 +1,35 @@
+// Copyright (C) 2014 Jérôme Leclercq
+// This file is part of the "Nazara Engine - Core module"
+// For conditions of distribution and use, see copyright notice in Config.hpp
+
+#pragma once
+
+#ifndef NAZARA_HASH_XXH64_HPP
+#define NAZARA_HASH_XXH64_HPP
+
+#include <Nazara/Prerequesites.hpp>
+#include <Nazara/Core/AbstractHash.hpp>
+#include <Nazara/Core/HashDigest.hpp>
+#include <Nazara/Core/String.hpp>
+
+struct NzHashXXH64_state;
+
+// Hash non-cryptographique de 64 bits (xxHash64), à réserver aux caches et à la détection de changements
+class NAZARA_API NzHashXXH64 : public NzAbstractHash
+{
+	public:
+		NzHashXXH64(nzUInt64 seed = 0);
+		virtual ~NzHashXXH64();
+
+		void Append(const nzUInt8* data, unsigned int len);
+		void Begin();
+		NzHashDigest End();
+
+		static unsigned int GetDigestLength();
+		static NzString GetHashName();
+
+	private:
+		NzHashXXH64_state* m_state;
+};
+
+#endif // NAZARA_HASH_XXH64_HPP
@@ -8,9 +8,11 @@
 #define NAZARA_LOG_HPP
 
 #include <Nazara/Prerequesites.hpp>
+#include <Nazara/Core/Config.hpp>
 #include <Nazara/Core/Error.hpp>
 #include <Nazara/Core/NonCopyable.hpp>
 #include <Nazara/Core/String.hpp>
+#include <atomic>
 
 #if NAZARA_CORE_THREADSAFE && NAZARA_THREADSAFETY_LOG
 #include <Nazara/Core/ThreadSafety.hpp>
@@ -28,16 +30,22 @@
 #define NazaraNotice(txt) NazaraLog->Write(txt)
 
 class NzFile;
+struct NzLogAsyncQueue;
 
 class NAZARA_API NzLog : NzNonCopyable
 {
 	public:
 		void Enable(bool enable);
 		void EnableAppend(bool enable);
+		void EnableAsync(bool enable, unsigned int capacity = NAZARA_CORE_LOG_ASYNC_CAPACITY);
 		void EnableDateTime(bool enable);
 
+		void Flush();
+
+		nzUInt64 GetDroppedCount() const;
 		NzString GetFile() const;
 
+		bool IsAsync() const;
 		bool IsEnabled() const;
 
 		void SetFile(const NzString& filePath);
@@ -52,13 +60,22 @@ class NAZARA_API NzLog : NzNonCopyable
 		NzLog();
 		~NzLog();
 
-		NazaraMutexAttrib(m_mutex, mutable)
+		unsigned int FormatTime(char* buffer) const;
+		void WriteToFile(const char* string, unsigned int size);
+
+		static void AsyncWriterProc(NzLog* log, NzLogAsyncQueue* queue);
+
+		NazaraRWMutexAttrib(m_mutex, mutable)
 
 		NzString m_filePath;
 		NzFile* m_file;
+		NzLogAsyncQueue* m_asyncQueue;
+		std::atomic<NzLogAsyncQueue*> m_asyncProducerQueue;
+		std::atomic<unsigned int> m_asyncProducerCount;
+		std::atomic<nzUInt64> m_droppedCount;
+		std::atomic_bool m_enabled;
+		std::atomic_bool m_writeTime;
 		bool m_append;
-		bool m_enabled;
-		bool m_writeTime;
 };
 
 #endif // NAZARA_LOGGER_HPP
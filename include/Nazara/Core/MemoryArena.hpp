@@ -0,0 +1,90 @@
+// Copyright (C) 2014 Jérôme Leclercq
+// This file is part of the "Nazara Engine - Core module"
+// For conditions of distribution and use, see copyright notice in Config.hpp
+
+#pragma once
+
+#ifndef NAZARA_MEMORYARENA_HPP
+#define NAZARA_MEMORYARENA_HPP
+
+#include <Nazara/Prerequesites.hpp>
+#include <Nazara/Core/NonCopyable.hpp>
+#include <cstddef>
+
+// Allocateur linéaire : les allocations ne sont jamais libérées individuellement, mais toutes en même temps par Reset
+// Destiné aux données temporaires (D'une frame par exemple), il n'est pas protégé des accès concurrentiels
+class NAZARA_API NzMemoryArena : NzNonCopyable
+{
+	public:
+		NzMemoryArena(std::size_t pageSize = 64*1024);
+		~NzMemoryArena();
+
+		void* Allocate(std::size_t size, std::size_t alignment = 16);
+		template<typename T> T* AllocateArray(std::size_t count);
+
+		std::size_t GetAllocatedSize() const;
+		std::size_t GetCapacity() const;
+		unsigned int GetPageCount() const;
+		std::size_t GetPageSize() const;
+
+		void Release();
+		void Reset();
+
+		static NzMemoryArena& GetThreadArena();
+
+	private:
+		bool AllocatePage(std::size_t minSize);
+
+		struct Page;
+
+		Page* m_pages;
+		nzUInt8* m_cursor;
+		nzUInt8* m_end;
+		std::size_t m_allocatedSize;
+		std::size_t m_capacity;
+		std::size_t m_pageSize;
+		unsigned int m_pageCount;
+};
+
+// Allocateur STL puisant dans une arène, la mémoire n'est rendue qu'à la réinitialisation de celle-ci
+template<typename T>
+class NzArenaAllocator
+{
+	template<typename U> friend class NzArenaAllocator;
+
+	public:
+		using value_type = T;
+		using pointer = T*;
+		using const_pointer = const T*;
+		using reference = T&;
+		using const_reference = const T&;
+		using size_type = std::size_t;
+		using difference_type = std::ptrdiff_t;
+
+		template<typename U>
+		struct rebind
+		{
+			using other = NzArenaAllocator<U>;
+		};
+
+		NzArenaAllocator();
+		NzArenaAllocator(NzMemoryArena* arena);
+		template<typename U> NzArenaAllocator(const NzArenaAllocator<U>& allocator);
+
+		T* allocate(std::size_t count, const void* hint = nullptr);
+		void deallocate(T* ptr, std::size_t count);
+
+		NzMemoryArena* GetArena() const;
+
+		std::size_t max_size() const;
+
+	private:
+		NzMemoryArena* m_arena;
+};
+
+template<typename T, typename U> bool operator==(const NzArenaAllocator<T>& lhs, const NzArenaAllocator<U>& rhs);
+template<typename T, typename U> bool operator!=(const NzArenaAllocator<T>& lhs, const NzArenaAllocator<U>& rhs);
+
+#include <Nazara/Core/MemoryArena.inl>
+
+#endif // NAZARA_MEMORYARENA_HPP
@@ -0,0 +1,79 @@
+// Copyright (C) 2014 Jérôme Leclercq
+// This file is part of the "Nazara Engine - Core module"
+// For conditions of distribution and use, see copyright notice in Config.hpp
+
+#include <limits>
+#include <new>
+#include <Nazara/Core/Debug.hpp>
+
+template<typename T>
+T* NzMemoryArena::AllocateArray(std::size_t count)
+{
+	// Aucun constructeur n'est appelé, réservé aux types triviaux
+	return static_cast<T*>(Allocate(count*sizeof(T), alignof(T)));
+}
+
+template<typename T>
+NzArenaAllocator<T>::NzArenaAllocator() :
+m_arena(&NzMemoryArena::GetThreadArena())
+{
+}
+
+template<typename T>
+NzArenaAllocator<T>::NzArenaAllocator(NzMemoryArena* arena) :
+m_arena(arena)
+{
+}
+
+template<typename T>
+template<typename U>
+NzArenaAllocator<T>::NzArenaAllocator(const NzArenaAllocator<U>& allocator) :
+m_arena(allocator.m_arena)
+{
+}
+
+template<typename T>
+T* NzArenaAllocator<T>::allocate(std::size_t count, const void* hint)
+{
+	NazaraUnused(hint);
+
+	T* ptr = m_arena->AllocateArray<T>(count);
+	if (!ptr)
+		throw std::bad_alloc();
+
+	return ptr;
+}
+
+template<typename T>
+void NzArenaAllocator<T>::deallocate(T* ptr, std::size_t count)
+{
+	// La mémoire sera récupérée lors du prochain NzMemoryArena::Reset
+	NazaraUnused(ptr);
+	NazaraUnused(count);
+}
+
+template<typename T>
+NzMemoryArena* NzArenaAllocator<T>::GetArena() const
+{
+	return m_arena;
+}
+
+template<typename T>
+std::size_t NzArenaAllocator<T>::max_size() const
+{
+	return std::numeric_limits<std::size_t>::max()/sizeof(T);
+}
+
+template<typename T, typename U>
+bool operator==(const NzArenaAllocator<T>& lhs, const NzArenaAllocator<U>& rhs)
+{
+	return lhs.GetArena() == rhs.GetArena();
+}
+
+template<typename T, typename U>
+bool operator!=(const NzArenaAllocator<T>& lhs, const NzArenaAllocator<U>& rhs)
+{
+	return !operator==(lhs, rhs);
+}
+
+#include <Nazara/Core/DebugOff.hpp>
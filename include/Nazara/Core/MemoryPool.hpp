@@ -0,0 +1,87 @@
+// Copyright (C) 2014 Jérôme Leclercq
+// This file is part of the "Nazara Engine - Core module"
+// For conditions of distribution and use, see copyright notice in Config.hpp
+
+#pragma once
+
+#ifndef NAZARA_MEMORYPOOL_HPP
+#define NAZARA_MEMORYPOOL_HPP
+
+#include <Nazara/Prerequesites.hpp>
+#include <Nazara/Core/Mutex.hpp>
+#include <Nazara/Core/NonCopyable.hpp>
+#include <atomic>
+#include <cstddef>
+
+// Pool de blocs de taille fixe, l'allocation et la libération sont sans verrou (Seul l'agrandissement en prend un)
+// Les blocs sont alignés sur la plus grande puissance de deux divisant leur taille (Au maximum 16 octets)
+class NAZARA_API NzMemoryPool : NzNonCopyable
+{
+	public:
+		NzMemoryPool(unsigned int blockSize, unsigned int blocksPerChunk = 64);
+		~NzMemoryPool();
+
+		void* Allocate();
+
+		void Free(void* ptr);
+
+		unsigned int GetAllocatedBlockCount() const;
+		unsigned int GetBlockSize() const;
+		unsigned int GetCapacity() const;
+		unsigned int GetChunkCount() const;
+
+		static void* AllocateShared(std::size_t size);
+		static void FreeShared(void* ptr, std::size_t size);
+		static NzMemoryPool* GetSharedPool(std::size_t size);
+
+		static const unsigned int MaxChunkCount = 24;
+		static const unsigned int SharedGranularity = 16;
+		static const unsigned int SharedMaxSize = 256; // Au-delà, les allocations partagées sont déléguées à l'opérateur new
+
+	private:
+		nzUInt8* GetBlock(nzUInt32 index) const;
+		bool Grow();
+
+		NzMutex m_growMutex;
+		std::atomic<nzUInt8*> m_chunks[MaxChunkCount];
+		std::atomic<nzUInt64> m_freeHead; // Compteur anti-ABA sur les 32 bits de poids fort, index du bloc + 1 sur les autres
+		std::atomic_uint m_allocatedBlockCount;
+		std::atomic_uint m_chunkCount;
+		unsigned int m_blockSize;
+		unsigned int m_blocksPerChunk;
+};
+
+// Allocateur STL servant les éléments individuels (Noeuds de std::map, std::list, ...) depuis les pools partagés
+template<typename T>
+class NzPoolAllocator
+{
+	public:
+		using value_type = T;
+		using pointer = T*;
+		using const_pointer = const T*;
+		using reference = T&;
+		using const_reference = const T&;
+		using size_type = std::size_t;
+		using difference_type = std::ptrdiff_t;
+
+		template<typename U>
+		struct rebind
+		{
+			using other = NzPoolAllocator<U>;
+		};
+
+		NzPoolAllocator() = default;
+		template<typename U> NzPoolAllocator(const NzPoolAllocator<U>& allocator);
+
+		T* allocate(std::size_t count, const void* hint = nullptr);
+		void deallocate(T* ptr, std::size_t count);
+
+		std::size_t max_size() const;
+};
+
+template<typename T, typename U> bool operator==(const NzPoolAllocator<T>& lhs, const NzPoolAllocator<U>& rhs);
+template<typename T, typename U> bool operator!=(const NzPoolAllocator<T>& lhs, const NzPoolAllocator<U>& rhs);
+
+#include <Nazara/Core/MemoryPool.inl>
+
+#endif // NAZARA_MEMORYPOOL_HPP
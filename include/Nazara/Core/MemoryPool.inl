@@ -0,0 +1,56 @@
+// Copyright (C) 2014 Jérôme Leclercq
+// This file is part of the "Nazara Engine - Core module"
+// For conditions of distribution and use, see copyright notice in Config.hpp
+
+#include <limits>
+#include <new>
+#include <Nazara/Core/Debug.hpp>
+
+template<typename T>
+template<typename U>
+NzPoolAllocator<T>::NzPoolAllocator(const NzPoolAllocator<U>& allocator)
+{
+	NazaraUnused(allocator);
+}
+
+template<typename T>
+T* NzPoolAllocator<T>::allocate(std::size_t count, const void* hint)
+{
+	NazaraUnused(hint);
+
+	void* ptr = NzMemoryPool::AllocateShared(count*sizeof(T));
+	if (!ptr)
+		throw std::bad_alloc();
+
+	return static_cast<T*>(ptr);
+}
+
+template<typename T>
+void NzPoolAllocator<T>::deallocate(T* ptr, std::size_t count)
+{
+	NzMemoryPool::FreeShared(ptr, count*sizeof(T));
+}
+
+template<typename T>
+std::size_t NzPoolAllocator<T>::max_size() const
+{
+	return std::numeric_limits<std::size_t>::max()/sizeof(T);
+}
+
+template<typename T, typename U>
+bool operator==(const NzPoolAllocator<T>& lhs, const NzPoolAllocator<U>& rhs)
+{
+	NazaraUnused(lhs);
+	NazaraUnused(rhs);
+
+	// Les pools sont partagés, n'importe quelle instance peut donc libérer la mémoire d'une autre
+	return true;
+}
+
+template<typename T, typename U>
+bool operator!=(const NzPoolAllocator<T>& lhs, const NzPoolAllocator<U>& rhs)
+{
+	return !operator==(lhs, rhs);
+}
+
+#include <Nazara/Core/DebugOff.hpp>
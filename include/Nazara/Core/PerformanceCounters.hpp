@@ -0,0 +1,46 @@
+// Copyright (C) 2014 Jérôme Leclercq
+// This file is part of the "Nazara Engine - Core module"
+// For conditions of distribution and use, see copyright notice in Config.hpp
+
+#pragma once
+
+#ifndef NAZARA_PERFORMANCECOUNTERS_HPP
+#define NAZARA_PERFORMANCECOUNTERS_HPP
+
+#include <Nazara/Prerequesites.hpp>
+#include <Nazara/Core/Config.hpp>
+#include <Nazara/Core/Enums.hpp>
+
+#if NAZARA_CORE_PERFORMANCECOUNTERS
+	#define NazaraCount(counter, value) NzPerformanceCounters::Add(counter, value);
+#else
+	#define NazaraCount(counter, value)
+#endif
+
+struct NzFrameStatistics
+{
+	nzUInt64 counters[nzPerformanceCounter_Max+1];
+	nzUInt64 frameIndex;
+	nzUInt64 frameTime; // En microsecondes
+};
+
+// Chaque thread incrémente ses propres compteurs, sans verrou ni opération atomique coûteuse
+// Les valeurs de tous les threads sont additionnées à la fin de chaque frame
+class NAZARA_API NzPerformanceCounters
+{
+	public:
+		NzPerformanceCounters() = delete;
+		~NzPerformanceCounters() = delete;
+
+		static void Add(nzPerformanceCounter counter, nzUInt64 value = 1);
+
+		static void EndFrame();
+
+		static NzFrameStatistics GetFrameStatistics();
+		static const char* GetName(nzPerformanceCounter counter);
+		static nzUInt64 GetTotal(nzPerformanceCounter counter);
+
+		static void Reset();
+};
+
+#endif // NAZARA_PERFORMANCECOUNTERS_HPP
@@ -0,0 +1,59 @@
+// Copyright (C) 2014 Jérôme Leclercq
+// This file is part of the "Nazara Engine - Core module"
+// For conditions of distribution and use, see copyright notice in Config.hpp
+
+#pragma once
+
+#ifndef NAZARA_PROFILER_HPP
+#define NAZARA_PROFILER_HPP
+
+#include <Nazara/Prerequesites.hpp>
+#include <Nazara/Core/Config.hpp>
+#include <Nazara/Core/String.hpp>
+
+#if NAZARA_CORE_PROFILER
+	#define NazaraProfile(name) NzProfilerZone profilerZone(name);
+	#define NazaraNamedProfile(name, zone) NzProfilerZone profilerZone_##zone(name);
+#else
+	#define NazaraProfile(name)
+	#define NazaraNamedProfile(name, zone)
+#endif
+
+// Chaque thread enregistre ses zones dans son propre tampon, sans verrou
+// Les noms de zones ne sont pas copiés et doivent donc survivre au profileur (Chaînes littérales)
+class NAZARA_API NzProfiler
+{
+	public:
+		NzProfiler() = delete;
+		~NzProfiler() = delete;
+
+		static void Clear();
+
+		static bool ExportChromeTrace(const NzString& filePath);
+		static NzString ExportChromeTrace();
+
+		static unsigned int GetEventCount();
+
+		static bool IsEnabled();
+
+		static void RecordZone(const char* name, nzUInt64 start, nzUInt64 end);
+
+		static void SetEnabled(bool enabled);
+		static void SetThreadName(const NzString& name);
+};
+
+class NAZARA_API NzProfilerZone
+{
+	public:
+		NzProfilerZone(const char* name);
+		NzProfilerZone(const NzProfilerZone&) = delete;
+		~NzProfilerZone();
+
+		NzProfilerZone& operator=(const NzProfilerZone&) = delete;
+
+	private:
+		const char* m_name;
+		nzUInt64 m_start;
+};
+
+#endif // NAZARA_PROFILER_HPP
@@ -0,0 +1,34 @@
+// Copyright (C) 2014 Jérôme Leclercq
+// This file is part of the "Nazara Engine - Core module"
+// For conditions of distribution and use, see copyright notice in Config.hpp
+
+#pragma once
+
+#ifndef NAZARA_RWLOCKGUARD_HPP
+#define NAZARA_RWLOCKGUARD_HPP
+
+#include <Nazara/Prerequesites.hpp>
+
+class NzRWMutex;
+
+class NAZARA_API NzReadLockGuard
+{
+	public:
+		NzReadLockGuard(NzRWMutex& mutex);
+		~NzReadLockGuard();
+
+	private:
+		NzRWMutex& m_mutex;
+};
+
+class NAZARA_API NzWriteLockGuard
+{
+	public:
+		NzWriteLockGuard(NzRWMutex& mutex);
+		~NzWriteLockGuard();
+
+	private:
+		NzRWMutex& m_mutex;
+};
+
+#endif // NAZARA_RWLOCKGUARD_HPP
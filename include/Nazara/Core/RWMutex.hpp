@@ -0,0 +1,36 @@
+// Copyright (C) 2014 Jérôme Leclercq
+// This file is part of the "Nazara Engine - Core module"
+// For conditions of distribution and use, see copyright notice in Config.hpp
+
+#pragma once
+
+#ifndef NAZARA_RWMUTEX_HPP
+#define NAZARA_RWMUTEX_HPP
+
+#include <Nazara/Prerequesites.hpp>
+#include <Nazara/Core/NonCopyable.hpp>
+
+class NzRWMutexImpl;
+
+// Verrou lecteurs/écrivain: plusieurs threads peuvent lire simultanément, l'écriture reste exclusive
+// Contrairement à NzMutex sous Windows, ce verrou n'est pas récursif
+class NAZARA_API NzRWMutex : NzNonCopyable
+{
+	public:
+		NzRWMutex();
+		~NzRWMutex();
+
+		void LockRead();
+		void LockWrite();
+
+		bool TryLockRead();
+		bool TryLockWrite();
+
+		void UnlockRead();
+		void UnlockWrite();
+
+	private:
+		NzRWMutexImpl* m_impl;
+};
+
+#endif // NAZARA_RWMUTEX_HPP
@@ -8,14 +8,9 @@
 #define NAZARA_RESOURCE_HPP
 
 #include <Nazara/Prerequesites.hpp>
+#include <Nazara/Core/Spinlock.hpp>
 #include <atomic>
-#include <unordered_map>
-
-#if NAZARA_CORE_THREADSAFE && NAZARA_THREADSAFETY_RESOURCE
-#include <Nazara/Core/ThreadSafety.hpp>
-#else
-#include <Nazara/Core/ThreadSafetyOff.hpp>
-#endif
+#include <vector>
 
 class NzResourceListener;
 
@@ -42,17 +37,27 @@ class NAZARA_API NzResource
 		void NotifyDestroy();
 
 	private:
-		typedef std::unordered_map<NzResourceListener*, std::pair<int, unsigned int>> ResourceListenerMap;
-
-		void RemoveResourceListenerIterator(ResourceListenerMap::iterator iterator) const;
-
-		NazaraMutexAttrib(m_mutex, mutable)
+		struct ResourceListenerEntry
+		{
+			NzResourceListener* listener;
+			int index;
+			unsigned int referenceCount;
+		};
+
+		// Une ressource n'a que rarement plus d'une poignée de listeners, un simple tableau parcouru linéairement
+		// est donc bien plus rapide qu'une table de hachage, et ne réalloue pas lorsqu'un listener est retiré puis remis
+		typedef std::vector<ResourceListenerEntry> ResourceListenerContainer;
+
+		void LockResourceListeners() const;
+		void NotifyResourceListeners(bool (NzResourceListener::*callback)(const NzResource*, int));
+		void RemoveResourceListenerEntry(unsigned int entryIndex, bool notifying) const;
+		void UnlockResourceListeners() const;
 
 		// Je fais précéder le nom par 'resource' pour éviter les éventuels conflits de noms
-		mutable ResourceListenerMap m_resourceListeners;
+		mutable ResourceListenerContainer m_resourceListeners;
+		mutable NzSpinlock m_resourceListenersSpinlock;
 		        std::atomic_bool m_resourcePersistent;
 		mutable std::atomic_uint m_resourceReferenceCount;
-		        bool m_resourceListenersLocked;
 };
 
 #endif // NAZARA_RESOURCE_HPP
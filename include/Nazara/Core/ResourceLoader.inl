@@ -7,6 +7,7 @@
 #include <Nazara/Core/File.hpp>
 #include <Nazara/Core/InputStream.hpp>
 #include <Nazara/Core/MemoryStream.hpp>
+#include <Nazara/Core/Profiler.hpp>
 #include <Nazara/Core/Debug.hpp>
 
 template<typename Type, typename Parameters>
@@ -26,6 +27,8 @@ bool NzResourceLoader<Type, Parameters>::IsExtensionSupported(const NzString& ex
 template<typename Type, typename Parameters>
 bool NzResourceLoader<Type, Parameters>::LoadFromFile(Type* resource, const NzString& filePath, const Parameters& parameters)
 {
+	NazaraProfile("NzResourceLoader::LoadFromFile")
+
 	#if NAZARA_CORE_SAFE
 	if (!parameters.IsValid())
 	{
@@ -125,6 +128,8 @@ bool NzResourceLoader<Type, Parameters>::LoadFromMemory(Type* resource, const vo
 template<typename Type, typename Parameters>
 bool NzResourceLoader<Type, Parameters>::LoadFromStream(Type* resource, NzInputStream& stream, const Parameters& parameters)
 {
+	NazaraProfile("NzResourceLoader::LoadFromStream")
+
 	#if NAZARA_CORE_SAFE
 	if (!parameters.IsValid())
 	{
@@ -0,0 +1,89 @@
+// Copyright (C) 2014 Jérôme Leclercq
+// This file is part of the "Nazara Engine - Core module"
+// For conditions of distribution and use, see copyright notice in Config.hpp
+
+#pragma once
+
+#ifndef NAZARA_RESOURCEMANAGER_HPP
+#define NAZARA_RESOURCEMANAGER_HPP
+
+#include <Nazara/Prerequesites.hpp>
+#include <Nazara/Core/NonCopyable.hpp>
+#include <Nazara/Core/ResourceRef.hpp>
+#include <Nazara/Core/String.hpp>
+#include <list>
+#include <unordered_map>
+#include <vector>
+
+#if NAZARA_CORE_THREADSAFE && NAZARA_THREADSAFETY_RESOURCEMANAGER
+#include <Nazara/Core/ThreadSafety.hpp>
+#else
+#include <Nazara/Core/ThreadSafetyOff.hpp>
+#endif
+
+template<typename Type, typename Parameters>
+class NzResourceManager : NzNonCopyable
+{
+	public:
+		using SizeGetter = nzUInt64 (*)(const Type* resource);
+
+		NzResourceManager(nzUInt64 memoryBudget = 0, SizeGetter sizeGetter = nullptr);
+		~NzResourceManager();
+
+		void Clear();
+
+		NzResourceRef<Type> Get(const NzString& filePath, const Parameters& parameters = Parameters());
+
+		unsigned int GetEntryCount() const;
+		nzUInt64 GetEvictionCount() const;
+		nzUInt64 GetHitCount() const;
+		nzUInt64 GetMemoryBudget() const;
+		nzUInt64 GetMemoryUsage() const;
+		nzUInt64 GetMissCount() const;
+
+		bool IsCached(const NzString& filePath, const Parameters& parameters = Parameters()) const;
+
+		unsigned int Purge();
+
+		void Register(const NzString& filePath, Type* resource, const Parameters& parameters = Parameters());
+
+		void ResetStats();
+
+		void SetMemoryBudget(nzUInt64 memoryBudget);
+
+		void Unregister(const NzString& filePath);
+		void Unregister(const NzString& filePath, const Parameters& parameters);
+
+	private:
+		struct Entry
+		{
+			NzString path;
+			NzResourceRef<Type> resource;
+			Parameters parameters;
+			nzUInt64 size;
+		};
+
+		using EntryList = std::list<Entry>;
+		using EntryMap = std::unordered_map<NzString, std::vector<typename EntryList::iterator>>;
+
+		typename EntryList::iterator Find(const NzString& path, const Parameters& parameters) const;
+		void EnforceBudget();
+		void Insert(const NzString& path, Type* resource, const Parameters& parameters);
+		void RemoveEntry(typename EntryList::iterator it);
+
+		NazaraMutexAttrib(m_mutex, mutable)
+
+		// Les entrées sont triées de la plus récemment utilisée à la plus anciennement utilisée
+		mutable EntryList m_entries;
+		EntryMap m_entryMap;
+		SizeGetter m_sizeGetter;
+		nzUInt64 m_evictionCount;
+		nzUInt64 m_hitCount;
+		nzUInt64 m_memoryBudget;
+		nzUInt64 m_memoryUsage;
+		nzUInt64 m_missCount;
+};
+
+#include <Nazara/Core/ResourceManager.inl>
+
+#endif // NAZARA_RESOURCEMANAGER_HPP
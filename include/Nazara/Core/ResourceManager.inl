@@ -0,0 +1,326 @@
+// Copyright (C) 2014 Jérôme Leclercq
+// This file is part of the "Nazara Engine - Core module"
+// For conditions of distribution and use, see copyright notice in Config.hpp
+
+#include <Nazara/Core/Config.hpp>
+#include <Nazara/Core/Error.hpp>
+#include <Nazara/Core/File.hpp>
+#include <memory>
+
+// File.hpp a pu sélectionner les macros de verrouillage selon NAZARA_THREADSAFETY_FILE
+#if NAZARA_CORE_THREADSAFE && NAZARA_THREADSAFETY_RESOURCEMANAGER
+#include <Nazara/Core/ThreadSafety.hpp>
+#else
+#include <Nazara/Core/ThreadSafetyOff.hpp>
+#endif
+
+#include <Nazara/Core/Debug.hpp>
+
+template<typename Type, typename Parameters>
+NzResourceManager<Type, Parameters>::NzResourceManager(nzUInt64 memoryBudget, SizeGetter sizeGetter) :
+m_sizeGetter(sizeGetter),
+m_evictionCount(0),
+m_hitCount(0),
+m_memoryBudget(memoryBudget),
+m_memoryUsage(0),
+m_missCount(0)
+{
+}
+
+template<typename Type, typename Parameters>
+NzResourceManager<Type, Parameters>::~NzResourceManager()
+{
+	Clear();
+}
+
+template<typename Type, typename Parameters>
+void NzResourceManager<Type, Parameters>::Clear()
+{
+	NazaraLock(m_mutex)
+
+	// Les ressources encore référencées ailleurs survivent, les autres sont libérées
+	m_entryMap.clear();
+	m_entries.clear();
+	m_memoryUsage = 0;
+}
+
+template<typename Type, typename Parameters>
+NzResourceRef<Type> NzResourceManager<Type, Parameters>::Get(const NzString& filePath, const Parameters& parameters)
+{
+	NzString path = NzFile::NormalizePath(filePath);
+
+	NazaraMutexLock(m_mutex)
+
+	auto it = Find(path, parameters);
+	if (it != m_entries.end())
+	{
+		m_hitCount++;
+		m_entries.splice(m_entries.begin(), m_entries, it);
+
+		NzResourceRef<Type> ref = it->resource;
+		NazaraMutexUnlock(m_mutex)
+
+		return ref;
+	}
+
+	m_missCount++;
+
+	// On ne garde pas le verrou pendant le chargement pour ne pas bloquer les autres threads
+	NazaraMutexUnlock(m_mutex)
+
+	std::unique_ptr<Type> resource(new Type);
+	if (!resource->LoadFromFile(path, parameters))
+	{
+		NazaraError("Failed to load resource from file \"" + path + '"');
+		return NzResourceRef<Type>();
+	}
+
+	resource->SetPersistent(false);
+
+	NazaraLock(m_mutex)
+
+	// Un autre thread a pu charger la même ressource entre temps, on garde alors la sienne
+	it = Find(path, parameters);
+	if (it != m_entries.end())
+	{
+		// La requête est servie par le cache, l'échec compté plus haut devient donc un succès
+		m_hitCount++;
+		m_missCount--;
+
+		m_entries.splice(m_entries.begin(), m_entries, it);
+		return it->resource;
+	}
+
+	Type* ptr = resource.release();
+	Insert(path, ptr, parameters);
+
+	// La référence doit être prise avant l'application du budget, pour ne pas être éjectée immédiatement
+	NzResourceRef<Type> ref(ptr);
+	EnforceBudget();
+
+	return ref;
+}
+
+template<typename Type, typename Parameters>
+unsigned int NzResourceManager<Type, Parameters>::GetEntryCount() const
+{
+	NazaraLock(m_mutex)
+
+	return m_entries.size();
+}
+
+template<typename Type, typename Parameters>
+nzUInt64 NzResourceManager<Type, Parameters>::GetEvictionCount() const
+{
+	NazaraLock(m_mutex)
+
+	return m_evictionCount;
+}
+
+template<typename Type, typename Parameters>
+nzUInt64 NzResourceManager<Type, Parameters>::GetHitCount() const
+{
+	NazaraLock(m_mutex)
+
+	return m_hitCount;
+}
+
+template<typename Type, typename Parameters>
+nzUInt64 NzResourceManager<Type, Parameters>::GetMemoryBudget() const
+{
+	NazaraLock(m_mutex)
+
+	return m_memoryBudget;
+}
+
+template<typename Type, typename Parameters>
+nzUInt64 NzResourceManager<Type, Parameters>::GetMemoryUsage() const
+{
+	NazaraLock(m_mutex)
+
+	return m_memoryUsage;
+}
+
+template<typename Type, typename Parameters>
+nzUInt64 NzResourceManager<Type, Parameters>::GetMissCount() const
+{
+	NazaraLock(m_mutex)
+
+	return m_missCount;
+}
+
+template<typename Type, typename Parameters>
+bool NzResourceManager<Type, Parameters>::IsCached(const NzString& filePath, const Parameters& parameters) const
+{
+	NzString path = NzFile::NormalizePath(filePath);
+
+	NazaraLock(m_mutex)
+
+	return Find(path, parameters) != m_entries.end();
+}
+
+template<typename Type, typename Parameters>
+unsigned int NzResourceManager<Type, Parameters>::Purge()
+{
+	NazaraLock(m_mutex)
+
+	unsigned int count = 0;
+	auto it = m_entries.begin();
+	while (it != m_entries.end())
+	{
+		// Seul le cache référence encore la ressource
+		if (it->resource->GetResourceReferenceCount() == 1)
+		{
+			RemoveEntry(it++);
+			count++;
+		}
+		else
+			++it;
+	}
+
+	m_evictionCount += count;
+
+	return count;
+}
+
+template<typename Type, typename Parameters>
+void NzResourceManager<Type, Parameters>::Register(const NzString& filePath, Type* resource, const Parameters& parameters)
+{
+	#if NAZARA_CORE_SAFE
+	if (!resource)
+	{
+		NazaraError("Invalid resource");
+		return;
+	}
+	#endif
+
+	NzString path = NzFile::NormalizePath(filePath);
+
+	NazaraLock(m_mutex)
+
+	auto it = Find(path, parameters);
+	if (it != m_entries.end())
+		RemoveEntry(it);
+
+	Insert(path, resource, parameters);
+	EnforceBudget();
+}
+
+template<typename Type, typename Parameters>
+void NzResourceManager<Type, Parameters>::ResetStats()
+{
+	NazaraLock(m_mutex)
+
+	m_evictionCount = 0;
+	m_hitCount = 0;
+	m_missCount = 0;
+}
+
+template<typename Type, typename Parameters>
+void NzResourceManager<Type, Parameters>::SetMemoryBudget(nzUInt64 memoryBudget)
+{
+	NazaraLock(m_mutex)
+
+	m_memoryBudget = memoryBudget;
+	EnforceBudget();
+}
+
+template<typename Type, typename Parameters>
+void NzResourceManager<Type, Parameters>::Unregister(const NzString& filePath)
+{
+	NzString path = NzFile::NormalizePath(filePath);
+
+	NazaraLock(m_mutex)
+
+	auto mapIt = m_entryMap.find(path);
+	if (mapIt == m_entryMap.end())
+		return;
+
+	// RemoveEntry modifie le vecteur, on le copie donc avant de le parcourir
+	std::vector<typename EntryList::iterator> entries = mapIt->second;
+	for (auto it : entries)
+		RemoveEntry(it);
+}
+
+template<typename Type, typename Parameters>
+void NzResourceManager<Type, Parameters>::Unregister(const NzString& filePath, const Parameters& parameters)
+{
+	NzString path = NzFile::NormalizePath(filePath);
+
+	NazaraLock(m_mutex)
+
+	auto it = Find(path, parameters);
+	if (it != m_entries.end())
+		RemoveEntry(it);
+}
+
+template<typename Type, typename Parameters>
+typename NzResourceManager<Type, Parameters>::EntryList::iterator NzResourceManager<Type, Parameters>::Find(const NzString& path, const Parameters& parameters) const
+{
+	auto mapIt = m_entryMap.find(path);
+	if (mapIt != m_entryMap.end())
+	{
+		for (auto it : mapIt->second)
+		{
+			if (it->parameters == parameters)
+				return it;
+		}
+	}
+
+	return m_entries.end();
+}
+
+template<typename Type, typename Parameters>
+void NzResourceManager<Type, Parameters>::EnforceBudget()
+{
+	if (m_memoryBudget == 0)
+		return;
+
+	// On parcourt les entrées depuis la moins récemment utilisée, en ne libérant que celles que seul le cache référence
+	auto it = m_entries.end();
+	while (m_memoryUsage > m_memoryBudget && it != m_entries.begin())
+	{
+		--it;
+		if (it->resource->GetResourceReferenceCount() == 1)
+		{
+			RemoveEntry(it++);
+			m_evictionCount++;
+		}
+	}
+}
+
+template<typename Type, typename Parameters>
+void NzResourceManager<Type, Parameters>::Insert(const NzString& path, Type* resource, const Parameters& parameters)
+{
+	nzUInt64 size = (m_sizeGetter) ? m_sizeGetter(resource) : 1;
+
+	m_entries.push_front(Entry{path, resource, parameters, size});
+	m_entryMap[path].push_back(m_entries.begin());
+	m_memoryUsage += size;
+}
+
+template<typename Type, typename Parameters>
+void NzResourceManager<Type, Parameters>::RemoveEntry(typename EntryList::iterator it)
+{
+	auto mapIt = m_entryMap.find(it->path);
+	if (mapIt != m_entryMap.end())
+	{
+		auto& entries = mapIt->second;
+		for (auto entryIt = entries.begin(); entryIt != entries.end(); ++entryIt)
+		{
+			if (*entryIt == it)
+			{
+				entries.erase(entryIt);
+				break;
+			}
+		}
+
+		if (entries.empty())
+			m_entryMap.erase(mapIt);
+	}
+
+	m_memoryUsage -= it->size;
+	m_entries.erase(it);
+}
+
+#include <Nazara/Core/DebugOff.hpp>
@@ -0,0 +1,47 @@
+// Copyright (C) 2014 Jérôme Leclercq
+// This file is part of the "Nazara Engine - Core module"
+// For conditions of distribution and use, see copyright notice in Config.hpp
+
+#pragma once
+
+#ifndef NAZARA_SIMD_HPP
+#define NAZARA_SIMD_HPP
+
+#include <Nazara/Prerequesites.hpp>
+
+// Le SSE2 n'est utilisé que si le compilateur l'autorise (Toujours le cas en x64)
+#if defined(__SSE2__) || defined(_M_X64) || (defined(_M_IX86_FP) && _M_IX86_FP >= 2)
+	#define NAZARA_SIMD_SSE2 1
+	#include <emmintrin.h>
+#else
+	#define NAZARA_SIMD_SSE2 0
+#endif
+
+// Table des noyaux de calcul utilisés par les spécialisations float de NzMatrix4
+// Les pointeurs désignent les versions scalaires jusqu'à l'appel de Enable (Fait par NzCore::Initialize)
+// Les opérations plus légères (Transformation d'un vecteur, produit de quaternions) coûteraient davantage en appel
+// indirect qu'elles ne gagnent, elles utilisent donc directement le SSE lorsque NAZARA_SIMD_SSE2 est actif
+// Les matrices sont stockées ligne par ligne (m11, m12, ...), la destination peut être l'une des sources
+// Les transformations en lot lisent des vecteurs de trois flottants espacés de stride octets (ou trois tableaux pour
+// la version SoA), la translation n'est appliquée que pour des positions et les vecteurs nuls ne sont pas normalisés
+// ComputeAABB étend les bornes minimum/maximum (qui doivent donc être initialisées) par un ensemble de positions
+class NAZARA_API NzSimd
+{
+	public:
+		NzSimd() = delete;
+		~NzSimd() = delete;
+
+		static bool Enable(bool enable);
+
+		static bool IsEnabled();
+		static bool IsSupported();
+
+		static void (*ComputeAABB)(const void* positions, unsigned int stride, unsigned int count, float* minimum, float* maximum);
+		static void (*Matrix4Concatenate)(const float* left, const float* right, float* result);
+		static void (*Matrix4ConcatenateAffine)(const float* left, const float* right, float* result);
+		static void (*Matrix4InverseAffine)(const float* matrix, float determinant, float* result);
+		static void (*TransformVectors)(const float* matrix, const void* input, unsigned int inputStride, void* output, unsigned int outputStride, unsigned int count, bool translate, bool normalize);
+		static void (*TransformVectorsSoA)(const float* matrix, const float* inputX, const float* inputY, const float* inputZ, float* outputX, float* outputY, float* outputZ, unsigned int count, bool translate, bool normalize);
+};
+
+#endif // NAZARA_SIMD_HPP
@@ -0,0 +1,46 @@
+// Copyright (C) 2014 Jérôme Leclercq
+// This file is part of the "Nazara Engine - Core module"
+// For conditions of distribution and use, see copyright notice in Config.hpp
+
+#pragma once
+
+#ifndef NAZARA_SPINLOCK_HPP
+#define NAZARA_SPINLOCK_HPP
+
+#include <Nazara/Prerequesites.hpp>
+#include <Nazara/Core/NonCopyable.hpp>
+#include <atomic>
+
+// Verrou actif adaptatif, destiné aux sections critiques très courtes (quelques instructions)
+// Le thread attend activement pendant un temps limité, puis cède son temps processeur tant que le verrou est pris
+class NzSpinlock : NzNonCopyable
+{
+	public:
+		NzSpinlock();
+		~NzSpinlock() = default;
+
+		void Lock();
+		bool TryLock();
+		void Unlock();
+
+	private:
+		static void Pause();
+
+		static const unsigned int MaxSpinCount = 64;
+
+		std::atomic_bool m_locked;
+};
+
+class NzSpinlockGuard
+{
+	public:
+		NzSpinlockGuard(NzSpinlock& spinlock);
+		~NzSpinlockGuard();
+
+	private:
+		NzSpinlock& m_spinlock;
+};
+
+#include <Nazara/Core/Spinlock.inl>
+
+#endif // NAZARA_SPINLOCK_HPP
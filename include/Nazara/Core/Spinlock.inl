@@ -0,0 +1,69 @@
+// Copyright (C) 2014 Jérôme Leclercq
+// This file is part of the "Nazara Engine - Core module"
+// For conditions of distribution and use, see copyright notice in Config.hpp
+
+#include <thread>
+
+#if defined(__i386__) || defined(__x86_64__) || defined(_M_IX86) || defined(_M_X64)
+	#include <xmmintrin.h>
+	#define NAZARA_SPINLOCK_PAUSE() _mm_pause()
+#else
+	#define NAZARA_SPINLOCK_PAUSE()
+#endif
+
+#include <Nazara/Core/Debug.hpp>
+
+inline NzSpinlock::NzSpinlock() :
+m_locked(false)
+{
+}
+
+inline void NzSpinlock::Lock()
+{
+	unsigned int spinCount = 0;
+	while (m_locked.exchange(true, std::memory_order_acquire))
+	{
+		// On attend sur une simple lecture pour ne pas monopoliser la ligne de cache pendant que le verrou est pris
+		while (m_locked.load(std::memory_order_relaxed))
+		{
+			if (spinCount < MaxSpinCount)
+			{
+				Pause();
+				spinCount++;
+			}
+			else
+				std::this_thread::yield();
+		}
+	}
+}
+
+inline bool NzSpinlock::TryLock()
+{
+	return !m_locked.load(std::memory_order_relaxed) && !m_locked.exchange(true, std::memory_order_acquire);
+}
+
+inline void NzSpinlock::Unlock()
+{
+	m_locked.store(false, std::memory_order_release);
+}
+
+inline void NzSpinlock::Pause()
+{
+	// Indique au processeur une boucle d'attente active (économise de l'énergie et libère l'autre hyper-thread)
+	NAZARA_SPINLOCK_PAUSE();
+}
+
+inline NzSpinlockGuard::NzSpinlockGuard(NzSpinlock& spinlock) :
+m_spinlock(spinlock)
+{
+	m_spinlock.Lock();
+}
+
+inline NzSpinlockGuard::~NzSpinlockGuard()
+{
+	m_spinlock.Unlock();
+}
+
+#undef NAZARA_SPINLOCK_PAUSE
+
+#include <Nazara/Core/DebugOff.hpp>
@@ -319,11 +319,19 @@ class NAZARA_API NzString : public NzHashable
 		static const unsigned int npos;
 
 	private:
+		// Capacité du buffer interne, les chaînes plus courtes n'allouent rien et ne sont jamais partagées
+		static const unsigned int LocalCapacity = 15;
+
+		char* AllocateBuffer(unsigned int capacity);
 		void EnsureOwnership(bool discardContent = false);
 		bool FillHash(NzAbstractHash* hash) const;
+		bool IsLocal() const;
+		void MoveFrom(NzString& string);
 		void ReleaseString();
 
 		SharedString* m_sharedString;
+		SharedString m_localString;
+		char m_localBuffer[LocalCapacity+1];
 };
 
 namespace std
@@ -0,0 +1,97 @@
+// Copyright (C) 2014 Jérôme Leclercq
+// This file is part of the "Nazara Engine - Core module"
+// For conditions of distribution and use, see copyright notice in Config.hpp
+
+#pragma once
+
+#ifndef NAZARA_STRINGVIEW_HPP
+#define NAZARA_STRINGVIEW_HPP
+
+#include <Nazara/Prerequesites.hpp>
+#include <Nazara/Core/String.hpp>
+#include <vector>
+
+// Une vue ne possède pas les caractères qu'elle référence, la chaîne source doit donc lui survivre
+class NAZARA_API NzStringView
+{
+	public:
+		NzStringView();
+		NzStringView(const char* string);
+		NzStringView(const char* string, unsigned int size);
+		NzStringView(const NzString& string);
+		NzStringView(const NzStringView& view) = default;
+		~NzStringView() = default;
+
+		bool EndsWith(const NzStringView& string, nzUInt32 flags = NzString::None) const;
+
+		unsigned int Find(char character, unsigned int start = 0) const;
+		unsigned int Find(const NzStringView& string, unsigned int start = 0) const;
+		unsigned int FindAny(const char* characters, unsigned int start = 0) const;
+
+		const char* GetConstBuffer() const;
+		unsigned int GetSize() const;
+		NzStringView GetWord(unsigned int index) const;
+
+		bool IsEmpty() const;
+
+		unsigned int Split(std::vector<NzStringView>& result, char separation = ' ') const;
+		unsigned int SplitAny(std::vector<NzStringView>& result, const char* separations) const;
+
+		bool StartsWith(const NzStringView& string, nzUInt32 flags = NzString::None) const;
+
+		NzStringView SubString(int startPos, int endPos = -1) const;
+
+		bool ToDouble(double* value) const;
+		bool ToFloat(float* value) const;
+		bool ToInteger(long long* value, nzUInt8 radix = 10) const;
+		NzString ToString() const;
+
+		NzStringView Trimmed() const;
+
+		// Méthodes STD
+		const char* begin() const;
+		const char* end() const;
+		// Méthodes STD
+
+		NzStringView& operator=(const NzStringView& view) = default;
+
+		char operator[](unsigned int pos) const;
+
+		bool operator==(const NzStringView& view) const;
+		bool operator!=(const NzStringView& view) const;
+
+		static const unsigned int npos;
+
+	private:
+		const char* m_string;
+		unsigned int m_size;
+};
+
+class NAZARA_API NzStringTokenizer
+{
+	public:
+		NzStringTokenizer(const NzStringView& string, const char* separators = " \t\r\n", bool keepEmpty = false);
+		~NzStringTokenizer() = default;
+
+		bool GetNext(NzStringView* token);
+		NzStringView GetRemaining() const;
+
+		bool IsFinished() const;
+
+		void Reset();
+
+		static NzStringTokenizer Lines(const NzStringView& string);
+		static NzStringTokenizer Words(const NzStringView& string);
+
+	private:
+		NzStringView m_string;
+		const char* m_separators;
+		unsigned int m_position;
+		bool m_finished;
+		bool m_keepEmpty;
+		bool m_trimCarriageReturn;
+};
+
+#include <Nazara/Core/StringView.inl>
+
+#endif // NAZARA_STRINGVIEW_HPP
@@ -0,0 +1,82 @@
+// Copyright (C) 2014 Jérôme Leclercq
+// This file is part of the "Nazara Engine - Core module"
+// For conditions of distribution and use, see copyright notice in Config.hpp
+
+#include <Nazara/Core/Config.hpp>
+#include <Nazara/Core/Error.hpp>
+#include <cstring>
+#include <Nazara/Core/Debug.hpp>
+
+inline NzStringView::NzStringView() :
+m_string(nullptr),
+m_size(0)
+{
+}
+
+inline NzStringView::NzStringView(const char* string) :
+m_string(string),
+m_size((string) ? std::strlen(string) : 0)
+{
+}
+
+inline NzStringView::NzStringView(const char* string, unsigned int size) :
+m_string(string),
+m_size(size)
+{
+}
+
+inline NzStringView::NzStringView(const NzString& string) :
+m_string(string.GetConstBuffer()),
+m_size(string.GetSize())
+{
+}
+
+inline const char* NzStringView::GetConstBuffer() const
+{
+	return m_string;
+}
+
+inline unsigned int NzStringView::GetSize() const
+{
+	return m_size;
+}
+
+inline bool NzStringView::IsEmpty() const
+{
+	return m_size == 0;
+}
+
+inline const char* NzStringView::begin() const
+{
+	return m_string;
+}
+
+inline const char* NzStringView::end() const
+{
+	return m_string + m_size;
+}
+
+inline char NzStringView::operator[](unsigned int pos) const
+{
+	#if NAZARA_CORE_SAFE
+	if (pos >= m_size)
+	{
+		NazaraError("Index out of range (" + NzString::Number(pos) + " >= " + NzString::Number(m_size) + ')');
+		return '\0';
+	}
+	#endif
+
+	return m_string[pos];
+}
+
+inline bool NzStringView::operator==(const NzStringView& view) const
+{
+	return m_size == view.m_size && (m_size == 0 || std::memcmp(m_string, view.m_string, m_size) == 0);
+}
+
+inline bool NzStringView::operator!=(const NzStringView& view) const
+{
+	return !operator==(view);
+}
+
+#include <Nazara/Core/DebugOff.hpp>
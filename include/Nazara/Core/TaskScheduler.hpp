@@ -21,6 +21,7 @@ class NAZARA_API NzTaskScheduler
 		template<typename C> static void AddTask(void (C::*function)(), C* object);
 		static unsigned int GetWorkerCount();
 		static bool Initialize();
+		static bool IsInitialized();
 		static void Run();
 		static void SetWorkerCount(unsigned int workerCount);
 		static void Uninitialize();
@@ -6,6 +6,8 @@
 
 #include <Nazara/Core/LockGuard.hpp>
 #include <Nazara/Core/Mutex.hpp>
+#include <Nazara/Core/RWLockGuard.hpp>
+#include <Nazara/Core/RWMutex.hpp>
 
 // Ces macros peuvent changer pour n'importe quel fichier qui l'utilise dans une même unité de compilation
 #undef NazaraLock
@@ -14,6 +16,9 @@
 #undef NazaraMutexLock
 #undef NazaraMutexUnlock
 #undef NazaraNamedLock
+#undef NazaraReadLock
+#undef NazaraRWMutexAttrib
+#undef NazaraWriteLock
 
 #define NazaraLock(mutex) NzLockGuard lock_mutex(mutex);
 #define NazaraMutex(name) NzMutex name;
@@ -21,3 +26,8 @@
 #define NazaraMutexLock(mutex) mutex.Lock();
 #define NazaraMutexUnlock(mutex) mutex.Unlock();
 #define NazaraNamedLock(mutex, name) NzLockGuard lock_##name(mutex);
+
+// Variante lecteurs/écrivain: les accesseurs constants se contentent d'un verrou partagé
+#define NazaraReadLock(mutex) NzReadLockGuard lock_mutex(mutex);
+#define NazaraRWMutexAttrib(name, attribute) attribute NzRWMutex name;
+#define NazaraWriteLock(mutex) NzWriteLockGuard lock_mutex(mutex);
@@ -11,6 +11,9 @@
 #undef NazaraMutexLock
 #undef NazaraMutexUnlock
 #undef NazaraNamedLock
+#undef NazaraReadLock
+#undef NazaraRWMutexAttrib
+#undef NazaraWriteLock
 
 #define NazaraLock(mutex)
 #define NazaraMutex(name)
@@ -18,4 +21,7 @@
 #define NazaraMutexLock(mutex)
 #define NazaraMutexUnlock(mutex)
 #define NazaraNamedLock(mutex, name)
+#define NazaraReadLock(mutex)
+#define NazaraRWMutexAttrib(name, attribute)
+#define NazaraWriteLock(mutex)
 
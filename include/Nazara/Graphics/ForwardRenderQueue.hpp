@@ -9,10 +9,12 @@
 
 #include <Nazara/Prerequesites.hpp>
 #include <Nazara/Core/Color.hpp>
+#include <Nazara/Core/MemoryPool.hpp>
 #include <Nazara/Core/ResourceListener.hpp>
 #include <Nazara/Graphics/AbstractRenderQueue.hpp>
 #include <Nazara/Math/Box.hpp>
 #include <Nazara/Math/Matrix4.hpp>
+#include <functional>
 #include <map>
 #include <tuple>
 
@@ -92,10 +94,10 @@ class NAZARA_API NzForwardRenderQueue : public NzAbstractRenderQueue, NzResource
 			bool operator()(const NzStaticMesh* subMesh1, const NzStaticMesh* subMesh2);
 		};
 
-		typedef std::map<const NzSkeletalMesh*, std::vector<SkeletalData>, BatchedSkeletalMeshComparator> BatchedSkeletalMeshContainer;
-		typedef std::map<const NzStaticMesh*, std::pair<NzSpheref, std::vector<StaticData>>, BatchedStaticMeshComparator> BatchedStaticMeshContainer;
-		typedef std::map<const NzMaterial*, std::tuple<bool, bool, BatchedSkeletalMeshContainer, BatchedStaticMeshContainer>, BatchedModelMaterialComparator> BatchedModelContainer;
-		typedef std::map<const NzMaterial*, std::vector<const NzSprite*>> BatchedSpriteContainer;
+		typedef std::map<const NzSkeletalMesh*, std::vector<SkeletalData>, BatchedSkeletalMeshComparator, NzPoolAllocator<std::pair<const NzSkeletalMesh* const, std::vector<SkeletalData>>>> BatchedSkeletalMeshContainer;
+		typedef std::map<const NzStaticMesh*, std::pair<NzSpheref, std::vector<StaticData>>, BatchedStaticMeshComparator, NzPoolAllocator<std::pair<const NzStaticMesh* const, std::pair<NzSpheref, std::vector<StaticData>>>>> BatchedStaticMeshContainer;
+		typedef std::map<const NzMaterial*, std::tuple<bool, bool, BatchedSkeletalMeshContainer, BatchedStaticMeshContainer>, BatchedModelMaterialComparator, NzPoolAllocator<std::pair<const NzMaterial* const, std::tuple<bool, bool, BatchedSkeletalMeshContainer, BatchedStaticMeshContainer>>>> BatchedModelContainer;
+		typedef std::map<const NzMaterial*, std::vector<const NzSprite*>, std::less<const NzMaterial*>, NzPoolAllocator<std::pair<const NzMaterial* const, std::vector<const NzSprite*>>>> BatchedSpriteContainer;
 		typedef std::vector<const NzLight*> LightContainer;
 		typedef std::vector<std::pair<unsigned int, bool>> TransparentModelContainer;
 
@@ -13,7 +13,9 @@
 #include <Nazara/Graphics/SceneNode.hpp>
 #include <Nazara/Renderer/Material.hpp>
 #include <Nazara/Utility/Animation.hpp>
+#include <Nazara/Utility/AnimationInstancer.hpp>
 #include <Nazara/Utility/Mesh.hpp>
+#include <Nazara/Utility/SkeletalPose.hpp>
 
 struct NAZARA_API NzModelParameters
 {
@@ -43,10 +45,13 @@ class NAZARA_API NzModel : public NzSceneNode, public NzUpdatable
 
 		void AddToRenderQueue(NzAbstractRenderQueue* renderQueue) const override;
 		void AdvanceAnimation(float elapsedTime);
+		void ApplyPose(const NzSkeletalPose& pose);
 
 		void EnableAnimation(bool animation);
 
 		NzAnimation* GetAnimation() const;
+		const NzAnimationInstancer::Instance* GetAnimationInstance() const;
+		NzAnimationInstancer* GetAnimationInstancer() const;
 		const NzBoundingVolumef& GetBoundingVolume() const;
 		NzMaterial* GetMaterial(const NzString& subMeshName) const;
 		NzMaterial* GetMaterial(unsigned int matIndex) const;
@@ -74,6 +79,7 @@ class NAZARA_API NzModel : public NzSceneNode, public NzUpdatable
 		void Reset();
 
 		bool SetAnimation(NzAnimation* animation);
+		void SetAnimationInstancer(NzAnimationInstancer* animationInstancer);
 		bool SetMaterial(const NzString& subMeshName, NzMaterial* material);
 		void SetMaterial(unsigned int matIndex, NzMaterial* material);
 		bool SetMaterial(unsigned int skinIndex, const NzString& subMeshName, NzMaterial* material);
@@ -91,12 +97,15 @@ class NAZARA_API NzModel : public NzSceneNode, public NzUpdatable
 		bool FrustumCull(const NzFrustumf& frustum) override;
 		void Invalidate() override;
 		void Register() override;
+		void ReleaseAnimationInstance();
 		void Unregister() override;
 		void Update() override;
 		void UpdateBoundingVolume() const;
 
 		std::vector<NzMaterialRef> m_materials;
 		NzAnimationRef m_animation;
+		NzAnimationInstancer* m_animationInstancer;
+		NzAnimationInstancer::Instance* m_animationInstance; // Uniquement en cas de partage de l'animation
 		mutable NzBoundingVolumef m_boundingVolume;
 		NzMeshRef m_mesh;
 		NzSkeleton m_skeleton; // Uniquement pour les animations squelettiques
@@ -17,6 +17,7 @@
 
 struct lua_Debug;
 struct lua_State;
+struct NzFrameStatistics;
 
 class NzLuaInstance;
 
@@ -94,6 +95,7 @@ class NAZARA_API NzLuaInstance : NzNonCopyable
 
 		void PushBoolean(bool value);
 		void PushCFunction(NzLuaCFunction func, int upvalueCount = 0);
+		void PushFrameStatistics(const NzFrameStatistics& statistics);
 		void PushFunction(NzLuaFunction func);
 		void PushInteger(int value);
 		void PushLightUserdata(void* value);
@@ -108,6 +110,8 @@ class NAZARA_API NzLuaInstance : NzNonCopyable
 		void* PushUserdata(unsigned int size);
 		void PushValue(int index);
 
+		void RegisterPerformanceCounters();
+
 		void Remove(int index);
 		void Replace(int index);
 
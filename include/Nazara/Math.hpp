@@ -30,6 +30,8 @@
 #ifndef NAZARA_GLOBAL_MATH_HPP
 #define NAZARA_GLOBAL_MATH_HPP
 
+#include <Nazara/Math/Algorithm.hpp>
+#include <Nazara/Math/BVH.hpp>
 #include <Nazara/Math/Basic.hpp>
 #include <Nazara/Math/BoundingVolume.hpp>
 #include <Nazara/Math/Box.hpp>
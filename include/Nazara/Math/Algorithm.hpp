@@ -0,0 +1,31 @@
+// Copyright (C) 2014 Jérôme Leclercq
+// This file is part of the "Nazara Engine - Mathematics module"
+// For conditions of distribution and use, see copyright notice in Config.hpp
+
+#pragma once
+
+#ifndef NAZARA_ALGORITHM_MATH_HPP
+#define NAZARA_ALGORITHM_MATH_HPP
+
+#include <Nazara/Prerequesites.hpp>
+#include <Nazara/Math/Box.hpp>
+#include <Nazara/Math/Matrix4.hpp>
+#include <Nazara/Math/Vector3.hpp>
+
+// Transformations en lot d'un ensemble de vecteurs par une même matrice
+// Les versions AoS prennent un pas en octets entre deux vecteurs (Permettant de travailler directement sur un attribut
+// d'un tableau de sommets), les versions SoA travaillent sur trois tableaux de composantes
+// La sortie peut être l'entrée (avec le même pas), les normales et tangentes sont renormalisées
+template<typename T> NzBox<T> NzComputeAABB(const NzVector3<T>* positions, unsigned int count, unsigned int stride = sizeof(NzVector3<T>));
+template<typename T> NzMatrix4<T> NzComputeNormalMatrix(const NzMatrix4<T>& matrix);
+
+template<typename T> void NzTransformNormals(const NzMatrix4<T>& matrix, const NzVector3<T>* input, NzVector3<T>* output, unsigned int count, unsigned int inputStride = sizeof(NzVector3<T>), unsigned int outputStride = sizeof(NzVector3<T>));
+template<typename T> void NzTransformNormals(const NzMatrix4<T>& matrix, const T* inputX, const T* inputY, const T* inputZ, T* outputX, T* outputY, T* outputZ, unsigned int count);
+template<typename T> void NzTransformPositions(const NzMatrix4<T>& matrix, const NzVector3<T>* input, NzVector3<T>* output, unsigned int count, unsigned int inputStride = sizeof(NzVector3<T>), unsigned int outputStride = sizeof(NzVector3<T>));
+template<typename T> void NzTransformPositions(const NzMatrix4<T>& matrix, const T* inputX, const T* inputY, const T* inputZ, T* outputX, T* outputY, T* outputZ, unsigned int count);
+template<typename T> void NzTransformTangents(const NzMatrix4<T>& matrix, const NzVector3<T>* input, NzVector3<T>* output, unsigned int count, unsigned int inputStride = sizeof(NzVector3<T>), unsigned int outputStride = sizeof(NzVector3<T>));
+template<typename T> void NzTransformTangents(const NzMatrix4<T>& matrix, const T* inputX, const T* inputY, const T* inputZ, T* outputX, T* outputY, T* outputZ, unsigned int count);
+
+#include <Nazara/Math/Algorithm.inl>
+
+#endif // NAZARA_ALGORITHM_MATH_HPP
@@ -0,0 +1,186 @@
+// Copyright (C) 2014 Jérôme Leclercq
+// This file is part of the "Nazara Engine - Mathematics module"
+// For conditions of distribution and use, see copyright notice in Config.hpp
+
+#include <Nazara/Core/Simd.hpp>
+#include <Nazara/Math/Basic.hpp>
+#include <cmath>
+#include <Nazara/Core/Debug.hpp>
+
+#define F(a) static_cast<T>(a)
+
+template<typename T>
+NzBox<T> NzComputeAABB(const NzVector3<T>* positions, unsigned int count, unsigned int stride)
+{
+	///DOC: Renvoie une boîte nulle si aucune position n'est fournie
+	if (count == 0)
+		return NzBox<T>(F(0.0), F(0.0), F(0.0), F(0.0), F(0.0), F(0.0));
+
+	NzVector3<T> minimum(*positions);
+	NzVector3<T> maximum(*positions);
+
+	const nzUInt8* ptr = reinterpret_cast<const nzUInt8*>(positions);
+	for (unsigned int i = 1; i < count; ++i)
+	{
+		ptr += stride;
+
+		const NzVector3<T>& position = *reinterpret_cast<const NzVector3<T>*>(ptr);
+		minimum.Minimize(position);
+		maximum.Maximize(position);
+	}
+
+	return NzBox<T>(minimum, maximum);
+}
+
+template<typename T>
+NzMatrix4<T> NzComputeNormalMatrix(const NzMatrix4<T>& matrix)
+{
+	///DOC: Transposée de l'inverse de la partie 3x3, sans translation
+	if (matrix.IsIdentity())
+		return matrix;
+
+	const T* m = matrix;
+	NzVector3<T> row0(m[0], m[1], m[2]);
+	NzVector3<T> row1(m[4], m[5], m[6]);
+	NzVector3<T> row2(m[8], m[9], m[10]);
+
+	// Les lignes de la matrice des cofacteurs sont les produits vectoriels des lignes
+	NzVector3<T> cofactor0 = row1.CrossProduct(row2);
+	NzVector3<T> cofactor1 = row2.CrossProduct(row0);
+	NzVector3<T> cofactor2 = row0.CrossProduct(row1);
+
+	// Le déterminant n'influe que sur le signe et l'échelle, une matrice dégénérée garde ses cofacteurs
+	T det = row0.DotProduct(cofactor0);
+	if (!NzNumberEquals(det, F(0.0)))
+	{
+		T invDet = F(1.0) / det;
+		cofactor0 *= invDet;
+		cofactor1 *= invDet;
+		cofactor2 *= invDet;
+	}
+
+	return NzMatrix4<T>(cofactor0.x, cofactor0.y, cofactor0.z, F(0.0),
+	                    cofactor1.x, cofactor1.y, cofactor1.z, F(0.0),
+	                    cofactor2.x, cofactor2.y, cofactor2.z, F(0.0),
+	                    F(0.0),      F(0.0),      F(0.0),      F(1.0));
+}
+
+template<typename T>
+void NzTransformNormals(const NzMatrix4<T>& matrix, const NzVector3<T>* input, NzVector3<T>* output, unsigned int count, unsigned int inputStride, unsigned int outputStride)
+{
+	NzTransformTangents(NzComputeNormalMatrix(matrix), input, output, count, inputStride, outputStride);
+}
+
+template<typename T>
+void NzTransformNormals(const NzMatrix4<T>& matrix, const T* inputX, const T* inputY, const T* inputZ, T* outputX, T* outputY, T* outputZ, unsigned int count)
+{
+	NzTransformTangents(NzComputeNormalMatrix(matrix), inputX, inputY, inputZ, outputX, outputY, outputZ, count);
+}
+
+template<typename T>
+void NzTransformPositions(const NzMatrix4<T>& matrix, const NzVector3<T>* input, NzVector3<T>* output, unsigned int count, unsigned int inputStride, unsigned int outputStride)
+{
+	const nzUInt8* inputPtr = reinterpret_cast<const nzUInt8*>(input);
+	nzUInt8* outputPtr = reinterpret_cast<nzUInt8*>(output);
+
+	for (unsigned int i = 0; i < count; ++i)
+	{
+		*reinterpret_cast<NzVector3<T>*>(outputPtr) = matrix.Transform(*reinterpret_cast<const NzVector3<T>*>(inputPtr));
+
+		inputPtr += inputStride;
+		outputPtr += outputStride;
+	}
+}
+
+template<typename T>
+void NzTransformPositions(const NzMatrix4<T>& matrix, const T* inputX, const T* inputY, const T* inputZ, T* outputX, T* outputY, T* outputZ, unsigned int count)
+{
+	for (unsigned int i = 0; i < count; ++i)
+	{
+		NzVector3<T> position = matrix.Transform(NzVector3<T>(inputX[i], inputY[i], inputZ[i]));
+		outputX[i] = position.x;
+		outputY[i] = position.y;
+		outputZ[i] = position.z;
+	}
+}
+
+template<typename T>
+void NzTransformTangents(const NzMatrix4<T>& matrix, const NzVector3<T>* input, NzVector3<T>* output, unsigned int count, unsigned int inputStride, unsigned int outputStride)
+{
+	const nzUInt8* inputPtr = reinterpret_cast<const nzUInt8*>(input);
+	nzUInt8* outputPtr = reinterpret_cast<nzUInt8*>(output);
+
+	for (unsigned int i = 0; i < count; ++i)
+	{
+		NzVector3<T> tangent = matrix.Transform(*reinterpret_cast<const NzVector3<T>*>(inputPtr), F(0.0));
+
+		// Un vecteur nul le reste
+		T squaredLength = tangent.GetSquaredLength();
+		if (squaredLength > F(0.0))
+			tangent /= std::sqrt(squaredLength);
+
+		*reinterpret_cast<NzVector3<T>*>(outputPtr) = tangent;
+
+		inputPtr += inputStride;
+		outputPtr += outputStride;
+	}
+}
+
+template<typename T>
+void NzTransformTangents(const NzMatrix4<T>& matrix, const T* inputX, const T* inputY, const T* inputZ, T* outputX, T* outputY, T* outputZ, unsigned int count)
+{
+	for (unsigned int i = 0; i < count; ++i)
+	{
+		NzVector3<T> tangent = matrix.Transform(NzVector3<T>(inputX[i], inputY[i], inputZ[i]), F(0.0));
+
+		T squaredLength = tangent.GetSquaredLength();
+		if (squaredLength > F(0.0))
+			tangent /= std::sqrt(squaredLength);
+
+		outputX[i] = tangent.x;
+		outputY[i] = tangent.y;
+		outputZ[i] = tangent.z;
+	}
+}
+
+// Spécialisations float, confiées aux noyaux de NzSimd (SSE si disponible)
+template<>
+inline NzBox<float> NzComputeAABB(const NzVector3<float>* positions, unsigned int count, unsigned int stride)
+{
+	if (count == 0)
+		return NzBox<float>(0.f, 0.f, 0.f, 0.f, 0.f, 0.f);
+
+	NzVector3<float> minimum(*positions);
+	NzVector3<float> maximum(*positions);
+	NzSimd::ComputeAABB(positions, stride, count, &minimum.x, &maximum.x);
+
+	return NzBox<float>(minimum, maximum);
+}
+
+template<>
+inline void NzTransformPositions(const NzMatrix4<float>& matrix, const NzVector3<float>* input, NzVector3<float>* output, unsigned int count, unsigned int inputStride, unsigned int outputStride)
+{
+	NzSimd::TransformVectors(matrix, input, inputStride, output, outputStride, count, true, false);
+}
+
+template<>
+inline void NzTransformPositions(const NzMatrix4<float>& matrix, const float* inputX, const float* inputY, const float* inputZ, float* outputX, float* outputY, float* outputZ, unsigned int count)
+{
+	NzSimd::TransformVectorsSoA(matrix, inputX, inputY, inputZ, outputX, outputY, outputZ, count, true, false);
+}
+
+template<>
+inline void NzTransformTangents(const NzMatrix4<float>& matrix, const NzVector3<float>* input, NzVector3<float>* output, unsigned int count, unsigned int inputStride, unsigned int outputStride)
+{
+	NzSimd::TransformVectors(matrix, input, inputStride, output, outputStride, count, false, true);
+}
+
+template<>
+inline void NzTransformTangents(const NzMatrix4<float>& matrix, const float* inputX, const float* inputY, const float* inputZ, float* outputX, float* outputY, float* outputZ, unsigned int count)
+{
+	NzSimd::TransformVectorsSoA(matrix, inputX, inputY, inputZ, outputX, outputY, outputZ, count, false, true);
+}
+
+#undef F
+
+#include <Nazara/Core/DebugOff.hpp>
@@ -0,0 +1,88 @@
+// Copyright (C) 2014 Jérôme Leclercq
+// This file is part of the "Nazara Engine - Mathematics module"
+// For conditions of distribution and use, see copyright notice in Config.hpp
+
+#pragma once
+
+#ifndef NAZARA_BVH_HPP
+#define NAZARA_BVH_HPP
+
+#include <Nazara/Math/Box.hpp>
+#include <Nazara/Math/Frustum.hpp>
+#include <Nazara/Math/Sphere.hpp>
+#include <Nazara/Math/Vector3.hpp>
+#include <vector>
+
+// Hiérarchie de volumes englobants construite sur un ensemble de boîtes (Une par primitive)
+// Les primitives sont désignées par leur indice dans le tableau passé à la construction, la hiérarchie ne stocke
+// pas les boîtes elles-mêmes (Elles sont redemandées pour la mise à jour)
+// Les nœuds sont stockés dans un tableau contigu, les deux enfants d'un nœud sont toujours adjacents et placés après
+// leur parent, les primitives d'un sous-arbre sont contiguës
+// Les requêtes appellent un foncteur pour chaque primitive des feuilles touchées, le test exact reste à sa charge
+template<typename T>
+class NzBVH
+{
+	public:
+		NzBVH();
+
+		void Build(const NzBox<T>* boxes, unsigned int boxCount, unsigned int maxLeafSize = 4);
+		void BuildParallel(const NzBox<T>* boxes, unsigned int boxCount, unsigned int maxLeafSize = 4);
+
+		void Clear();
+
+		NzBox<T> GetAABB() const;
+		unsigned int GetDepth() const;
+		unsigned int GetNodeCount() const;
+		unsigned int GetPrimitiveCount() const;
+		T GetSAHCost() const;
+
+		bool IsValid() const;
+
+		template<typename F> void QueryBox(const NzBox<T>& box, F callback) const;
+		template<typename F> void QueryFrustum(const NzFrustum<T>& frustum, F callback) const;
+		template<typename F> void QuerySphere(const NzSphere<T>& sphere, F callback) const;
+
+		template<typename F> bool Raycast(const NzVector3<T>& origin, const NzVector3<T>& direction, T maxDistance, F callback, T* hitDistance = nullptr) const;
+		template<typename F> bool RaycastAny(const NzVector3<T>& origin, const NzVector3<T>& direction, T maxDistance, F callback) const;
+
+		void Refit(const NzBox<T>* boxes);
+		void Refit(const NzBox<T>* boxes, const unsigned int* primitives, unsigned int primitiveCount);
+
+		static const unsigned int MaxDepth = 64;
+
+	private:
+		struct BuildContext;
+		struct BuildPrimitive;
+		struct BuildTask;
+
+		struct Node
+		{
+			// Un nœud interne a un compte nul, first désigne alors son premier enfant
+			NzVector3<T> minimum;
+			unsigned int first;
+			NzVector3<T> maximum;
+			unsigned int count;
+		};
+
+		void BuildTree(const NzBox<T>* boxes, unsigned int boxCount, unsigned int maxLeafSize, unsigned int workerCount);
+		template<typename F> void ForEachPrimitive(unsigned int nodeIndex, F& callback) const;
+		void Finalize(unsigned int primitiveCount, unsigned int depth);
+		void RefitNode(const NzBox<T>* boxes, unsigned int nodeIndex);
+
+		static unsigned int BuildNodes(const BuildContext& context, std::vector<Node>& nodes, unsigned int rootDepth, std::vector<BuildTask>* tasks, unsigned int taskThreshold);
+		static void BuildSubtree(const BuildContext* context, BuildTask* task);
+		static bool IntersectRay(const Node& node, const NzVector3<T>& origin, const NzVector3<T>& invDirection, T maxDistance, T* distance);
+
+		std::vector<Node> m_nodes;
+		std::vector<unsigned int> m_parents;
+		std::vector<unsigned int> m_primitiveLeaves;
+		std::vector<unsigned int> m_primitives;
+		unsigned int m_depth;
+};
+
+typedef NzBVH<double> NzBVHd;
+typedef NzBVH<float> NzBVHf;
+
+#include <Nazara/Math/BVH.inl>
+
+#endif // NAZARA_BVH_HPP
@@ -0,0 +1,859 @@
+// Copyright (C) 2014 Jérôme Leclercq
+// This file is part of the "Nazara Engine - Mathematics module"
+// For conditions of distribution and use, see copyright notice in Config.hpp
+
+#include <Nazara/Core/Error.hpp>
+#include <Nazara/Core/TaskScheduler.hpp>
+#include <Nazara/Math/Config.hpp>
+#include <algorithm>
+#include <functional>
+#include <limits>
+#include <utility>
+#include <Nazara/Core/Debug.hpp>
+
+#define F(a) static_cast<T>(a)
+
+template<typename T>
+struct NzBVH<T>::BuildPrimitive
+{
+	NzVector3<T> centroid;
+	NzVector3<T> maximum;
+	NzVector3<T> minimum;
+	unsigned int index;
+};
+
+template<typename T>
+struct NzBVH<T>::BuildContext
+{
+	BuildPrimitive* primitives;
+	unsigned int maxLeafSize;
+};
+
+template<typename T>
+struct NzBVH<T>::BuildTask
+{
+	std::vector<Node> nodes;
+	unsigned int count;
+	unsigned int depth;
+	unsigned int first;
+	unsigned int node;
+};
+
+template<typename T>
+NzBVH<T>::NzBVH() :
+m_depth(0)
+{
+}
+
+template<typename T>
+void NzBVH<T>::Build(const NzBox<T>* boxes, unsigned int boxCount, unsigned int maxLeafSize)
+{
+	BuildTree(boxes, boxCount, maxLeafSize, 1);
+}
+
+template<typename T>
+void NzBVH<T>::BuildParallel(const NzBox<T>* boxes, unsigned int boxCount, unsigned int maxLeafSize)
+{
+	///DOC: Le haut de l'arbre est construit par le thread appelant, les sous-arbres restants sont répartis entre
+	///     les workers du NzTaskScheduler, le résultat est identique à celui de Build
+	unsigned int workerCount = (NzTaskScheduler::IsInitialized()) ? NzTaskScheduler::GetWorkerCount() : 1;
+	BuildTree(boxes, boxCount, maxLeafSize, (boxCount >= 4096) ? workerCount : 1);
+}
+
+template<typename T>
+void NzBVH<T>::Clear()
+{
+	m_depth = 0;
+	m_nodes.clear();
+	m_parents.clear();
+	m_primitiveLeaves.clear();
+	m_primitives.clear();
+}
+
+template<typename T>
+NzBox<T> NzBVH<T>::GetAABB() const
+{
+	if (m_nodes.empty())
+		return NzBox<T>::Zero();
+
+	return NzBox<T>(m_nodes[0].minimum, m_nodes[0].maximum);
+}
+
+template<typename T>
+unsigned int NzBVH<T>::GetDepth() const
+{
+	return m_depth;
+}
+
+template<typename T>
+unsigned int NzBVH<T>::GetNodeCount() const
+{
+	return m_nodes.size();
+}
+
+template<typename T>
+unsigned int NzBVH<T>::GetPrimitiveCount() const
+{
+	return m_primitives.size();
+}
+
+template<typename T>
+T NzBVH<T>::GetSAHCost() const
+{
+	///DOC: Coût estimé d'une requête (En tests de primitives et de nœuds), permet de décider d'une reconstruction
+	///     lorsque les mises à jour successives ont dégradé l'arbre
+	if (m_nodes.empty())
+		return F(0.0);
+
+	auto Area = [](const Node& node) -> T
+	{
+		NzVector3<T> lengths = node.maximum - node.minimum;
+		return F(2.0)*(lengths.x*lengths.y + lengths.y*lengths.z + lengths.z*lengths.x);
+	};
+
+	T rootArea = Area(m_nodes[0]);
+	if (rootArea <= F(0.0))
+		return static_cast<T>(m_nodes.size() + m_primitives.size());
+
+	T cost = F(0.0);
+	for (const Node& node : m_nodes)
+		cost += Area(node) * ((node.count > 0) ? static_cast<T>(node.count) : F(1.0));
+
+	return cost/rootArea;
+}
+
+template<typename T>
+bool NzBVH<T>::IsValid() const
+{
+	return !m_nodes.empty();
+}
+
+template<typename T>
+template<typename F>
+void NzBVH<T>::QueryBox(const NzBox<T>& box, F callback) const
+{
+	///DOC: Le foncteur reçoit l'indice de chaque primitive d'une feuille touchée par la boîte
+	if (m_nodes.empty())
+		return;
+
+	NzVector3<T> minimum = box.GetMinimum();
+	NzVector3<T> maximum = box.GetMaximum();
+
+	unsigned int stack[MaxDepth*2];
+	unsigned int stackSize = 0;
+
+	stack[stackSize++] = 0;
+	while (stackSize > 0)
+	{
+		const Node& node = m_nodes[stack[--stackSize]];
+		if (node.minimum.x > maximum.x || node.maximum.x < minimum.x ||
+		    node.minimum.y > maximum.y || node.maximum.y < minimum.y ||
+		    node.minimum.z > maximum.z || node.maximum.z < minimum.z)
+			continue;
+
+		if (node.count > 0)
+		{
+			for (unsigned int i = 0; i < node.count; ++i)
+				callback(m_primitives[node.first + i]);
+		}
+		else
+		{
+			stack[stackSize++] = node.first + 1;
+			stack[stackSize++] = node.first;
+		}
+	}
+}
+
+template<typename T>
+template<typename F>
+void NzBVH<T>::QueryFrustum(const NzFrustum<T>& frustum, F callback) const
+{
+	///DOC: Les sous-arbres entièrement contenus dans le frustum ne sont plus testés
+	if (m_nodes.empty())
+		return;
+
+	unsigned int stack[MaxDepth*2];
+	unsigned int stackSize = 0;
+
+	stack[stackSize++] = 0;
+	while (stackSize > 0)
+	{
+		unsigned int nodeIndex = stack[--stackSize];
+		const Node& node = m_nodes[nodeIndex];
+
+		switch (frustum.Intersect(NzBox<T>(node.minimum, node.maximum)))
+		{
+			case nzIntersectionSide_Inside:
+				ForEachPrimitive(nodeIndex, callback);
+				break;
+
+			case nzIntersectionSide_Intersecting:
+				if (node.count > 0)
+				{
+					for (unsigned int i = 0; i < node.count; ++i)
+						callback(m_primitives[node.first + i]);
+				}
+				else
+				{
+					stack[stackSize++] = node.first + 1;
+					stack[stackSize++] = node.first;
+				}
+				break;
+
+			case nzIntersectionSide_Outside:
+				break;
+		}
+	}
+}
+
+template<typename T>
+template<typename F>
+void NzBVH<T>::QuerySphere(const NzSphere<T>& sphere, F callback) const
+{
+	if (m_nodes.empty())
+		return;
+
+	NzVector3<T> center = sphere.GetPosition();
+	T squaredRadius = sphere.radius*sphere.radius;
+
+	unsigned int stack[MaxDepth*2];
+	unsigned int stackSize = 0;
+
+	stack[stackSize++] = 0;
+	while (stackSize > 0)
+	{
+		const Node& node = m_nodes[stack[--stackSize]];
+
+		// Distance du centre au point le plus proche de la boîte
+		NzVector3<T> offset(center.x - NzClamp(center.x, node.minimum.x, node.maximum.x),
+		                    center.y - NzClamp(center.y, node.minimum.y, node.maximum.y),
+		                    center.z - NzClamp(center.z, node.minimum.z, node.maximum.z));
+
+		if (offset.GetSquaredLength() > squaredRadius)
+			continue;
+
+		if (node.count > 0)
+		{
+			for (unsigned int i = 0; i < node.count; ++i)
+				callback(m_primitives[node.first + i]);
+		}
+		else
+		{
+			stack[stackSize++] = node.first + 1;
+			stack[stackSize++] = node.first;
+		}
+	}
+}
+
+template<typename T>
+template<typename F>
+bool NzBVH<T>::Raycast(const NzVector3<T>& origin, const NzVector3<T>& direction, T maxDistance, F callback, T* hitDistance) const
+{
+	///DOC: Recherche l'intersection la plus proche, les distances s'expriment en multiples de direction
+	///DOC: Le foncteur est appelé sous la forme bool(unsigned int primitive, T* distance), *distance valant la
+	///     distance maximale actuelle, il renvoie true et met à jour *distance s'il trouve une intersection plus proche
+	///DOC: Les nœuds sont parcourus du plus proche au plus lointain, ceux au-delà de l'intersection trouvée sont ignorés
+	if (m_nodes.empty())
+		return false;
+
+	NzVector3<T> invDirection(F(1.0)/direction.x, F(1.0)/direction.y, F(1.0)/direction.z);
+
+	std::pair<unsigned int, T> stack[MaxDepth*2];
+	unsigned int stackSize = 0;
+
+	T distance;
+	if (!IntersectRay(m_nodes[0], origin, invDirection, maxDistance, &distance))
+		return false;
+
+	bool hit = false;
+	stack[stackSize++] = std::make_pair(0U, distance);
+	while (stackSize > 0)
+	{
+		std::pair<unsigned int, T> entry = stack[--stackSize];
+		if (entry.second > maxDistance)
+			continue;
+
+		const Node& node = m_nodes[entry.first];
+		if (node.count > 0)
+		{
+			for (unsigned int i = 0; i < node.count; ++i)
+			{
+				T primitiveDistance = maxDistance;
+				if (callback(m_primitives[node.first + i], &primitiveDistance) && primitiveDistance <= maxDistance)
+				{
+					maxDistance = primitiveDistance;
+					hit = true;
+				}
+			}
+		}
+		else
+		{
+			unsigned int left = node.first;
+			unsigned int right = node.first + 1;
+
+			T leftDistance, rightDistance;
+			bool leftHit = IntersectRay(m_nodes[left], origin, invDirection, maxDistance, &leftDistance);
+			bool rightHit = IntersectRay(m_nodes[right], origin, invDirection, maxDistance, &rightDistance);
+
+			// Le plus proche est empilé en dernier pour être traité en premier
+			if (leftHit && rightHit)
+			{
+				if (leftDistance <= rightDistance)
+				{
+					stack[stackSize++] = std::make_pair(right, rightDistance);
+					stack[stackSize++] = std::make_pair(left, leftDistance);
+				}
+				else
+				{
+					stack[stackSize++] = std::make_pair(left, leftDistance);
+					stack[stackSize++] = std::make_pair(right, rightDistance);
+				}
+			}
+			else if (leftHit)
+				stack[stackSize++] = std::make_pair(left, leftDistance);
+			else if (rightHit)
+				stack[stackSize++] = std::make_pair(right, rightDistance);
+		}
+	}
+
+	if (hit && hitDistance)
+		*hitDistance = maxDistance;
+
+	return hit;
+}
+
+template<typename T>
+template<typename F>
+bool NzBVH<T>::RaycastAny(const NzVector3<T>& origin, const NzVector3<T>& direction, T maxDistance, F callback) const
+{
+	///DOC: S'arrête à la première intersection trouvée (Tests d'occlusion), le foncteur suit la forme de Raycast
+	if (m_nodes.empty())
+		return false;
+
+	NzVector3<T> invDirection(F(1.0)/direction.x, F(1.0)/direction.y, F(1.0)/direction.z);
+
+	unsigned int stack[MaxDepth*2];
+	unsigned int stackSize = 0;
+
+	stack[stackSize++] = 0;
+	while (stackSize > 0)
+	{
+		const Node& node = m_nodes[stack[--stackSize]];
+
+		T distance;
+		if (!IntersectRay(node, origin, invDirection, maxDistance, &distance))
+			continue;
+
+		if (node.count > 0)
+		{
+			for (unsigned int i = 0; i < node.count; ++i)
+			{
+				T primitiveDistance = maxDistance;
+				if (callback(m_primitives[node.first + i], &primitiveDistance))
+					return true;
+			}
+		}
+		else
+		{
+			stack[stackSize++] = node.first + 1;
+			stack[stackSize++] = node.first;
+		}
+	}
+
+	return false;
+}
+
+template<typename T>
+void NzBVH<T>::Refit(const NzBox<T>* boxes)
+{
+	///DOC: Met à jour les volumes sans modifier la structure de l'arbre (Objets en mouvement)
+	///     boxes doit contenir autant de boîtes qu'à la construction, dans le même ordre
+	#if NAZARA_MATH_SAFE
+	if (!boxes)
+	{
+		NazaraError("Invalid boxes");
+		return;
+	}
+	#endif
+
+	// Les enfants étant toujours placés après leur parent, un parcours inverse remonte l'arbre
+	for (unsigned int i = m_nodes.size(); i > 0; --i)
+		RefitNode(boxes, i - 1);
+}
+
+template<typename T>
+void NzBVH<T>::Refit(const NzBox<T>* boxes, const unsigned int* primitives, unsigned int primitiveCount)
+{
+	///DOC: Ne met à jour que les nœuds contenant les primitives indiquées, ainsi que leurs ancêtres
+	#if NAZARA_MATH_SAFE
+	if (!boxes)
+	{
+		NazaraError("Invalid boxes");
+		return;
+	}
+
+	if (!primitives && primitiveCount > 0)
+	{
+		NazaraError("Invalid primitives");
+		return;
+	}
+	#endif
+
+	std::vector<unsigned int> nodes;
+	nodes.reserve(primitiveCount*m_depth);
+
+	for (unsigned int i = 0; i < primitiveCount; ++i)
+	{
+		#if NAZARA_MATH_SAFE
+		if (primitives[i] >= m_primitiveLeaves.size())
+		{
+			NazaraError("Primitive index out of range (" + NzString::Number(primitives[i]) + " >= " + NzString::Number(m_primitiveLeaves.size()) + ')');
+			return;
+		}
+		#endif
+
+		unsigned int nodeIndex = m_primitiveLeaves[primitives[i]];
+		for (;;)
+		{
+			nodes.push_back(nodeIndex);
+			if (nodeIndex == 0)
+				break;
+
+			nodeIndex = m_parents[nodeIndex];
+		}
+	}
+
+	std::sort(nodes.begin(), nodes.end(), std::greater<unsigned int>());
+	nodes.erase(std::unique(nodes.begin(), nodes.end()), nodes.end());
+
+	for (unsigned int nodeIndex : nodes)
+		RefitNode(boxes, nodeIndex);
+}
+
+template<typename T>
+template<typename F>
+void NzBVH<T>::ForEachPrimitive(unsigned int nodeIndex, F& callback) const
+{
+	// Les primitives d'un sous-arbre sont contiguës, de la feuille la plus à gauche à celle la plus à droite
+	unsigned int first = nodeIndex;
+	while (m_nodes[first].count == 0)
+		first = m_nodes[first].first;
+
+	unsigned int last = nodeIndex;
+	while (m_nodes[last].count == 0)
+		last = m_nodes[last].first + 1;
+
+	unsigned int end = m_nodes[last].first + m_nodes[last].count;
+	for (unsigned int i = m_nodes[first].first; i < end; ++i)
+		callback(m_primitives[i]);
+}
+
+template<typename T>
+void NzBVH<T>::Finalize(unsigned int primitiveCount, unsigned int depth)
+{
+	m_depth = depth;
+
+	m_parents.resize(m_nodes.size());
+	m_parents[0] = 0;
+
+	m_primitiveLeaves.resize(primitiveCount);
+
+	for (unsigned int i = 0; i < m_nodes.size(); ++i)
+	{
+		const Node& node = m_nodes[i];
+		if (node.count > 0)
+		{
+			for (unsigned int j = 0; j < node.count; ++j)
+				m_primitiveLeaves[m_primitives[node.first + j]] = i;
+		}
+		else
+		{
+			m_parents[node.first] = i;
+			m_parents[node.first + 1] = i;
+		}
+	}
+}
+
+template<typename T>
+void NzBVH<T>::RefitNode(const NzBox<T>* boxes, unsigned int nodeIndex)
+{
+	Node& node = m_nodes[nodeIndex];
+	if (node.count > 0)
+	{
+		const NzBox<T>& firstBox = boxes[m_primitives[node.first]];
+		node.minimum = firstBox.GetMinimum();
+		node.maximum = firstBox.GetMaximum();
+
+		for (unsigned int i = 1; i < node.count; ++i)
+		{
+			const NzBox<T>& box = boxes[m_primitives[node.first + i]];
+			node.minimum.Minimize(box.GetMinimum());
+			node.maximum.Maximize(box.GetMaximum());
+		}
+	}
+	else
+	{
+		const Node& left = m_nodes[node.first];
+		const Node& right = m_nodes[node.first + 1];
+
+		node.minimum = left.minimum;
+		node.minimum.Minimize(right.minimum);
+		node.maximum = left.maximum;
+		node.maximum.Maximize(right.maximum);
+	}
+}
+
+template<typename T>
+void NzBVH<T>::BuildTree(const NzBox<T>* boxes, unsigned int boxCount, unsigned int maxLeafSize, unsigned int workerCount)
+{
+	#if NAZARA_MATH_SAFE
+	if (!boxes && boxCount > 0)
+	{
+		NazaraError("Invalid boxes");
+		return;
+	}
+
+	if (maxLeafSize == 0)
+	{
+		NazaraError("Max leaf size must be over zero");
+		return;
+	}
+	#endif
+
+	Clear();
+	if (boxCount == 0)
+		return;
+
+	// Les primitives sont réordonnées avec leurs données plutôt que par indice, les découpages parcourent ainsi
+	// la mémoire de façon contiguë
+	std::vector<BuildPrimitive> primitives(boxCount);
+	for (unsigned int i = 0; i < boxCount; ++i)
+	{
+		BuildPrimitive& primitive = primitives[i];
+		primitive.minimum = boxes[i].GetMinimum();
+		primitive.maximum = boxes[i].GetMaximum();
+		primitive.centroid = F(0.5)*(primitive.minimum + primitive.maximum);
+		primitive.index = i;
+	}
+
+	BuildContext context;
+	context.maxLeafSize = maxLeafSize;
+	context.primitives = &primitives[0];
+
+	// Un arbre binaire de n primitives compte au plus 2n-1 nœuds
+	m_nodes.reserve(2*boxCount - 1);
+	m_nodes.resize(1);
+	m_nodes[0].first = 0;
+	m_nodes[0].count = boxCount;
+
+	unsigned int depth;
+	if (workerCount > 1)
+	{
+		// Quelques sous-arbres par worker pour équilibrer la charge
+		std::vector<BuildTask> tasks;
+		depth = BuildNodes(context, m_nodes, 0, &tasks, std::max(boxCount/(workerCount*4), maxLeafSize));
+
+		for (BuildTask& task : tasks)
+			NzTaskScheduler::AddTask(BuildSubtree, static_cast<const BuildContext*>(&context), &task);
+
+		NzTaskScheduler::Run();
+		NzTaskScheduler::WaitForTasks();
+
+		// Les sous-arbres sont recopiés à la fin du tableau, la racine de chacun remplaçant le nœud qui lui était réservé
+		for (BuildTask& task : tasks)
+		{
+			unsigned int offset = m_nodes.size() - 1;
+			for (Node& node : task.nodes)
+			{
+				if (node.count == 0)
+					node.first += offset;
+			}
+
+			m_nodes[task.node] = task.nodes[0];
+			m_nodes.insert(m_nodes.end(), task.nodes.begin() + 1, task.nodes.end());
+
+			depth = std::max(depth, task.depth);
+		}
+	}
+	else
+		depth = BuildNodes(context, m_nodes, 0, nullptr, 0);
+
+	m_primitives.resize(boxCount);
+	for (unsigned int i = 0; i < boxCount; ++i)
+		m_primitives[i] = primitives[i].index;
+
+	Finalize(boxCount, depth);
+}
+
+template<typename T>
+unsigned int NzBVH<T>::BuildNodes(const BuildContext& context, std::vector<Node>& nodes, unsigned int rootDepth, std::vector<BuildTask>* tasks, unsigned int taskThreshold)
+{
+	// Découpage selon la surface heuristique (SAH), évaluée sur des intervalles réguliers des centres des primitives
+	const unsigned int binCount = 16;
+
+	struct Bin
+	{
+		NzVector3<T> maximum;
+		NzVector3<T> minimum;
+		unsigned int count;
+	};
+
+	auto Area = [](const NzVector3<T>& minimum, const NzVector3<T>& maximum) -> T
+	{
+		NzVector3<T> lengths = maximum - minimum;
+		return lengths.x*lengths.y + lengths.y*lengths.z + lengths.z*lengths.x;
+	};
+
+	auto Component = [](const NzVector3<T>& vec, unsigned int axis) -> T
+	{
+		return (axis == 0) ? vec.x : ((axis == 1) ? vec.y : vec.z);
+	};
+
+	unsigned int depth = rootDepth + 1;
+
+	std::vector<std::pair<unsigned int, unsigned int>> stack; // Nœud, profondeur
+	stack.emplace_back(nodes.size() - 1, rootDepth);
+
+	while (!stack.empty())
+	{
+		unsigned int nodeIndex = stack.back().first;
+		unsigned int nodeDepth = stack.back().second;
+		stack.pop_back();
+
+		depth = std::max(depth, nodeDepth + 1);
+
+		unsigned int first = nodes[nodeIndex].first;
+		unsigned int count = nodes[nodeIndex].count;
+		BuildPrimitive* primitives = &context.primitives[first];
+
+		NzVector3<T> minimum = primitives[0].minimum;
+		NzVector3<T> maximum = primitives[0].maximum;
+		NzVector3<T> centroidMinimum = primitives[0].centroid;
+		NzVector3<T> centroidMaximum = centroidMinimum;
+		for (unsigned int i = 1; i < count; ++i)
+		{
+			const BuildPrimitive& primitive = primitives[i];
+			minimum.Minimize(primitive.minimum);
+			maximum.Maximize(primitive.maximum);
+			centroidMinimum.Minimize(primitive.centroid);
+			centroidMaximum.Maximize(primitive.centroid);
+		}
+
+		nodes[nodeIndex].minimum = minimum;
+		nodes[nodeIndex].maximum = maximum;
+
+		if (count <= context.maxLeafSize || nodeDepth + 1 >= MaxDepth)
+			continue;
+
+		if (tasks && count <= taskThreshold)
+		{
+			BuildTask task;
+			task.count = count;
+			task.depth = nodeDepth;
+			task.first = first;
+			task.node = nodeIndex;
+
+			tasks->push_back(std::move(task));
+			continue;
+		}
+
+		// Les trois axes sont répartis en un seul parcours des primitives
+		NzVector3<T> centroidExtent = centroidMaximum - centroidMinimum;
+		NzVector3<T> scale;
+		bool splittable = false;
+		for (unsigned int axis = 0; axis < 3; ++axis)
+		{
+			T extent = Component(centroidExtent, axis);
+			if (extent > F(0.0))
+				splittable = true;
+
+			(&scale.x)[axis] = (extent > F(0.0)) ? static_cast<T>(binCount)/extent : F(0.0);
+		}
+
+		unsigned int bestAxis = 3;
+		unsigned int bestSplit = 0;
+		if (splittable)
+		{
+			// Les intervalles vides restent à l'infini, leur compte nul les exclut du balayage
+			Bin bins[3][binCount];
+			for (unsigned int axis = 0; axis < 3; ++axis)
+			{
+				for (Bin& bin : bins[axis])
+				{
+					bin.minimum.Set(std::numeric_limits<T>::infinity());
+					bin.maximum.Set(-std::numeric_limits<T>::infinity());
+					bin.count = 0;
+				}
+			}
+
+			for (unsigned int i = 0; i < count; ++i)
+			{
+				const BuildPrimitive& primitive = primitives[i];
+				NzVector3<T> position = (primitive.centroid - centroidMinimum)*scale;
+				for (unsigned int axis = 0; axis < 3; ++axis)
+				{
+					Bin& bin = bins[axis][std::min(static_cast<unsigned int>(Component(position, axis)), binCount - 1)];
+					bin.minimum.Minimize(primitive.minimum);
+					bin.maximum.Maximize(primitive.maximum);
+					bin.count++;
+				}
+			}
+
+			T bestCost = std::numeric_limits<T>::infinity();
+			for (unsigned int axis = 0; axis < 3; ++axis)
+			{
+				if (Component(centroidExtent, axis) <= F(0.0))
+					continue;
+
+				// Surfaces et comptes cumulés depuis la droite, puis balayage depuis la gauche
+				T rightAreas[binCount];
+				unsigned int rightCounts[binCount];
+
+				NzVector3<T> sweepMinimum, sweepMaximum;
+				unsigned int sweepCount = 0;
+				for (unsigned int i = binCount - 1; i > 0; --i)
+				{
+					const Bin& bin = bins[axis][i];
+					if (bin.count > 0)
+					{
+						if (sweepCount == 0)
+						{
+							sweepMinimum = bin.minimum;
+							sweepMaximum = bin.maximum;
+						}
+						else
+						{
+							sweepMinimum.Minimize(bin.minimum);
+							sweepMaximum.Maximize(bin.maximum);
+						}
+
+						sweepCount += bin.count;
+					}
+
+					rightAreas[i] = (sweepCount > 0) ? Area(sweepMinimum, sweepMaximum) : F(0.0);
+					rightCounts[i] = sweepCount;
+				}
+
+				sweepCount = 0;
+				for (unsigned int i = 0; i < binCount - 1; ++i)
+				{
+					const Bin& bin = bins[axis][i];
+					if (bin.count > 0)
+					{
+						if (sweepCount == 0)
+						{
+							sweepMinimum = bin.minimum;
+							sweepMaximum = bin.maximum;
+						}
+						else
+						{
+							sweepMinimum.Minimize(bin.minimum);
+							sweepMaximum.Maximize(bin.maximum);
+						}
+
+						sweepCount += bin.count;
+					}
+
+					// Découpage entre l'intervalle i et l'intervalle i+1
+					if (sweepCount == 0 || rightCounts[i + 1] == 0)
+						continue;
+
+					T cost = Area(sweepMinimum, sweepMaximum)*sweepCount + rightAreas[i + 1]*rightCounts[i + 1];
+					if (cost < bestCost)
+					{
+						bestAxis = axis;
+						bestCost = cost;
+						bestSplit = i + 1;
+					}
+				}
+			}
+		}
+
+		unsigned int leftCount;
+		if (bestAxis < 3)
+		{
+			T axisMinimum = Component(centroidMinimum, bestAxis);
+			T axisScale = Component(scale, bestAxis);
+			BuildPrimitive* middle = std::partition(primitives, primitives + count, [=](const BuildPrimitive& primitive)
+			{
+				T position = (Component(primitive.centroid, bestAxis) - axisMinimum)*axisScale;
+				return std::min(static_cast<unsigned int>(position), binCount - 1) < bestSplit;
+			});
+
+			leftCount = middle - primitives;
+		}
+		else
+			leftCount = count/2; // Centres confondus, aucun découpage spatial n'est possible
+
+		unsigned int childIndex = nodes.size();
+		nodes.resize(childIndex + 2);
+
+		Node& left = nodes[childIndex];
+		left.first = first;
+		left.count = leftCount;
+
+		Node& right = nodes[childIndex + 1];
+		right.first = first + leftCount;
+		right.count = count - leftCount;
+
+		nodes[nodeIndex].first = childIndex;
+		nodes[nodeIndex].count = 0;
+
+		stack.emplace_back(childIndex + 1, nodeDepth + 1);
+		stack.emplace_back(childIndex, nodeDepth + 1);
+	}
+
+	return depth;
+}
+
+template<typename T>
+void NzBVH<T>::BuildSubtree(const BuildContext* context, BuildTask* task)
+{
+	task->nodes.reserve(2*task->count - 1);
+	task->nodes.resize(1);
+	task->nodes[0].first = task->first;
+	task->nodes[0].count = task->count;
+
+	task->depth = BuildNodes(*context, task->nodes, task->depth, nullptr, 0);
+}
+
+template<typename T>
+bool NzBVH<T>::IntersectRay(const Node& node, const NzVector3<T>& origin, const NzVector3<T>& invDirection, T maxDistance, T* distance)
+{
+	// Méthode des "slabs"
+	// Un rayon parallèle à un slab et partant de l'une de ses faces donne 0*inf (NaN) sur cette face, il reste alors
+	// dans le slab : celui-ci est ignoré (Le résultat de std::min/max dépendrait sinon de l'opérande valant NaN)
+	T nearest = F(0.0);
+	T farthest = maxDistance;
+
+	T t1 = (node.minimum.x - origin.x)*invDirection.x;
+	T t2 = (node.maximum.x - origin.x)*invDirection.x;
+	if (t1 == t1 && t2 == t2)
+	{
+		nearest = std::max(nearest, std::min(t1, t2));
+		farthest = std::min(farthest, std::max(t1, t2));
+	}
+
+	t1 = (node.minimum.y - origin.y)*invDirection.y;
+	t2 = (node.maximum.y - origin.y)*invDirection.y;
+	if (t1 == t1 && t2 == t2)
+	{
+		nearest = std::max(nearest, std::min(t1, t2));
+		farthest = std::min(farthest, std::max(t1, t2));
+	}
+
+	t1 = (node.minimum.z - origin.z)*invDirection.z;
+	t2 = (node.maximum.z - origin.z)*invDirection.z;
+	if (t1 == t1 && t2 == t2)
+	{
+		nearest = std::max(nearest, std::min(t1, t2));
+		farthest = std::min(farthest, std::max(t1, t2));
+	}
+
+	*distance = nearest;
+	return nearest <= farthest;
+}
+
+#undef F
+
+#include <Nazara/Core/DebugOff.hpp>
@@ -33,6 +33,9 @@
 // Définit le radian comme l'unité utilisée pour les angles
 #define NAZARA_MATH_ANGLE_RADIAN 0
 
+// Aligne les matrices sur 16 octets, leurs lignes ne chevauchent alors jamais deux lignes de cache lors des calculs SIMD (Passe la taille d'une matrice de 68 à 80 octets)
+#define NAZARA_MATH_MATRIX4_ALIGNED 0
+
 // Optimise automatiquement les opérations entre matrices affines (Demande plusieurs comparaisons pour déterminer si une matrice est affine)
 #define NAZARA_MATH_MATRIX4_CHECK_AFFINE 0
 
@@ -16,8 +16,14 @@ template<typename T> class NzVector2;
 template<typename T> class NzVector3;
 template<typename T> class NzVector4;
 
+#if NAZARA_MATH_MATRIX4_ALIGNED
+	#define NAZARA_MATRIX4_ALIGNMENT alignas(16)
+#else
+	#define NAZARA_MATRIX4_ALIGNMENT
+#endif
+
 template<typename T>
-class NzMatrix4
+class NAZARA_MATRIX4_ALIGNMENT NzMatrix4
 {
 	public:
 		NzMatrix4() = default;
@@ -4,6 +4,7 @@
 
 #include <Nazara/Core/StringStream.hpp>
 #include <Nazara/Core/Error.hpp>
+#include <Nazara/Core/Simd.hpp>
 #include <Nazara/Math/Basic.hpp>
 #include <Nazara/Math/Config.hpp>
 #include <Nazara/Math/EulerAngles.hpp>
@@ -1124,6 +1125,104 @@ NzMatrix4<T> operator*(T scale, const NzMatrix4<T>& matrix)
 	return matrix * scale;
 }
 
+// Spécialisations float, les calculs lourds sont confiés aux noyaux de NzSimd (SSE si disponible)
+template<>
+inline NzMatrix4<float>& NzMatrix4<float>::Concatenate(const NzMatrix4& matrix)
+{
+	#if NAZARA_MATH_MATRIX4_CHECK_AFFINE
+	if (IsAffine() && matrix.IsAffine())
+		return ConcatenateAffine(matrix);
+	#endif
+
+	if (m_isIdentity)
+		return Set(matrix);
+
+	NzSimd::Matrix4Concatenate(&m11, &matrix.m11, &m11);
+	m_isIdentity = false;
+
+	return *this;
+}
+
+template<>
+inline NzMatrix4<float>& NzMatrix4<float>::ConcatenateAffine(const NzMatrix4& matrix)
+{
+	#ifdef NAZARA_DEBUG
+	if (!IsAffine())
+	{
+		NazaraWarning("First matrix not affine");
+		return Concatenate(matrix);
+	}
+
+	if (!matrix.IsAffine())
+	{
+		NazaraWarning("Second matrix not affine");
+		return Concatenate(matrix);
+	}
+	#endif
+
+	if (m_isIdentity)
+		return Set(matrix);
+
+	NzSimd::Matrix4ConcatenateAffine(&m11, &matrix.m11, &m11);
+	m_isIdentity = false;
+
+	return *this;
+}
+
+template<>
+inline bool NzMatrix4<float>::GetInverseAffine(NzMatrix4* dest) const
+{
+	#if NAZARA_MATH_SAFE
+	if (!IsAffine())
+	{
+		NazaraError("Matrix is not affine");
+		return false;
+	}
+
+	if (!dest)
+	{
+		NazaraError("Destination matrix must be valid");
+		return false;
+	}
+	#endif
+
+	if (m_isIdentity)
+	{
+		dest->MakeIdentity();
+		return true;
+	}
+
+	float det = GetDeterminantAffine();
+	if (NzNumberEquals(det, 0.f))
+		return false;
+
+	NzSimd::Matrix4InverseAffine(&m11, det, &dest->m11);
+	dest->m_isIdentity = false;
+
+	return true;
+}
+
+#if NAZARA_SIMD_SSE2
+template<>
+inline NzVector4<float> NzMatrix4<float>::Transform(const NzVector4<float>& vector) const
+{
+	if (m_isIdentity)
+		return vector;
+
+	__m128 v = _mm_loadu_ps(&vector.x);
+
+	__m128 r = _mm_mul_ps(_mm_shuffle_ps(v, v, _MM_SHUFFLE(0, 0, 0, 0)), _mm_loadu_ps(&m11));
+	r = _mm_add_ps(r, _mm_mul_ps(_mm_shuffle_ps(v, v, _MM_SHUFFLE(1, 1, 1, 1)), _mm_loadu_ps(&m21)));
+	r = _mm_add_ps(r, _mm_mul_ps(_mm_shuffle_ps(v, v, _MM_SHUFFLE(2, 2, 2, 2)), _mm_loadu_ps(&m31)));
+	r = _mm_add_ps(r, _mm_mul_ps(_mm_shuffle_ps(v, v, _MM_SHUFFLE(3, 3, 3, 3)), _mm_loadu_ps(&m41)));
+
+	NzVector4<float> result;
+	_mm_storeu_ps(&result.x, r);
+
+	return result;
+}
+#endif
+
 #undef F
 
 #include <Nazara/Core/DebugOff.hpp>
@@ -2,6 +2,7 @@
 // This file is part of the "Nazara Engine - Mathematics module"
 // For conditions of distribution and use, see copyright notice in Config.hpp
 
+#include <Nazara/Core/Simd.hpp>
 #include <Nazara/Core/StringStream.hpp>
 #include <Nazara/Math/Basic.hpp>
 #include <Nazara/Math/Config.hpp>
@@ -478,6 +479,30 @@ std::ostream& operator<<(std::ostream& out, const NzQuaternion<T>& quat)
 	return out << quat.ToString();
 }
 
+#if NAZARA_SIMD_SSE2
+template<>
+inline NzQuaternion<float> NzQuaternion<float>::operator*(const NzQuaternion& quat) const
+{
+	__m128 q1 = _mm_loadu_ps(&w);
+	__m128 q2 = _mm_loadu_ps(&quat.w);
+
+	// Chaque composante de la première rotation multiplie une permutation signée de la seconde
+	__m128 xSigns = _mm_castsi128_ps(_mm_set_epi32(0, 0x80000000, 0, 0x80000000));
+	__m128 ySigns = _mm_castsi128_ps(_mm_set_epi32(0x80000000, 0, 0, 0x80000000));
+	__m128 zSigns = _mm_castsi128_ps(_mm_set_epi32(0, 0, 0x80000000, 0x80000000));
+
+	__m128 r = _mm_mul_ps(_mm_shuffle_ps(q1, q1, _MM_SHUFFLE(0, 0, 0, 0)), q2);
+	r = _mm_add_ps(r, _mm_xor_ps(_mm_mul_ps(_mm_shuffle_ps(q1, q1, _MM_SHUFFLE(1, 1, 1, 1)), _mm_shuffle_ps(q2, q2, _MM_SHUFFLE(2, 3, 0, 1))), xSigns));
+	r = _mm_add_ps(r, _mm_xor_ps(_mm_mul_ps(_mm_shuffle_ps(q1, q1, _MM_SHUFFLE(2, 2, 2, 2)), _mm_shuffle_ps(q2, q2, _MM_SHUFFLE(1, 0, 3, 2))), ySigns));
+	r = _mm_add_ps(r, _mm_xor_ps(_mm_mul_ps(_mm_shuffle_ps(q1, q1, _MM_SHUFFLE(3, 3, 3, 3)), _mm_shuffle_ps(q2, q2, _MM_SHUFFLE(0, 1, 2, 3))), zSigns));
+
+	NzQuaternion result;
+	_mm_storeu_ps(&result.w, r);
+
+	return result;
+}
+#endif
+
 #undef F
 
 #include <Nazara/Core/DebugOff.hpp>
@@ -29,6 +29,9 @@ struct NAZARA_API NzMaterialParams
 	bool loadSpecularMap = true;
 
 	bool IsValid() const;
+
+	bool operator==(const NzMaterialParams& params) const;
+	bool operator!=(const NzMaterialParams& params) const;
 };
 
 class NzMaterial;
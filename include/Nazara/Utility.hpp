@@ -32,6 +32,7 @@
 #include <Nazara/Utility/AbstractBuffer.hpp>
 #include <Nazara/Utility/Algorithm.hpp>
 #include <Nazara/Utility/Animation.hpp>
+#include <Nazara/Utility/AnimationInstancer.hpp>
 #include <Nazara/Utility/Buffer.hpp>
 #include <Nazara/Utility/BufferMapper.hpp>
 #include <Nazara/Utility/Config.hpp>
@@ -52,9 +53,13 @@
 #include <Nazara/Utility/PixelFormat.hpp>
 #include <Nazara/Utility/Sequence.hpp>
 #include <Nazara/Utility/SkeletalMesh.hpp>
+#include <Nazara/Utility/SkeletalPose.hpp>
+#include <Nazara/Utility/SkeletalPosePool.hpp>
 #include <Nazara/Utility/Skeleton.hpp>
 #include <Nazara/Utility/StaticMesh.hpp>
 #include <Nazara/Utility/SubMesh.hpp>
+#include <Nazara/Utility/TransformSystem.hpp>
+#include <Nazara/Utility/TriangleBVH.hpp>
 #include <Nazara/Utility/TriangleIterator.hpp>
 #include <Nazara/Utility/Utility.hpp>
 #include <Nazara/Utility/VertexBuffer.hpp>
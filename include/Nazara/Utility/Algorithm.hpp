@@ -8,6 +8,7 @@
 #define NAZARA_ALGORITHM_UTILITY_HPP
 
 #include <Nazara/Prerequesites.hpp>
+#include <Nazara/Math/Algorithm.hpp>
 #include <Nazara/Math/Box.hpp>
 #include <Nazara/Math/Matrix4.hpp>
 #include <Nazara/Math/Vector2.hpp>
@@ -33,6 +34,7 @@ NAZARA_API void NzGenerateUvSphere(float size, unsigned int sliceCount, unsigned
 
 NAZARA_API void NzOptimizeIndices(NzIndexIterator indices, unsigned int indexCount);
 
+NAZARA_API void NzTransformVertices(const NzMatrix4f& matrix, NzVector3f* positions, NzVector3f* normals, NzVector3f* tangents, unsigned int vertexCount, unsigned int stride);
 template<typename T> void NzTransformVertices(T* vertices, unsigned int vertexCount, const NzMatrix4f& matrix);
 
 #include <Nazara/Utility/Algorithm.inl>
@@ -7,39 +7,17 @@
 template<typename T>
 NzBoxf NzComputeVerticesAABB(const T* vertices, unsigned int vertexCount)
 {
-	NzBoxf aabb;
-	if (vertexCount > 0)
-	{
-		aabb.Set(vertices->position.x, vertices->position.y, vertices->position.z, 0.f, 0.f, 0.f);
-		vertices++;
-
-		for (unsigned int i = 1; i < vertexCount; ++i)
-		{
-			aabb.ExtendTo(vertices->position);
-			vertices++;
-		}
-	}
-	else
-		aabb.MakeZero();
-
-	return aabb;
+	// Les positions sont lues directement dans les sommets, sans copie
+	return NzComputeAABB(&vertices->position, vertexCount, sizeof(T));
 }
 
 template<typename T>
 void NzTransformVertices(T* vertices, unsigned int vertexCount, const NzMatrix4f& matrix)
 {
-	if (matrix.IsIdentity())
+	if (matrix.IsIdentity() || vertexCount == 0)
 		return;
 
-	NzVector3f scale = matrix.GetScale();
-
-	for (unsigned int i = 0; i < vertexCount; ++i)
-	{
-		vertices->normal = matrix.Transform(vertices->normal, 0.f) / scale;
-		vertices->position = matrix.Transform(vertices->position);
-		vertices->tangent = matrix.Transform(vertices->tangent, 0.f) / scale;
-		vertices++;
-	}
+	NzTransformVertices(matrix, &vertices->position, &vertices->normal, &vertices->tangent, vertexCount, sizeof(T));
 }
 
 #include <Nazara/Utility/DebugOff.hpp>
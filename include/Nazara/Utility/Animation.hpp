@@ -12,20 +12,46 @@
 #include <Nazara/Core/ResourceLoader.hpp>
 #include <Nazara/Core/ResourceRef.hpp>
 #include <Nazara/Core/String.hpp>
+#include <Nazara/Math/Basic.hpp>
 #include <Nazara/Utility/Enums.hpp>
 #include <Nazara/Utility/Sequence.hpp>
 
+struct NAZARA_API NzAnimationCompressionParams
+{
+	// L'écart maximal toléré sur les positions reconstruites
+	float positionTolerance = 0.001f;
+	// L'écart angulaire maximal toléré sur les rotations reconstruites (En degrés, ou radians selon NAZARA_MATH_ANGLE_RADIAN)
+	float rotationTolerance = NzDegrees(0.1f);
+	// L'écart maximal toléré sur les échelles reconstruites
+	float scaleTolerance = 0.001f;
+	// Supprime les frames retrouvées par interpolation de leurs voisines (Sinon seules les pistes constantes sont réduites)
+	bool keyframeReduction = true;
+
+	bool IsValid() const;
+
+	bool operator==(const NzAnimationCompressionParams& params) const;
+	bool operator!=(const NzAnimationCompressionParams& params) const;
+};
+
 struct NAZARA_API NzAnimationParams
 {
+	// Les paramètres de compression, si celle-ci est activée
+	NzAnimationCompressionParams compressionParams;
 	// La frame de fin à charger
 	unsigned int endFrame = static_cast<unsigned int>(-1);
 	// La frame de début à charger
 	unsigned int startFrame = 0;
+	// Compresse les animations squelettiques après leur chargement (Voir NzAnimation::Compress)
+	bool compress = false;
 
 	bool IsValid() const;
+
+	bool operator==(const NzAnimationParams& params) const;
+	bool operator!=(const NzAnimationParams& params) const;
 };
 
 class NzAnimation;
+class NzSkeletalPose;
 class NzSkeleton;
 
 using NzAnimationConstRef = NzResourceRef<const NzAnimation>;
@@ -43,8 +69,10 @@ class NAZARA_API NzAnimation : public NzResource
 		~NzAnimation();
 
 		bool AddSequence(const NzSequence& sequence);
+		void AnimatePose(NzSkeletalPose* targetPose, unsigned int frameA, unsigned int frameB, float interpolation) const;
 		void AnimateSkeleton(NzSkeleton* targetSkeleton, unsigned int frameA, unsigned int frameB, float interpolation) const;
 
+		bool Compress(const NzAnimationCompressionParams& params = NzAnimationCompressionParams());
 		bool CreateSkeletal(unsigned int frameCount, unsigned int jointCount);
 		void Destroy();
 
@@ -52,6 +80,7 @@ class NAZARA_API NzAnimation : public NzResource
 
 		unsigned int GetFrameCount() const;
 		unsigned int GetJointCount() const;
+		unsigned int GetMemoryUsage() const;
 		NzSequence* GetSequence(const NzString& sequenceName);
 		NzSequence* GetSequence(unsigned int index);
 		const NzSequence* GetSequence(const NzString& sequenceName) const;
@@ -65,6 +94,7 @@ class NAZARA_API NzAnimation : public NzResource
 		bool HasSequence(const NzString& sequenceName) const;
 		bool HasSequence(unsigned int index = 0) const;
 
+		bool IsCompressed() const;
 		bool IsLoopPointInterpolationEnabled() const;
 		bool IsValid() const;
 
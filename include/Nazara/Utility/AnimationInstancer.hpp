@@ -0,0 +1,88 @@
+// Copyright (C) 2014 Jérôme Leclercq
+// This file is part of the "Nazara Engine - Utility module"
+// For conditions of distribution and use, see copyright notice in Config.hpp
+
+#pragma once
+
+#ifndef NAZARA_ANIMATIONINSTANCER_HPP
+#define NAZARA_ANIMATIONINSTANCER_HPP
+
+#include <Nazara/Prerequesites.hpp>
+#include <Nazara/Core/NonCopyable.hpp>
+#include <Nazara/Utility/Mesh.hpp>
+#include <Nazara/Utility/Skeleton.hpp>
+#include <Nazara/Utility/VertexStruct.hpp>
+#include <unordered_map>
+#include <vector>
+
+class NzAnimation;
+
+// Partage l'évaluation d'une animation squelettique entre les modèles jouant la même frame (Foules, ...)
+// Le temps est arrondi à une subdivision de frame près, les modèles dont le mesh, l'animation et le temps arrondi sont
+// identiques reçoivent la même instance, et donc le même squelette animé et les mêmes sommets skinnés
+// Une instance est conservée tant qu'elle est référencée (Acquire/Release), l'instancer doit survivre à ses utilisateurs
+// Il n'est pas protégé des accès concurrentiels
+class NAZARA_API NzAnimationInstancer : NzNonCopyable
+{
+	public:
+		class Instance;
+
+		NzAnimationInstancer(unsigned int subdivisionCount = 4);
+		~NzAnimationInstancer();
+
+		Instance* Acquire(const NzMesh* mesh, const NzAnimation* animation, unsigned int frameA, unsigned int frameB, float interpolation);
+
+		void Clear();
+
+		unsigned int GetInstanceCount() const;
+		unsigned int GetSubdivisionCount() const;
+
+		void Release(Instance* instance);
+
+		void SetSubdivisionCount(unsigned int subdivisionCount);
+
+		class NAZARA_API Instance
+		{
+			friend NzAnimationInstancer;
+
+			public:
+				NzSkeleton* GetSkeleton();
+				const NzSkeleton* GetSkeleton() const;
+				const NzMeshVertex* GetSkinnedVertices(unsigned int subMeshIndex) const;
+				unsigned int GetReferenceCount() const;
+
+			private:
+				Instance() = default;
+				~Instance() = default;
+
+				struct Key
+				{
+					const NzAnimation* animation;
+					const NzMesh* mesh;
+					unsigned int frameA;
+					unsigned int frameB;
+					unsigned int subdivision;
+
+					bool operator==(const Key& key) const;
+				};
+
+				struct KeyHash
+				{
+					std::size_t operator()(const Key& key) const;
+				};
+
+				Key m_key;
+				NzMeshConstRef m_mesh; // Garde le mesh en vie, son squelette pouvant être réutilisé après la libération
+				NzSkeleton m_skeleton;
+				mutable std::vector<std::vector<NzMeshVertex>> m_skinnedVertices;
+				mutable std::vector<bool> m_skinned;
+				unsigned int m_referenceCount;
+		};
+
+	private:
+		std::unordered_map<Instance::Key, Instance*, Instance::KeyHash> m_instances;
+		std::vector<Instance*> m_freeInstances;
+		unsigned int m_subdivisionCount;
+};
+
+#endif // NAZARA_ANIMATIONINSTANCER_HPP
@@ -38,6 +38,9 @@
 // Le skinning doit-il prendre avantage du multi-threading ? (Boost de performances sur les processeurs multi-coeurs)
 #define NAZARA_UTILITY_MULTITHREADED_SKINNING 0
 
+// Les transformations de sommets en lot doivent-elles être réparties sur plusieurs threads ? (Seulement au-delà de quelques milliers de sommets)
+#define NAZARA_UTILITY_MULTITHREADED_TRANSFORM 0
+
 // Active les tests de sécurité basés sur le code (Conseillé pour le développement)
 #define NAZARA_UTILITY_SAFE 1
 
@@ -32,6 +32,9 @@ struct NAZARA_API NzImageParams
 	nzUInt8 levelCount = 0;
 
 	bool IsValid() const;
+
+	bool operator==(const NzImageParams& params) const;
+	bool operator!=(const NzImageParams& params) const;
 };
 
 class NzImage;
@@ -40,6 +40,9 @@ struct NAZARA_API NzMeshParams
 	bool optimizeIndexBuffers = true;
 
 	bool IsValid() const;
+
+	bool operator==(const NzMeshParams& params) const;
+	bool operator!=(const NzMeshParams& params) const;
 };
 
 class NzAnimation;
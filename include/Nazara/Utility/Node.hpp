@@ -14,8 +14,12 @@
 #include <Nazara/Utility/Enums.hpp>
 #include <vector>
 
+class NzTransformSystem;
+
 class NAZARA_API NzNode
 {
+	friend class NzTransformSystem;
+
 	public:
 		NzNode();
 		NzNode(const NzNode& node);
@@ -43,6 +47,7 @@ class NAZARA_API NzNode
 		NzQuaternionf GetRotation(nzCoordSys coordSys = nzCoordSys_Global) const;
 		NzVector3f GetScale(nzCoordSys coordSys = nzCoordSys_Global) const;
 		const NzMatrix4f& GetTransformMatrix() const;
+		NzTransformSystem* GetTransformSystem() const;
 		NzVector3f GetUp() const;
 
 		bool HasChilds() const;
@@ -77,6 +82,7 @@ class NAZARA_API NzNode
 		void SetScale(float scale, nzCoordSys coordSys = nzCoordSys_Local);
 		void SetScale(float scaleX, float scaleY, float scaleZ, nzCoordSys coordSys = nzCoordSys_Local);
 		void SetTransformMatrix(const NzMatrix4f& matrix);
+		void SetTransformSystem(NzTransformSystem* transformSystem);
 
 		// Local -> global
 		NzVector3f ToGlobalPosition(const NzVector3f& localPosition) const;
@@ -88,11 +94,14 @@ class NAZARA_API NzNode
 		NzQuaternionf ToLocalRotation(const NzQuaternionf& globalRotation) const;
 		NzVector3f ToLocalScale(const NzVector3f& globalScale) const;
 
+		void UpdateTransforms() const;
+
 		NzNode& operator=(const NzNode& node);
 
 	protected:
 		void AddChild(NzNode* node) const;
 		virtual void Invalidate();
+		void InvalidateSubtree();
 		virtual void OnParenting(const NzNode* parent);
 		void RemoveChild(NzNode* node) const;
 		void UpdateDerived() const;
@@ -111,6 +120,8 @@ class NAZARA_API NzNode
 		NzVector3f m_position;
 		NzVector3f m_scale;
 		const NzNode* m_parent;
+		NzTransformSystem* m_transformSystem;
+		unsigned int m_transformIndex;
 		mutable bool m_derivedUpdated;
 		bool m_inheritPosition;
 		bool m_inheritRotation;
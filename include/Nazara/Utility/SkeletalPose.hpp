@@ -0,0 +1,71 @@
+// Copyright (C) 2014 Jérôme Leclercq
+// This file is part of the "Nazara Engine - Utility module"
+// For conditions of distribution and use, see copyright notice in Config.hpp
+
+#pragma once
+
+#ifndef NAZARA_SKELETALPOSE_HPP
+#define NAZARA_SKELETALPOSE_HPP
+
+#include <Nazara/Prerequesites.hpp>
+#include <Nazara/Core/String.hpp>
+#include <Nazara/Math/Quaternion.hpp>
+#include <Nazara/Math/Vector3.hpp>
+
+class NzSkeletalPosePool;
+class NzSkeleton;
+
+// Pose d'un squelette réduite aux transformations locales de ses joints, rangées dans trois tableaux contigus
+// Contrairement à un NzSkeleton, une pose ne possède ni noeuds ni matrices: elle sert d'intermédiaire léger pour
+// échantillonner, mélanger et superposer des animations avant d'être appliquée au squelette (Apply)
+// Les opérations n'accèdent qu'aux poses passées en paramètre, des poses distinctes peuvent donc être évaluées en parallèle
+class NAZARA_API NzSkeletalPose
+{
+	public:
+		NzSkeletalPose() = default;
+		NzSkeletalPose(unsigned int jointCount);
+		NzSkeletalPose(NzSkeletalPosePool* pool);
+		NzSkeletalPose(const NzSkeletalPose& pose);
+		NzSkeletalPose(NzSkeletalPose&& pose) noexcept;
+		~NzSkeletalPose();
+
+		void AddAdditive(const NzSkeletalPose& additivePose, float weight, const float* jointWeights = nullptr);
+		void Apply(NzSkeleton* skeleton) const;
+
+		void Blend(const NzSkeletalPose& poseA, const NzSkeletalPose& poseB, float weight, const float* jointWeights = nullptr);
+
+		bool Create(unsigned int jointCount);
+		bool Create(NzSkeletalPosePool* pool);
+		void Destroy();
+
+		unsigned int GetJointCount() const;
+		NzVector3f* GetPositions();
+		const NzVector3f* GetPositions() const;
+		NzQuaternionf* GetRotations();
+		const NzQuaternionf* GetRotations() const;
+		NzVector3f* GetScales();
+		const NzVector3f* GetScales() const;
+
+		bool IsValid() const;
+
+		void MakeAdditive(const NzSkeletalPose& pose, const NzSkeletalPose& referencePose);
+		void MakeIdentity();
+
+		void Set(const NzSkeleton& skeleton);
+
+		NzSkeletalPose& operator=(const NzSkeletalPose& pose);
+		NzSkeletalPose& operator=(NzSkeletalPose&& pose) noexcept;
+
+		static bool BuildJointMask(const NzSkeleton& skeleton, const NzString& rootJointName, float* jointWeights);
+
+	private:
+		void SetBuffer(nzUInt8* buffer);
+
+		NzSkeletalPosePool* m_pool = nullptr;
+		NzQuaternionf* m_rotations = nullptr;
+		NzVector3f* m_positions = nullptr;
+		NzVector3f* m_scales = nullptr;
+		unsigned int m_jointCount = 0;
+};
+
+#endif // NAZARA_SKELETALPOSE_HPP
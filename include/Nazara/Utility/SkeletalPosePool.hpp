@@ -0,0 +1,38 @@
+// Copyright (C) 2014 Jérôme Leclercq
+// This file is part of the "Nazara Engine - Utility module"
+// For conditions of distribution and use, see copyright notice in Config.hpp
+
+#pragma once
+
+#ifndef NAZARA_SKELETALPOSEPOOL_HPP
+#define NAZARA_SKELETALPOSEPOOL_HPP
+
+#include <Nazara/Prerequesites.hpp>
+#include <Nazara/Core/MemoryPool.hpp>
+#include <Nazara/Core/NonCopyable.hpp>
+
+class NzSkeletalPose;
+
+// Réserve de poses d'un même nombre de joints, évitant une allocation à chaque pose temporaire (Mélanges, couches, ...)
+// L'allocation et la libération sont sans verrou (Voir NzMemoryPool), la réserve peut donc être partagée entre threads
+// Elle doit survivre aux poses qui en sont issues
+class NAZARA_API NzSkeletalPosePool : NzNonCopyable
+{
+	friend NzSkeletalPose;
+
+	public:
+		NzSkeletalPosePool(unsigned int jointCount, unsigned int posesPerChunk = 16);
+		~NzSkeletalPosePool() = default;
+
+		unsigned int GetAllocatedPoseCount() const;
+		unsigned int GetJointCount() const;
+
+	private:
+		nzUInt8* Allocate();
+		void Free(nzUInt8* buffer);
+
+		NzMemoryPool m_pool;
+		unsigned int m_jointCount;
+};
+
+#endif // NAZARA_SKELETALPOSEPOOL_HPP
@@ -10,6 +10,7 @@
 #include <Nazara/Prerequesites.hpp>
 #include <Nazara/Core/ResourceListener.hpp>
 #include <Nazara/Utility/SubMesh.hpp>
+#include <Nazara/Utility/TriangleBVH.hpp>
 
 class NzStaticMesh;
 
@@ -32,13 +33,18 @@ class NAZARA_API NzStaticMesh final : public NzSubMesh, NzResourceListener
 		const NzBoxf& GetAABB() const override;
 		nzAnimationType GetAnimationType() const final;
 		const NzIndexBuffer* GetIndexBuffer() const override;
+		const NzTriangleBVH* GetTriangleBVH() const;
 		NzVertexBuffer* GetVertexBuffer();
 		const NzVertexBuffer* GetVertexBuffer() const;
 		unsigned int GetVertexCount() const override;
 
+		void InvalidateTriangleBVH();
 		bool IsAnimated() const final;
 		bool IsValid() const;
 
+		bool Raycast(const NzVector3f& origin, const NzVector3f& direction, float maxDistance, NzTriangleHit* hit = nullptr) const;
+		bool RaycastAny(const NzVector3f& origin, const NzVector3f& direction, float maxDistance) const;
+
 		void SetAABB(const NzBoxf& aabb);
 		void SetIndexBuffer(const NzIndexBuffer* indexBuffer);
 
@@ -47,7 +53,9 @@ class NAZARA_API NzStaticMesh final : public NzSubMesh, NzResourceListener
 
 		NzBoxf m_aabb;
 		NzIndexBufferConstRef m_indexBuffer = nullptr;
+		mutable NzTriangleBVH m_triangleBVH;
 		NzVertexBufferRef m_vertexBuffer = nullptr;
+		mutable bool m_triangleBVHUpdated = false;
 };
 
 #endif // NAZARA_STATICMESH_HPP
@@ -0,0 +1,78 @@
+// Copyright (C) 2014 Jérôme Leclercq
+// This file is part of the "Nazara Engine - Utility module"
+// For conditions of distribution and use, see copyright notice in Config.hpp
+
+#pragma once
+
+#ifndef NAZARA_TRANSFORMSYSTEM_HPP
+#define NAZARA_TRANSFORMSYSTEM_HPP
+
+#include <Nazara/Prerequesites.hpp>
+#include <Nazara/Core/NonCopyable.hpp>
+#include <Nazara/Math/Matrix4.hpp>
+#include <Nazara/Math/Quaternion.hpp>
+#include <Nazara/Math/Vector3.hpp>
+#include <vector>
+
+class NzNode;
+
+// Stockage orienté données des transformations d'un ensemble de noeuds
+// Chaque composante est rangée dans son propre tableau contigu, trié par profondeur dans la hiérarchie:
+// un parent précède toujours ses enfants, toutes les transformations globales sont donc calculées en un seul parcours linéaire
+// Les noeuds rattachés (NzNode::SetTransformSystem) ne sont plus que des façades vers leur emplacement dans ces tableaux
+class NAZARA_API NzTransformSystem : NzNonCopyable
+{
+	friend class NzNode;
+
+	public:
+		NzTransformSystem();
+		~NzTransformSystem();
+
+		unsigned int GetNodeCount() const;
+
+		void Update();
+
+	private:
+		void GetDerived(unsigned int index, NzVector3f* position, NzQuaternionf* rotation, NzVector3f* scale) const;
+		const NzMatrix4f& GetTransformMatrix(unsigned int index) const;
+		void Invalidate(const NzNode* node);
+		void InvalidateHierarchy();
+		void Register(NzNode* node);
+		void SortByDepth();
+		void Unregister(NzNode* node);
+		void Update(const NzNode* node);
+		void UpdateNode(unsigned int index);
+		void UpdatePendingNode(unsigned int index);
+
+		enum Flags
+		{
+			Flag_Dirty           = 0x1,
+			Flag_InheritPosition = 0x2,
+			Flag_InheritRotation = 0x4,
+			Flag_InheritScale    = 0x8
+		};
+
+		// Valeurs particulières de l'index du parent
+		enum Parent
+		{
+			ExternalParent = -2, // Le parent n'appartient pas au système
+			NoParent = -1
+		};
+
+		std::vector<NzMatrix4f> m_transformMatrices;
+		std::vector<NzNode*> m_nodes;
+		std::vector<NzQuaternionf> m_derivedRotations;
+		std::vector<NzQuaternionf> m_localRotations;
+		std::vector<NzVector3f> m_derivedPositions;
+		std::vector<NzVector3f> m_derivedScales;
+		std::vector<NzVector3f> m_localPositions;
+		std::vector<NzVector3f> m_localScales;
+		std::vector<int> m_parents;
+		std::vector<nzUInt8> m_flags;
+		std::vector<unsigned int> m_updateStamps;
+		unsigned int m_updateStamp;
+		bool m_dirty;
+		bool m_hierarchyDirty;
+};
+
+#endif // NAZARA_TRANSFORMSYSTEM_HPP
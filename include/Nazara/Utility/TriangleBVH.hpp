@@ -0,0 +1,59 @@
+// Copyright (C) 2014 Jérôme Leclercq
+// This file is part of the "Nazara Engine - Utility module"
+// For conditions of distribution and use, see copyright notice in Config.hpp
+
+#pragma once
+
+#ifndef NAZARA_TRIANGLEBVH_HPP
+#define NAZARA_TRIANGLEBVH_HPP
+
+#include <Nazara/Prerequesites.hpp>
+#include <Nazara/Math/BVH.hpp>
+#include <Nazara/Math/Vector3.hpp>
+#include <vector>
+
+class NzStaticMesh;
+
+struct NzTriangleHit
+{
+	NzVector3f normal;   // Normale géométrique, tournée vers l'origine du rayon
+	NzVector3f position;
+	float distance;      // En multiples de la direction du rayon
+	float u, v;          // Coordonnées barycentriques (Par rapport aux deuxième et troisième sommets)
+	unsigned int triangle;
+};
+
+// Hiérarchie de volumes sur les triangles d'un sous-mesh, pour les tests de rayon (Sélection, ligne de vue, ...)
+// Les positions sont recopiées à la construction, la hiérarchie doit donc être reconstruite si la géométrie change
+// Les triangles sont numérotés dans l'ordre de la primitive du sous-mesh, et sont testés sur leurs deux faces
+class NAZARA_API NzTriangleBVH
+{
+	public:
+		NzTriangleBVH() = default;
+		~NzTriangleBVH() = default;
+
+		bool Build(const NzStaticMesh* subMesh);
+
+		void Destroy();
+
+		const NzBVHf& GetBVH() const;
+		unsigned int GetTriangleCount() const;
+
+		bool IsValid() const;
+
+		bool Raycast(const NzVector3f& origin, const NzVector3f& direction, float maxDistance, NzTriangleHit* hit = nullptr) const;
+		bool RaycastAny(const NzVector3f& origin, const NzVector3f& direction, float maxDistance) const;
+
+	private:
+		struct Triangle
+		{
+			NzVector3f vertex;
+			NzVector3f edge1;
+			NzVector3f edge2;
+		};
+
+		NzBVHf m_bvh;
+		std::vector<Triangle> m_triangles;
+};
+
+#endif // NAZARA_TRIANGLEBVH_HPP
@@ -7,6 +7,7 @@
 #include <Nazara/Core/Error.hpp>
 #include <Nazara/Core/HardwareInfo.hpp>
 #include <Nazara/Core/Log.hpp>
+#include <Nazara/Core/Simd.hpp>
 #include <Nazara/Core/TaskScheduler.hpp>
 #include <Nazara/Core/Debug.hpp>
 
@@ -15,6 +16,12 @@ bool NzCore::Initialize()
 	if (s_moduleReferenceCounter++ != 0)
 		return true; // Déjà initialisé
 
+	// Les noyaux SIMD dépendent des capacités du processeur, les versions scalaires restent utilisées sinon
+	if (!NzHardwareInfo::Initialize())
+		NazaraWarning("Failed to initialize hardware info");
+
+	NzSimd::Enable(true);
+
 	NazaraNotice("Initialized: Core");
 
 	return true;
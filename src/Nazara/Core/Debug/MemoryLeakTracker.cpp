@@ -3,9 +3,13 @@
 // For conditions of distribution and use, see copyright notice in Config.hpp
 
 #include <Nazara/Core/Debug/MemoryLeakTracker.hpp>
+#include <Nazara/Core/Config.hpp>
+#include <atomic>
+#include <cstdint>
 #include <cstdio>
 #include <cstdlib>
 #include <ctime>
+#include <new>
 #include <stdexcept>
 
 #if defined(NAZARA_PLATFORM_WINDOWS)
@@ -28,30 +32,89 @@
 
 namespace
 {
+	struct FileEntry;
+	struct ThreadList;
+
+	enum BlockTracking : unsigned char
+	{
+		BlockTracking_Global,     // Bloc lié à la liste globale (Suivi exact)
+		BlockTracking_Thread,     // Bloc lié à la liste du thread l'ayant alloué (Bloc échantillonné)
+		BlockTracking_Untracked   // Bloc uniquement comptabilisé (Bloc non-échantillonné)
+	};
+
 	struct Block
 	{
 		std::size_t size;
 		const char* file;
+		FileEntry* usage;
+		ThreadList* owner;
 		Block* prev;
 		Block* next;
+		Block* nextRemoteFree;
 		bool array;
+		BlockTracking tracking;
 		unsigned int line;
 		unsigned int magic;
 	};
 
+	// Compteurs par fichier, dans une table à adressage ouvert remplie sans verrou (La clé est le pointeur __FILE__)
+	struct FileEntry
+	{
+		std::atomic<const char*> file;
+		std::atomic<nzUInt64> allocationCount;
+		std::atomic<std::size_t> currentSize;
+		std::atomic<std::size_t> peakSize;
+	};
+
+	// Chaque thread possède sa propre liste de blocs échantillonnés, qu'il est le seul à modifier
+	// Un bloc libéré par un autre thread est placé dans une pile sans verrou, vidée par le propriétaire lors de sa prochaine allocation
+	// À la fin du thread, la liste devient orpheline : elle n'est alors plus modifiée que sous la protection du mutex global
+	struct ThreadList
+	{
+		Block list;
+		std::atomic<Block*> remoteFrees;
+		std::atomic_bool orphaned;
+		ThreadList* nextList;
+		unsigned int sampleCounter;
+	};
+
+	// Rend la liste du thread orpheline à la fin de celui-ci
+	struct ThreadListGuard
+	{
+		~ThreadListGuard();
+
+		ThreadList* threadList;
+	};
+
 	bool initialized = false;
 	const unsigned int magic = 0x51429EE;
 	const char* MLTFileName = "NazaraLeaks.log";
-	const char* nextFreeFile = "(Internal error)";
-	unsigned int nextFreeLine = 0;
+	thread_local const char* nextFreeFile = "(Internal error)";
+	thread_local unsigned int nextFreeLine = 0;
+
+	const unsigned int fileEntryCount = 1024; // Doit être une puissance de deux
+	FileEntry fileEntries[fileEntryCount];
+	FileEntry overflowEntry; // Utilisée lorsque la table est pleine
+
+	std::atomic<std::size_t> allocatedSize(0);
+	std::atomic<nzUInt64> allocationCount(0);
+	std::atomic<unsigned int> samplingRate(NAZARA_CORE_MEMORYLEAKTRACKER_SAMPLING);
+	std::atomic<ThreadList*> threadLists(nullptr);
+	thread_local ThreadList* currentThreadList = nullptr;
+	thread_local ThreadListGuard threadListGuard;
+	thread_local bool threadListReleased = false;
 
 	Block ptrList =
 	{
 		0,
 		nullptr,
+		nullptr,
+		nullptr,
 		&ptrList,
 		&ptrList,
+		nullptr,
 		false,
+		BlockTracking_Global,
 		0,
 		magic
 	};
@@ -61,6 +124,142 @@ namespace
 	#elif defined(NAZARA_PLATFORM_POSIX)
 	pthread_mutex_t mutex = PTHREAD_MUTEX_INITIALIZER;
 	#endif
+
+	void LockMutex()
+	{
+		#if defined(NAZARA_PLATFORM_WINDOWS)
+		EnterCriticalSection(&mutex);
+		#elif defined(NAZARA_PLATFORM_POSIX)
+		pthread_mutex_lock(&mutex);
+		#endif
+	}
+
+	void UnlockMutex()
+	{
+		#if defined(NAZARA_PLATFORM_WINDOWS)
+		LeaveCriticalSection(&mutex);
+		#elif defined(NAZARA_PLATFORM_POSIX)
+		pthread_mutex_unlock(&mutex);
+		#endif
+	}
+
+	FileEntry* GetFileEntry(const char* file)
+	{
+		static const char* unknownFile = "(Unknown)";
+		if (!file)
+			file = unknownFile;
+
+		std::uintptr_t hash = reinterpret_cast<std::uintptr_t>(file);
+		hash ^= hash >> 17;
+		hash *= 0x9E3779B1U;
+
+		for (unsigned int i = 0; i < fileEntryCount; ++i)
+		{
+			FileEntry& entry = fileEntries[(hash + i) & (fileEntryCount-1)];
+
+			const char* entryFile = entry.file.load(std::memory_order_acquire);
+			if (entryFile == file)
+				return &entry;
+
+			if (!entryFile)
+			{
+				if (entry.file.compare_exchange_strong(entryFile, file, std::memory_order_acq_rel) || entryFile == file)
+					return &entry;
+			}
+		}
+
+		return &overflowEntry;
+	}
+
+	void AddUsage(FileEntry* entry, std::size_t size)
+	{
+		allocatedSize += size;
+		allocationCount++;
+
+		entry->allocationCount++;
+		std::size_t current = (entry->currentSize += size);
+
+		std::size_t peak = entry->peakSize.load(std::memory_order_relaxed);
+		while (current > peak && !entry->peakSize.compare_exchange_weak(peak, current, std::memory_order_relaxed));
+	}
+
+	void RemoveUsage(FileEntry* entry, std::size_t size)
+	{
+		allocatedSize -= size;
+		allocationCount--;
+
+		entry->currentSize -= size;
+	}
+
+	void LinkBlock(Block* list, Block* block)
+	{
+		block->prev = list->prev;
+		block->next = list;
+		list->prev->next = block;
+		list->prev = block;
+	}
+
+	void UnlinkBlock(Block* block)
+	{
+		block->prev->next = block->next;
+		block->next->prev = block->prev;
+	}
+
+	void DrainRemoteFrees(ThreadList* threadList)
+	{
+		if (!threadList->remoteFrees.load(std::memory_order_relaxed))
+			return;
+
+		Block* block = threadList->remoteFrees.exchange(nullptr, std::memory_order_acquire);
+		while (block)
+		{
+			Block* next = block->nextRemoteFree;
+			UnlinkBlock(block);
+			std::free(block);
+
+			block = next;
+		}
+	}
+
+	ThreadList* GetThreadList()
+	{
+		// Pendant la destruction des variables du thread, les allocations retombent sur la liste globale
+		if (!currentThreadList && !threadListReleased)
+		{
+			// Les listes ne sont jamais libérées: les blocs d'un thread terminé doivent rester visibles lors du rapport final
+			ThreadList* threadList = new (std::malloc(sizeof(ThreadList))) ThreadList;
+			threadList->list.prev = &threadList->list;
+			threadList->list.next = &threadList->list;
+			threadList->orphaned = false;
+			threadList->remoteFrees = nullptr;
+			threadList->sampleCounter = 0;
+
+			threadList->nextList = threadLists.load(std::memory_order_relaxed);
+			while (!threadLists.compare_exchange_weak(threadList->nextList, threadList, std::memory_order_release));
+
+			currentThreadList = threadList;
+			threadListGuard.threadList = threadList;
+		}
+
+		return currentThreadList;
+	}
+
+	ThreadListGuard::~ThreadListGuard()
+	{
+		if (!threadList)
+			return;
+
+		currentThreadList = nullptr;
+		threadListReleased = true;
+
+		// Les libérations publiées avant que le drapeau ne soit visible sont appliquées ici, les suivantes le seront
+		// directement par le thread qui libère (Voir NzMemoryManager::Free)
+		threadList->orphaned = true;
+
+		LockMutex();
+		DrainRemoteFrees(threadList);
+		UnlockMutex();
+	}
 }
 
 NzMemoryManager::NzMemoryManager()
@@ -77,12 +276,6 @@ void* NzMemoryManager::Allocate(std::size_t size, bool multi, const char* file,
 	if (!initialized)
 		Initialize();
 
-	#if defined(NAZARA_PLATFORM_WINDOWS)
-	EnterCriticalSection(&mutex);
-	#elif defined(NAZARA_PLATFORM_POSIX)
-	pthread_mutex_lock(&mutex);
-	#endif
-
 	Block* ptr = reinterpret_cast<Block*>(std::malloc(size+sizeof(Block)));
 	if (!ptr)
 	{
@@ -99,17 +292,41 @@ void* NzMemoryManager::Allocate(std::size_t size, bool multi, const char* file,
 	ptr->line = line;
 	ptr->size = size;
 	ptr->magic = magic;
+	ptr->nextRemoteFree = nullptr;
+	ptr->owner = nullptr;
+	ptr->usage = GetFileEntry(file);
 
-	ptr->prev = ptrList.prev;
-	ptr->next = &ptrList;
-	ptrList.prev->next = ptr;
-	ptrList.prev = ptr;
+	AddUsage(ptr->usage, size);
 
-	#if defined(NAZARA_PLATFORM_WINDOWS)
-	LeaveCriticalSection(&mutex);
-	#elif defined(NAZARA_PLATFORM_POSIX)
-	pthread_mutex_unlock(&mutex);
-	#endif
+	// Les libérations confiées par les autres threads sont appliquées à chaque allocation, échantillonnée ou non,
+	// pour que la pile ne grossisse pas lorsque l'échantillonnage est désactivé
+	unsigned int rate = samplingRate.load(std::memory_order_relaxed);
+	ThreadList* threadList = (rate == 0) ? currentThreadList : GetThreadList();
+	if (threadList)
+		DrainRemoteFrees(threadList);
+
+	if (rate == 0 || !threadList)
+	{
+		ptr->tracking = BlockTracking_Global;
+
+		LockMutex();
+		LinkBlock(&ptrList, ptr);
+		UnlockMutex();
+	}
+	else
+	{
+		if (++threadList->sampleCounter >= rate)
+		{
+			threadList->sampleCounter = 0;
+
+			ptr->owner = threadList;
+			ptr->tracking = BlockTracking_Thread;
+
+			LinkBlock(&threadList->list, ptr);
+		}
+		else
+			ptr->tracking = BlockTracking_Untracked;
+	}
 
 	return reinterpret_cast<char*>(ptr)+sizeof(Block);
 }
@@ -123,12 +340,6 @@ void NzMemoryManager::Free(void* pointer, bool multi)
 	if (ptr->magic != magic)
 		return;
 
-	#if defined(NAZARA_PLATFORM_WINDOWS)
-	EnterCriticalSection(&mutex);
-	#elif defined(NAZARA_PLATFORM_POSIX)
-	pthread_mutex_lock(&mutex);
-	#endif
-
 	if (ptr->array != multi)
 	{
 		char* time = TimeInfo();
@@ -156,19 +367,138 @@ void NzMemoryManager::Free(void* pointer, bool multi)
 	}
 
 	ptr->magic = 0;
-	ptr->prev->next = ptr->next;
-	ptr->next->prev = ptr->prev;
-
-	std::free(ptr);
-
 	nextFreeFile = nullptr;
 	nextFreeLine = 0;
 
-	#if defined(NAZARA_PLATFORM_WINDOWS)
-	LeaveCriticalSection(&mutex);
-	#elif defined(NAZARA_PLATFORM_POSIX)
-	pthread_mutex_unlock(&mutex);
-	#endif
+	RemoveUsage(ptr->usage, ptr->size);
+
+	switch (ptr->tracking)
+	{
+		case BlockTracking_Global:
+			LockMutex();
+			UnlinkBlock(ptr);
+			UnlockMutex();
+
+			std::free(ptr);
+			break;
+
+		case BlockTracking_Thread:
+		{
+			ThreadList* owner = ptr->owner;
+			if (owner == currentThreadList)
+			{
+				UnlinkBlock(ptr);
+				std::free(ptr);
+			}
+			else if (owner->orphaned)
+			{
+				// Le propriétaire est terminé, sa liste est désormais protégée par le mutex global
+				LockMutex();
+				UnlinkBlock(ptr);
+				UnlockMutex();
+
+				std::free(ptr);
+			}
+			else
+			{
+				// Seul le propriétaire peut modifier sa liste, on lui confie donc la libération
+				ptr->nextRemoteFree = owner->remoteFrees.load(std::memory_order_relaxed);
+				while (!owner->remoteFrees.compare_exchange_weak(ptr->nextRemoteFree, ptr));
+
+				// Le propriétaire a pu se terminer après avoir vidé sa pile une dernière fois, le bloc serait alors oublié
+				if (owner->orphaned)
+				{
+					LockMutex();
+					DrainRemoteFrees(owner);
+					UnlockMutex();
+				}
+			}
+			break;
+		}
+
+		case BlockTracking_Untracked:
+			std::free(ptr);
+			break;
+	}
+}
+
+std::size_t NzMemoryManager::GetAllocatedSize()
+{
+	return allocatedSize;
+}
+
+nzUInt64 NzMemoryManager::GetAllocationCount()
+{
+	return allocationCount;
+}
+
+unsigned int NzMemoryManager::GetFileUsage(FileUsage* usages, unsigned int maxCount)
+{
+	// Les compteurs sont lus au vol, sans interrompre les autres threads (Le résultat est donc approximatif pendant les allocations)
+	// Un même fichier peut occuper plusieurs entrées (Chaîne __FILE__ dupliquée entre unités de compilation), on les fusionne
+	unsigned int count = 0;
+	for (unsigned int i = 0; i <= fileEntryCount; ++i)
+	{
+		FileEntry& entry = (i < fileEntryCount) ? fileEntries[i] : overflowEntry;
+
+		const char* file = (i < fileEntryCount) ? entry.file.load(std::memory_order_acquire) : "(Overflow)";
+		nzUInt64 entryAllocationCount = entry.allocationCount;
+		if (!file || entryAllocationCount == 0)
+			continue;
+
+		FileUsage* usage = nullptr;
+		for (unsigned int j = 0; j < count; ++j)
+		{
+			if (std::strcmp(usages[j].file, file) == 0)
+			{
+				usage = &usages[j];
+				break;
+			}
+		}
+
+		if (!usage)
+		{
+			if (count >= maxCount)
+				continue;
+
+			usage = &usages[count++];
+			usage->file = file;
+			usage->allocationCount = 0;
+			usage->currentSize = 0;
+			usage->peakSize = 0;
+		}
+
+		usage->allocationCount += entryAllocationCount;
+		usage->currentSize += entry.currentSize;
+		usage->peakSize += entry.peakSize;
+	}
+
+	return count;
+}
+
+std::size_t NzMemoryManager::GetModuleAllocatedSize(const char* module)
+{
+	// Un module regroupe les fichiers de Nazara/<Module>/ (Sources comme headers)
+	char pattern[64];
+	std::snprintf(pattern, 64, "Nazara/%s/", module);
+
+	char alternatePattern[64];
+	std::snprintf(alternatePattern, 64, "Nazara\\%s\\", module);
+
+	std::size_t size = 0;
+	for (unsigned int i = 0; i < fileEntryCount; ++i)
+	{
+		const char* file = fileEntries[i].file.load(std::memory_order_acquire);
+		if (file && (std::strstr(file, pattern) || std::strstr(file, alternatePattern)))
+			size += fileEntries[i].currentSize;
+	}
+
+	return size;
+}
+
+unsigned int NzMemoryManager::GetSamplingRate()
+{
+	return samplingRate;
 }
 
 void NzMemoryManager::NextFree(const char* file, unsigned int line)
@@ -177,6 +507,12 @@ void NzMemoryManager::NextFree(const char* file, unsigned int line)
 	nextFreeLine = line;
 }
 
+void NzMemoryManager::SetSamplingRate(unsigned int rate)
+{
+	// Chaque bloc retient la façon dont il est suivi, le changement peut donc se faire à tout moment
+	samplingRate = rate;
+}
+
 void NzMemoryManager::Initialize()
 {
 	char* time = TimeInfo();
@@ -217,13 +553,17 @@ void NzMemoryManager::Uninitialize()
 	DeleteCriticalSection(&mutex);
 	#endif
 
+	// Les libérations en attente dans les listes par thread doivent être appliquées avant de chercher les leaks
+	for (ThreadList* threadList = threadLists; threadList; threadList = threadList->nextList)
+		DrainRemoteFrees(threadList);
+
 	FILE* log = std::fopen(MLTFileName, "a");
 
 	char* time = TimeInfo();
 
 	std::fprintf(log, "%s Application finished, checking leaks...\n", time);
 
-	if (ptrList.next == &ptrList)
+	if (allocationCount == 0)
 	{
 		std::fprintf(log, "%s ==============================\n", time);
 		std::fprintf(log, "%s        No leak detected       \n", time);
@@ -237,23 +577,35 @@ void NzMemoryManager::Uninitialize()
 		std::fputs("Leak list:\n", log);
 
 		std::size_t totalSize = 0;
-		Block* ptr = ptrList.next;
 		unsigned int count = 0;
-		while (ptr != &ptrList)
-		{
-			count++;
-			totalSize += ptr->size;
-			if (ptr->file)
-				std::fprintf(log, "-0x%p -> " SIZE_T_SPECIFIER " bytes allocated at %s:%u\n", reinterpret_cast<char*>(ptr)+sizeof(Block), ptr->size, ptr->file, ptr->line);
-			else
-				std::fprintf(log, "-0x%p -> " SIZE_T_SPECIFIER " bytes allocated at unknown position\n", reinterpret_cast<char*>(ptr)+sizeof(Block), ptr->size);
 
-			void* pointer = ptr;
-			ptr = ptr->next;
-			std::free(pointer);
-		}
+		auto ReportList = [&](Block* list)
+		{
+			Block* ptr = list->next;
+			while (ptr != list)
+			{
+				count++;
+				totalSize += ptr->size;
+				if (ptr->file)
+					std::fprintf(log, "-0x%p -> " SIZE_T_SPECIFIER " bytes allocated at %s:%u\n", reinterpret_cast<char*>(ptr)+sizeof(Block), ptr->size, ptr->file, ptr->line);
+				else
+					std::fprintf(log, "-0x%p -> " SIZE_T_SPECIFIER " bytes allocated at unknown position\n", reinterpret_cast<char*>(ptr)+sizeof(Block), ptr->size);
+
+				void* pointer = ptr;
+				ptr = ptr->next;
+				std::free(pointer);
+			}
+		};
+
+		ReportList(&ptrList);
+		for (ThreadList* threadList = threadLists; threadList; threadList = threadList->nextList)
+			ReportList(&threadList->list);
 
 		std::fprintf(log, "\n%u blocks leaked (" SIZE_T_SPECIFIER " bytes)", count, totalSize);
+
+		// En mode échantillonné, seule une partie des blocs est listée, les compteurs donnent néanmoins le total exact
+		if (allocationCount != count)
+			std::fprintf(log, "\n%llu blocks still allocated in total (" SIZE_T_SPECIFIER " bytes), only sampled blocks are listed", static_cast<unsigned long long>(allocationCount.load()), allocatedSize.load());
 	}
 
 	std::free(time);
@@ -19,6 +19,13 @@
 	#error OS not handled
 #endif
 
+// Les en-têtes inclus après File.hpp (StringStream notamment) ont pu désactiver les macros de verrouillage
+#if NAZARA_CORE_THREADSAFE && NAZARA_THREADSAFETY_FILE
+#include <Nazara/Core/ThreadSafety.hpp>
+#else
+#include <Nazara/Core/ThreadSafetyOff.hpp>
+#endif
+
 #include <Nazara/Core/Debug.hpp>
 
 NzFile::NzFile() :
@@ -66,31 +73,27 @@ bool NzFile::Copy(const NzString& newFilePath)
 
 void NzFile::Close()
 {
-	NazaraLock(m_mutex)
+	NazaraWriteLock(m_mutex)
 
-	if (m_impl)
-	{
-		m_impl->Close();
-		delete m_impl;
-		m_impl = nullptr;
-	}
+	CloseFile();
 }
 
 bool NzFile::Delete()
 {
-	NazaraLock(m_mutex)
+	NazaraWriteLock(m_mutex)
 
-	Close();
+	CloseFile();
 
 	return Delete(m_filePath);
 }
 
 bool NzFile::EndOfFile() const
 {
-	NazaraLock(m_mutex)
+	// L'implémentation met en cache l'état de fin de fichier, le verrou doit donc être exclusif
+	NazaraWriteLock(m_mutex)
 
 	#if NAZARA_CORE_SAFE
-	if (!IsOpen())
+	if (!m_impl)
 	{
 		NazaraError("File not opened");
 		return false;
@@ -107,9 +110,9 @@ bool NzFile::EndOfStream() const
 
 bool NzFile::Exists() const
 {
-	NazaraLock(m_mutex)
+	NazaraReadLock(m_mutex)
 
-	if (IsOpen())
+	if (m_impl)
 		return true; // Le fichier est ouvert, donc il existe
 	else
 		return Exists(m_filePath);
@@ -117,10 +120,10 @@ bool NzFile::Exists() const
 
 void NzFile::Flush()
 {
-	NazaraLock(m_mutex)
+	NazaraWriteLock(m_mutex)
 
 	#if NAZARA_CORE_SAFE
-	if (!IsOpen())
+	if (!m_impl)
 	{
 		NazaraError("File not opened");
 		return;
@@ -138,17 +141,17 @@ void NzFile::Flush()
 
 time_t NzFile::GetCreationTime() const
 {
-	NazaraLock(m_mutex)
+	NazaraReadLock(m_mutex)
 
 	return GetCreationTime(m_filePath);
 }
 
 nzUInt64 NzFile::GetCursorPos() const
 {
-	NazaraLock(m_mutex)
+	NazaraReadLock(m_mutex)
 
 	#if NAZARA_CORE_SAFE
-	if (!IsOpen())
+	if (!m_impl)
 	{
 		NazaraError("File not opened");
 		return false;
@@ -160,59 +163,59 @@ nzUInt64 NzFile::GetCursorPos() const
 
 NzString NzFile::GetDirectory() const
 {
-	NazaraLock(m_mutex)
+	NazaraReadLock(m_mutex)
 
 	return m_filePath.SubStringTo(NAZARA_DIRECTORY_SEPARATOR, -1, true, true);
 }
 
 NzString NzFile::GetFileName() const
 {
-	NazaraLock(m_mutex)
+	NazaraReadLock(m_mutex)
 
 	return m_filePath.SubStringFrom(NAZARA_DIRECTORY_SEPARATOR, -1, true);
 }
 
 time_t NzFile::GetLastAccessTime() const
 {
-	NazaraLock(m_mutex)
+	NazaraReadLock(m_mutex)
 
 	return GetLastAccessTime(m_filePath);
 }
 
 time_t NzFile::GetLastWriteTime() const
 {
-	NazaraLock(m_mutex)
+	NazaraReadLock(m_mutex)
 
 	return GetLastWriteTime(m_filePath);
 }
 
 NzString NzFile::GetPath() const
 {
-	NazaraLock(m_mutex)
+	NazaraReadLock(m_mutex)
 
 	return m_filePath;
 }
 
 nzUInt64 NzFile::GetSize() const
 {
-	NazaraLock(m_mutex)
+	NazaraReadLock(m_mutex)
 
 	return GetSize(m_filePath);
 }
 
 bool NzFile::IsOpen() const
 {
-	NazaraLock(m_mutex)
+	NazaraReadLock(m_mutex)
 
 	return m_impl != nullptr;
 }
 
 std::size_t NzFile::Read(void* buffer, std::size_t size)
 {
-	NazaraLock(m_mutex)
+	NazaraWriteLock(m_mutex)
 
 	#if NAZARA_CORE_SAFE
-	if (!IsOpen())
+	if (!m_impl)
 	{
 		NazaraError("File not opened");
 		return 0;
@@ -257,59 +260,68 @@ std::size_t NzFile::Read(void* buffer, std::size_t typeSize, unsigned int count)
 	return byteRead;
 }
 
+std::size_t NzFile::ReadAt(void* buffer, std::size_t size, nzUInt64 offset)
+{
+	// Un verrou en lecture suffit: la lecture positionnelle ne dépend pas du curseur et peut être faite depuis plusieurs threads à la fois
+	// (Il empêche seulement la fermeture ou la réouverture du fichier pendant la lecture)
+	NazaraReadLock(m_mutex)
+
+	#if NAZARA_CORE_SAFE
+	if (!m_impl)
+	{
+		NazaraError("File not opened");
+		return 0;
+	}
+
+	if ((m_openMode & ReadOnly) == 0 && (m_openMode & ReadWrite) == 0)
+	{
+		NazaraError("File not opened with read access");
+		return 0;
+	}
+
+	if (!buffer)
+	{
+		NazaraError("Invalid buffer");
+		return 0;
+	}
+	#endif
+
+	if (size == 0)
+		return 0;
+
+	return m_impl->ReadAt(buffer, size, offset);
+}
+
 bool NzFile::Rename(const NzString& newFilePath)
 {
-	NazaraLock(m_mutex)
+	NazaraWriteLock(m_mutex)
 
-	bool opened = IsOpen();
-	Close();
+	bool opened = (m_impl != nullptr);
+	CloseFile();
 
 	bool success = Rename(m_filePath, newFilePath);
 	if (success)
 		m_filePath = NormalizePath(newFilePath);
 
 	if (opened)
-		Open();
+		OpenFile(0);
 
 	return success;
 }
 
 bool NzFile::Open(unsigned long openMode)
 {
-	NazaraLock(m_mutex)
-
-	Close();
-
-	if (m_filePath.IsEmpty())
-		return false;
-
-	if (openMode != 0)
-		m_openMode = openMode;
-
-	if (m_openMode == 0)
-		return false;
+	NazaraWriteLock(m_mutex)
 
-	m_impl = new NzFileImpl(this);
-	if (!m_impl->Open(m_filePath, m_openMode))
-	{
-		delete m_impl;
-		m_impl = nullptr;
-
-		return false;
-	}
-
-	if (m_openMode & Text)
-		m_streamOptions |= nzStreamOption_Text;
-
-	return true;
+	return OpenFile(openMode);
 }
 
 bool NzFile::SetCursorPos(CursorPosition pos, nzInt64 offset)
 {
-	NazaraLock(m_mutex)
+	NazaraWriteLock(m_mutex)
 
 	#if NAZARA_CORE_SAFE
-	if (!IsOpen())
+	if (!m_impl)
 	{
 		NazaraError("File not opened");
 		return false;
@@ -321,10 +333,10 @@ bool NzFile::SetCursorPos(CursorPosition pos, nzInt64 offset)
 
 bool NzFile::SetCursorPos(nzUInt64 offset)
 {
-	NazaraLock(m_mutex)
+	NazaraWriteLock(m_mutex)
 
 	#if NAZARA_CORE_SAFE
-	if (!IsOpen())
+	if (!m_impl)
 	{
 		NazaraError("File not opened");
 		return false;
@@ -336,16 +348,16 @@ bool NzFile::SetCursorPos(nzUInt64 offset)
 
 void NzFile::SetEndianness(nzEndianness endianness)
 {
-	NazaraLock(m_mutex)
+	NazaraWriteLock(m_mutex)
 
 	m_endianness = endianness;
 }
 
 bool NzFile::SetFile(const NzString& filePath)
 {
-	NazaraLock(m_mutex)
+	NazaraWriteLock(m_mutex)
 
-	if (IsOpen())
+	if (m_impl)
 	{
 		if (filePath.IsEmpty())
 			return false;
@@ -369,12 +381,12 @@ bool NzFile::SetFile(const NzString& filePath)
 
 bool NzFile::SetOpenMode(unsigned int openMode)
 {
-	NazaraLock(m_mutex)
+	NazaraWriteLock(m_mutex)
 
 	if (openMode == 0 || openMode == m_openMode)
 		return true;
 
-	if (IsOpen())
+	if (m_impl)
 	{
 		NzFileImpl* impl = new NzFileImpl(this);
 		if (!impl->Open(m_filePath, openMode))
@@ -429,10 +441,10 @@ bool NzFile::Write(const NzString& string)
 
 std::size_t NzFile::Write(const void* buffer, std::size_t typeSize, unsigned int count)
 {
-	NazaraLock(m_mutex)
+	NazaraWriteLock(m_mutex)
 
 	#if NAZARA_CORE_SAFE
-	if (!IsOpen())
+	if (!m_impl)
 	{
 		NazaraError("File not opened");
 		return 0;
@@ -476,7 +488,7 @@ NzFile& NzFile::operator=(const NzString& filePath)
 
 NzFile& NzFile::operator=(NzFile&& file) noexcept
 {
-	NazaraLock(m_mutex)
+	NazaraWriteLock(m_mutex)
 
 	std::swap(m_endianness, file.m_endianness);
 	std::swap(m_filePath, file.m_filePath);
@@ -711,6 +723,16 @@ bool NzFile::Rename(const NzString& sourcePath, const NzString& targetPath)
 	return NzFileImpl::Rename(NormalizePath(sourcePath), NormalizePath(targetPath));
 }
 
+void NzFile::CloseFile()
+{
+	if (m_impl)
+	{
+		m_impl->Close();
+		delete m_impl;
+		m_impl = nullptr;
+	}
+}
+
 bool NzFile::FillHash(NzAbstractHash* hash) const
 {
 	NzFile file(m_filePath);
@@ -739,3 +761,31 @@ bool NzFile::FillHash(NzAbstractHash* hash) const
 
 	return true;
 } // Fermeture automatique du fichier
+
+bool NzFile::OpenFile(unsigned long openMode)
+{
+	CloseFile();
+
+	if (m_filePath.IsEmpty())
+		return false;
+
+	if (openMode != 0)
+		m_openMode = openMode;
+
+	if (m_openMode == 0)
+		return false;
+
+	m_impl = new NzFileImpl(this);
+	if (!m_impl->Open(m_filePath, m_openMode))
+	{
+		delete m_impl;
+		m_impl = nullptr;
+
+		return false;
+	}
+
+	if (m_openMode & Text)
+		m_streamOptions |= nzStreamOption_Text;
+
+	return true;
+}
@@ -0,0 +1,296 @@
+// Copyright (C) 2014 Jérôme Leclercq
+// This file is part of the "Nazara Engine - Core module"
+// For conditions of distribution and use, see copyright notice in Config.hpp
+
+#include <Nazara/Core/FileTreeHash.hpp>
+#include <Nazara/Core/AbstractHash.hpp>
+#include <Nazara/Core/Config.hpp>
+#include <Nazara/Core/Endianness.hpp>
+#include <Nazara/Core/Error.hpp>
+#include <Nazara/Core/File.hpp>
+#include <Nazara/Core/Hash.hpp>
+#include <Nazara/Core/TaskScheduler.hpp>
+#include <algorithm>
+#include <atomic>
+#include <memory>
+#include <Nazara/Core/Debug.hpp>
+
+namespace
+{
+	struct HashContext
+	{
+		const std::vector<unsigned int>* chunks;
+		std::vector<NzHashDigest>* digests;
+		std::atomic_bool error;
+		NzFile* file;
+		nzHash hash;
+		nzUInt64 fileSize;
+		unsigned int chunkSize;
+	};
+
+	// Taille maximale lue d'un coup, pour ne pas allouer un morceau entier par tâche
+	const unsigned int readBufferSize = 256*1024;
+
+	void HashChunkRange(HashContext* context, unsigned int first, unsigned int step)
+	{
+		std::unique_ptr<NzAbstractHash> hash(NzHash::Create(context->hash));
+		std::unique_ptr<nzUInt8[]> buffer(new nzUInt8[std::min(context->chunkSize, readBufferSize)]);
+
+		const std::vector<unsigned int>& chunks = *context->chunks;
+		for (unsigned int i = first; i < chunks.size() && !context->error; i += step)
+		{
+			unsigned int chunk = chunks[i];
+
+			nzUInt64 offset = static_cast<nzUInt64>(chunk)*context->chunkSize;
+			nzUInt64 remaining = std::min<nzUInt64>(context->chunkSize, context->fileSize - offset);
+
+			hash->Begin();
+			while (remaining > 0)
+			{
+				unsigned int size = static_cast<unsigned int>(std::min<nzUInt64>(remaining, readBufferSize));
+				if (context->file->ReadAt(buffer.get(), size, offset) != size)
+				{
+					context->error = true;
+					break;
+				}
+
+				hash->Append(buffer.get(), size);
+				offset += size;
+				remaining -= size;
+			}
+
+			(*context->digests)[chunk] = hash->End();
+		}
+	}
+}
+
+NzFileTreeHash::NzFileTreeHash(nzHash hash, unsigned int chunkSize) :
+m_hash(hash),
+m_fileSize(0),
+m_lastWriteTime(0),
+m_chunkSize(chunkSize)
+{
+	#if NAZARA_CORE_SAFE
+	if (m_chunkSize == 0)
+	{
+		NazaraError("Chunk size must be over zero");
+		m_chunkSize = 4*1024*1024;
+	}
+	#endif
+}
+
+void NzFileTreeHash::Clear()
+{
+	m_chunkDigests.clear();
+	m_filePath.Clear();
+	m_fileSize = 0;
+	m_invalidatedChunks.clear();
+	m_lastWriteTime = 0;
+	m_rootDigest = NzHashDigest();
+}
+
+bool NzFileTreeHash::Compute(const NzString& filePath)
+{
+	Clear();
+
+	m_filePath = NzFile::NormalizePath(filePath);
+	if (!NzFile::Exists(m_filePath))
+	{
+		NazaraError("File \"" + m_filePath + "\" does not exist");
+		m_filePath.Clear();
+
+		return false;
+	}
+
+	if (!Update())
+	{
+		Clear();
+		return false;
+	}
+
+	return true;
+}
+
+unsigned int NzFileTreeHash::GetChunkCount() const
+{
+	return m_chunkDigests.size();
+}
+
+const NzHashDigest& NzFileTreeHash::GetChunkDigest(unsigned int chunk) const
+{
+	#if NAZARA_CORE_SAFE
+	if (chunk >= m_chunkDigests.size())
+	{
+		NazaraError("Chunk index out of range (" + NzString::Number(chunk) + " >= " + NzString::Number(m_chunkDigests.size()) + ')');
+
+		static NzHashDigest dummy;
+		return dummy;
+	}
+	#endif
+
+	return m_chunkDigests[chunk];
+}
+
+unsigned int NzFileTreeHash::GetChunkSize() const
+{
+	return m_chunkSize;
+}
+
+const NzString& NzFileTreeHash::GetFilePath() const
+{
+	return m_filePath;
+}
+
+nzUInt64 NzFileTreeHash::GetFileSize() const
+{
+	return m_fileSize;
+}
+
+const NzHashDigest& NzFileTreeHash::GetRootDigest() const
+{
+	return m_rootDigest;
+}
+
+void NzFileTreeHash::Invalidate(nzUInt64 offset, nzUInt64 size)
+{
+	if (size == 0 || offset >= m_fileSize)
+		return;
+
+	unsigned int firstChunk = static_cast<unsigned int>(offset/m_chunkSize);
+	unsigned int lastChunk = static_cast<unsigned int>(std::min(offset + size - 1, m_fileSize - 1)/m_chunkSize);
+	for (unsigned int i = firstChunk; i <= lastChunk; ++i)
+		m_invalidatedChunks[i] = true;
+}
+
+bool NzFileTreeHash::IsUpToDate() const
+{
+	if (!IsValid())
+		return false;
+
+	if (std::find(m_invalidatedChunks.begin(), m_invalidatedChunks.end(), true) != m_invalidatedChunks.end())
+		return false;
+
+	return NzFile::GetSize(m_filePath) == m_fileSize && NzFile::GetLastWriteTime(m_filePath) == m_lastWriteTime;
+}
+
+bool NzFileTreeHash::IsValid() const
+{
+	return m_rootDigest.IsValid();
+}
+
+bool NzFileTreeHash::Update(unsigned int* rehashedChunkCount)
+{
+	#if NAZARA_CORE_SAFE
+	if (m_filePath.IsEmpty())
+	{
+		NazaraError("No file");
+		return false;
+	}
+	#endif
+
+	if (rehashedChunkCount)
+		*rehashedChunkCount = 0;
+
+	nzUInt64 fileSize = NzFile::GetSize(m_filePath);
+	time_t lastWriteTime = NzFile::GetLastWriteTime(m_filePath);
+
+	bool modified = (!IsValid() || fileSize != m_fileSize || lastWriteTime != m_lastWriteTime);
+	bool invalidated = (std::find(m_invalidatedChunks.begin(), m_invalidatedChunks.end(), true) != m_invalidatedChunks.end());
+	if (!modified && !invalidated)
+		return true; // Rien n'a changé
+
+	unsigned int oldChunkCount = m_chunkDigests.size();
+	unsigned int chunkCount = static_cast<unsigned int>((fileSize + m_chunkSize - 1)/m_chunkSize);
+
+	// Un morceau doit être rehashé s'il a été invalidé, s'il est concerné par le changement de taille,
+	// ou si le fichier a été modifié sans que l'on sache où (Auquel cas tout est rehashé)
+	bool rehashAll = !IsValid() || (modified && !invalidated);
+	unsigned int firstResizedChunk = static_cast<unsigned int>(std::min(fileSize, m_fileSize)/m_chunkSize);
+
+	std::vector<unsigned int> chunks;
+	for (unsigned int i = 0; i < chunkCount; ++i)
+	{
+		if (rehashAll || i >= oldChunkCount || (fileSize != m_fileSize && i >= firstResizedChunk) || m_invalidatedChunks[i])
+			chunks.push_back(i);
+	}
+
+	m_chunkDigests.resize(chunkCount);
+	m_invalidatedChunks.assign(chunkCount, false);
+	m_fileSize = fileSize;
+	m_lastWriteTime = lastWriteTime;
+
+	if (!HashChunks(chunks))
+	{
+		m_rootDigest = NzHashDigest();
+		return false;
+	}
+
+	UpdateRoot();
+
+	if (rehashedChunkCount)
+		*rehashedChunkCount = chunks.size();
+
+	return true;
+}
+
+bool NzFileTreeHash::HashChunks(const std::vector<unsigned int>& chunks)
+{
+	if (chunks.empty())
+		return true;
+
+	NzFile file(m_filePath);
+	if (!file.Open(NzFile::ReadOnly))
+	{
+		NazaraError("Failed to open file \"" + m_filePath + '"');
+		return false;
+	}
+
+	HashContext context;
+	context.chunks = &chunks;
+	context.chunkSize = m_chunkSize;
+	context.digests = &m_chunkDigests;
+	context.error = false;
+	context.file = &file;
+	context.fileSize = m_fileSize;
+	context.hash = m_hash;
+
+	// Chaque tâche traite un morceau sur taskCount et possède son propre hash et son propre tampon,
+	// les lectures positionnelles permettant de partager le même fichier
+	unsigned int taskCount = (NzTaskScheduler::IsInitialized()) ? std::min<unsigned int>(NzTaskScheduler::GetWorkerCount(), chunks.size()) : 1;
+	if (taskCount > 1)
+	{
+		for (unsigned int i = 0; i < taskCount; ++i)
+			NzTaskScheduler::AddTask(HashChunkRange, &context, i, taskCount);
+
+		NzTaskScheduler::Run();
+		NzTaskScheduler::WaitForTasks();
+	}
+	else
+		HashChunkRange(&context, 0, 1);
+
+	if (context.error)
+	{
+		NazaraError("Failed to read file \"" + m_filePath + '"');
+		return false;
+	}
+
+	return true;
+}
+
+void NzFileTreeHash::UpdateRoot()
+{
+	// Le hash racine couvre la taille du fichier et la suite des hashs des morceaux
+	std::unique_ptr<NzAbstractHash> hash(NzHash::Create(m_hash));
+	hash->Begin();
+
+	nzUInt64 fileSize = m_fileSize;
+	#ifdef NAZARA_BIG_ENDIAN
+	NzByteSwap(&fileSize, sizeof(nzUInt64));
+	#endif
+
+	hash->Append(reinterpret_cast<const nzUInt8*>(&fileSize), sizeof(nzUInt64));
+	for (const NzHashDigest& digest : m_chunkDigests)
+		hash->Append(digest.GetDigest(), digest.GetDigestLength());
+
+	m_rootDigest = hash->End();
+}
@@ -3,6 +3,7 @@
 // For conditions of distribution and use, see copyright notice in Config.hpp
 
 #include <Nazara/Core/Hash.hpp>
+#include <Nazara/Core/Error.hpp>
 #include <Nazara/Core/Hash/CRC32.hpp>
 #include <Nazara/Core/Hash/Fletcher16.hpp>
 #include <Nazara/Core/Hash/MD5.hpp>
@@ -12,48 +13,12 @@
 #include <Nazara/Core/Hash/SHA384.hpp>
 #include <Nazara/Core/Hash/SHA512.hpp>
 #include <Nazara/Core/Hash/Whirlpool.hpp>
+#include <Nazara/Core/Hash/XXH64.hpp>
 #include <Nazara/Core/Debug.hpp>
 
-NzHash::NzHash(nzHash hash)
+NzHash::NzHash(nzHash hash) :
+m_impl(Create(hash))
 {
-	switch (hash)
-	{
-		case nzHash_Fletcher16:
-			m_impl = new NzHashFletcher16;
-			break;
-
-		case nzHash_CRC32:
-			m_impl = new NzHashCRC32;
-			break;
-
-		case nzHash_MD5:
-			m_impl = new NzHashMD5;
-			break;
-
-		case nzHash_SHA1:
-			m_impl = new NzHashSHA1;
-			break;
-
-		case nzHash_SHA224:
-			m_impl = new NzHashSHA224;
-			break;
-
-		case nzHash_SHA256:
-			m_impl = new NzHashSHA256;
-			break;
-
-		case nzHash_SHA384:
-			m_impl = new NzHashSHA384;
-			break;
-
-		case nzHash_SHA512:
-			m_impl = new NzHashSHA512;
-			break;
-
-		case nzHash_Whirlpool:
-			m_impl = new NzHashWhirlpool;
-			break;
-	}
 }
 
 NzHash::NzHash(NzAbstractHash* hashImpl) :
@@ -78,3 +43,42 @@ NzHashDigest NzHash::Hash(const NzHashable& hashable)
 		return NzHashDigest();
 	}
 }
+
+NzAbstractHash* NzHash::Create(nzHash hash)
+{
+	switch (hash)
+	{
+		case nzHash_Fletcher16:
+			return new NzHashFletcher16;
+
+		case nzHash_CRC32:
+			return new NzHashCRC32;
+
+		case nzHash_MD5:
+			return new NzHashMD5;
+
+		case nzHash_SHA1:
+			return new NzHashSHA1;
+
+		case nzHash_SHA224:
+			return new NzHashSHA224;
+
+		case nzHash_SHA256:
+			return new NzHashSHA256;
+
+		case nzHash_SHA384:
+			return new NzHashSHA384;
+
+		case nzHash_SHA512:
+			return new NzHashSHA512;
+
+		case nzHash_Whirlpool:
+			return new NzHashWhirlpool;
+
+		case nzHash_XXH64:
+			return new NzHashXXH64;
+	}
+
+	NazaraError("Hash type not handled (0x" + NzString::Number(hash, 16) + ')');
+	return nullptr;
+}
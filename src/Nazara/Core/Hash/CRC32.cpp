@@ -4,12 +4,13 @@
 
 #include <Nazara/Core/Hash/CRC32.hpp>
 #include <Nazara/Core/Endianness.hpp>
+#include <cstring>
 #include <Nazara/Core/Debug.hpp>
 
 struct NzHashCRC32_state
 {
 	nzUInt32 crc;
-	const nzUInt32* table;
+	const nzUInt32 (*table)[256]; // Huit tables pour le découpage par tranches de huit octets (slicing-by-8)
 };
 
 namespace
@@ -63,6 +64,34 @@ namespace
 		0xbdbdf21c, 0xcabac28a, 0x53b39330, 0x24b4a3a6, 0xbad03605, 0xcdd70693, 0x54de5729, 0x23d967bf,
 		0xb3667a2e, 0xc4614ab8, 0x5d681b02, 0x2a6f2b94, 0xb40bbe37, 0xc30c8ea1, 0x5a05df1b, 0x2d02ef8d
 	};
+
+	// La table k donne la contribution d'un octet suivi de k octets nuls
+	void crc32_buildSlices(nzUInt32 (*tables)[256])
+	{
+		for (unsigned int i = 0; i < 256; ++i)
+		{
+			for (unsigned int k = 1; k < 8; ++k)
+				tables[k][i] = (tables[k-1][i] >> 8) ^ tables[0][tables[k-1][i] & 0xFF];
+		}
+	}
+
+	struct crc32_slicedTable
+	{
+		crc32_slicedTable()
+		{
+			std::memcpy(tables[0], crc32_table, sizeof(crc32_table));
+			crc32_buildSlices(tables);
+		}
+
+		nzUInt32 tables[8][256];
+	};
+
+	// Construites à la première utilisation, pour rester valides même si un hash est calculé pendant l'initialisation statique
+	const crc32_slicedTable& crc32_getDefaultTables()
+	{
+		static const crc32_slicedTable tables;
+		return tables;
+	}
 }
 
 NzHashCRC32::NzHashCRC32(nzUInt32 polynomial)
@@ -70,27 +99,31 @@ NzHashCRC32::NzHashCRC32(nzUInt32 polynomial)
 	m_state = new NzHashCRC32_state;
 
 	if (polynomial == 0x04c11db7)
-		m_state->table = crc32_table; // Table précalculée (Bien plus rapide)
+		m_state->table = crc32_getDefaultTables().tables; // Tables précalculées (Bien plus rapide)
 	else
 	{
-		nzUInt32* table = new nzUInt32[256];
+		nzUInt32 (*tables)[256] = new nzUInt32[8][256];
 
 		for (unsigned int i = 0; i < 256; ++i)
 		{
-			table[i] = crc32_reflect(i, 8) << 24;
+			nzUInt32& entry = tables[0][i];
+
+			entry = crc32_reflect(i, 8) << 24;
 			for (unsigned int j = 0; j < 8; ++j)
-				table[i] = (table[i] << 1) ^ (table[i] & (1 << 31) ? polynomial : 0);
+				entry = (entry << 1) ^ (entry & (1 << 31) ? polynomial : 0);
 
-			table[i] = crc32_reflect(table[i], 32);
+			entry = crc32_reflect(entry, 32);
 		}
 
-		m_state->table = table;
+		crc32_buildSlices(tables);
+
+		m_state->table = tables;
 	}
 }
 
 NzHashCRC32::~NzHashCRC32()
 {
-	if (m_state->table != crc32_table)
+	if (m_state->table != crc32_getDefaultTables().tables)
 		delete[] m_state->table;
 
 	delete m_state;
@@ -98,8 +131,36 @@ NzHashCRC32::~NzHashCRC32()
 
 void NzHashCRC32::Append(const nzUInt8* data, unsigned int len)
 {
+	const nzUInt32 (*table)[256] = m_state->table;
+	nzUInt32 crc = m_state->crc;
+
+	#ifdef NAZARA_LITTLE_ENDIAN
+	// Huit octets par itération, chacun étant traité par sa propre table (Résultat identique à la version octet par octet)
+	while (len >= 8)
+	{
+		nzUInt32 low, high;
+		std::memcpy(&low, data, sizeof(nzUInt32));
+		std::memcpy(&high, data + 4, sizeof(nzUInt32));
+
+		low ^= crc;
+		crc = table[7][ low         & 0xFF] ^
+		      table[6][(low  >>  8) & 0xFF] ^
+		      table[5][(low  >> 16) & 0xFF] ^
+		      table[4][ low  >> 24        ] ^
+		      table[3][ high        & 0xFF] ^
+		      table[2][(high >>  8) & 0xFF] ^
+		      table[1][(high >> 16) & 0xFF] ^
+		      table[0][ high >> 24        ];
+
+		data += 8;
+		len -= 8;
+	}
+	#endif
+
 	while (len--)
-		m_state->crc = m_state->table[(m_state->crc ^ *data++) & 0xFF] ^ (m_state->crc >> 8);
+		crc = table[0][(crc ^ *data++) & 0xFF] ^ (crc >> 8);
+
+	m_state->crc = crc;
 }
 
 void NzHashCRC32::Begin()
@@ -0,0 +1,216 @@
+// Copyright (C) 2014 Jérôme Leclercq
+// This file is part of the "Nazara Engine - Core module"
+// For conditions of distribution and use, see copyright notice in Config.hpp
+
+// Implémentation de l'algorithme xxHash64 de Yann Collet (Licence BSD)
+
+#include <Nazara/Core/Hash/XXH64.hpp>
+#include <Nazara/Core/Endianness.hpp>
+#include <algorithm>
+#include <cstring>
+#include <Nazara/Core/Debug.hpp>
+
+struct NzHashXXH64_state
+{
+	nzUInt64 seed;
+	nzUInt64 totalLength;
+	nzUInt64 v[4];
+	nzUInt8 buffer[32];
+	unsigned int bufferSize;
+};
+
+namespace
+{
+	const nzUInt64 prime1 = 11400714785074694791ULL;
+	const nzUInt64 prime2 = 14029467366897019727ULL;
+	const nzUInt64 prime3 =  1609587929392839161ULL;
+	const nzUInt64 prime4 =  9650029242287828579ULL;
+	const nzUInt64 prime5 =  2870177450012600261ULL;
+
+	inline nzUInt64 xxh64_rotl(nzUInt64 value, unsigned int shift)
+	{
+		return (value << shift) | (value >> (64 - shift));
+	}
+
+	inline nzUInt64 xxh64_read64(const nzUInt8* data)
+	{
+		nzUInt64 value;
+		std::memcpy(&value, data, sizeof(nzUInt64));
+
+		#ifdef NAZARA_BIG_ENDIAN
+		NzByteSwap(&value, sizeof(nzUInt64));
+		#endif
+
+		return value;
+	}
+
+	inline nzUInt32 xxh64_read32(const nzUInt8* data)
+	{
+		nzUInt32 value;
+		std::memcpy(&value, data, sizeof(nzUInt32));
+
+		#ifdef NAZARA_BIG_ENDIAN
+		NzByteSwap(&value, sizeof(nzUInt32));
+		#endif
+
+		return value;
+	}
+
+	inline nzUInt64 xxh64_round(nzUInt64 acc, nzUInt64 input)
+	{
+		acc += input * prime2;
+		acc = xxh64_rotl(acc, 31);
+		return acc * prime1;
+	}
+
+	inline nzUInt64 xxh64_mergeRound(nzUInt64 acc, nzUInt64 value)
+	{
+		acc ^= xxh64_round(0, value);
+		return acc * prime1 + prime4;
+	}
+
+	// Traite autant de blocs de 32 octets que possible et renvoie le nombre d'octets consommés
+	inline unsigned int xxh64_consume(nzUInt64* v, const nzUInt8* data, unsigned int len)
+	{
+		nzUInt64 v1 = v[0];
+		nzUInt64 v2 = v[1];
+		nzUInt64 v3 = v[2];
+		nzUInt64 v4 = v[3];
+
+		const nzUInt8* start = data;
+		const nzUInt8* limit = data + (len & ~31U);
+		while (data < limit)
+		{
+			v1 = xxh64_round(v1, xxh64_read64(data));
+			v2 = xxh64_round(v2, xxh64_read64(data + 8));
+			v3 = xxh64_round(v3, xxh64_read64(data + 16));
+			v4 = xxh64_round(v4, xxh64_read64(data + 24));
+
+			data += 32;
+		}
+
+		v[0] = v1;
+		v[1] = v2;
+		v[2] = v3;
+		v[3] = v4;
+
+		return static_cast<unsigned int>(data - start);
+	}
+}
+
+NzHashXXH64::NzHashXXH64(nzUInt64 seed)
+{
+	m_state = new NzHashXXH64_state;
+	m_state->seed = seed;
+}
+
+NzHashXXH64::~NzHashXXH64()
+{
+	delete m_state;
+}
+
+void NzHashXXH64::Append(const nzUInt8* data, unsigned int len)
+{
+	m_state->totalLength += len;
+
+	// On complète d'abord le bloc entamé lors de l'appel précédent
+	if (m_state->bufferSize > 0)
+	{
+		unsigned int toCopy = std::min(len, 32U - m_state->bufferSize);
+		std::memcpy(&m_state->buffer[m_state->bufferSize], data, toCopy);
+		m_state->bufferSize += toCopy;
+		data += toCopy;
+		len -= toCopy;
+
+		if (m_state->bufferSize < 32)
+			return;
+
+		xxh64_consume(m_state->v, m_state->buffer, 32);
+		m_state->bufferSize = 0;
+	}
+
+	unsigned int consumed = xxh64_consume(m_state->v, data, len);
+	data += consumed;
+	len -= consumed;
+
+	if (len > 0)
+	{
+		std::memcpy(m_state->buffer, data, len);
+		m_state->bufferSize = len;
+	}
+}
+
+void NzHashXXH64::Begin()
+{
+	m_state->totalLength = 0;
+	m_state->bufferSize = 0;
+	m_state->v[0] = m_state->seed + prime1 + prime2;
+	m_state->v[1] = m_state->seed + prime2;
+	m_state->v[2] = m_state->seed;
+	m_state->v[3] = m_state->seed - prime1;
+}
+
+NzHashDigest NzHashXXH64::End()
+{
+	nzUInt64 hash;
+	if (m_state->totalLength >= 32)
+	{
+		const nzUInt64* v = m_state->v;
+
+		hash = xxh64_rotl(v[0], 1) + xxh64_rotl(v[1], 7) + xxh64_rotl(v[2], 12) + xxh64_rotl(v[3], 18);
+		hash = xxh64_mergeRound(hash, v[0]);
+		hash = xxh64_mergeRound(hash, v[1]);
+		hash = xxh64_mergeRound(hash, v[2]);
+		hash = xxh64_mergeRound(hash, v[3]);
+	}
+	else
+		hash = m_state->seed + prime5;
+
+	hash += m_state->totalLength;
+
+	const nzUInt8* ptr = m_state->buffer;
+	const nzUInt8* end = ptr + m_state->bufferSize;
+
+	for (; ptr + 8 <= end; ptr += 8)
+	{
+		hash ^= xxh64_round(0, xxh64_read64(ptr));
+		hash = xxh64_rotl(hash, 27) * prime1 + prime4;
+	}
+
+	if (ptr + 4 <= end)
+	{
+		hash ^= static_cast<nzUInt64>(xxh64_read32(ptr)) * prime1;
+		hash = xxh64_rotl(hash, 23) * prime2 + prime3;
+		ptr += 4;
+	}
+
+	for (; ptr < end; ++ptr)
+	{
+		hash ^= (*ptr) * prime5;
+		hash = xxh64_rotl(hash, 11) * prime1;
+	}
+
+	hash ^= hash >> 33;
+	hash *= prime2;
+	hash ^= hash >> 29;
+	hash *= prime3;
+	hash ^= hash >> 32;
+
+	// Représentation canonique (grand-boutiste), comme pour CRC32
+	#ifdef NAZARA_LITTLE_ENDIAN
+	NzByteSwap(&hash, sizeof(nzUInt64));
+	#endif
+
+	return NzHashDigest(GetHashName(), reinterpret_cast<nzUInt8*>(&hash), 8);
+}
+
+unsigned int NzHashXXH64::GetDigestLength()
+{
+	return 8;
+}
+
+NzString NzHashXXH64::GetHashName()
+{
+	static NzString hashName = "XXH64";
+	return hashName;
+}
@@ -6,14 +6,24 @@
 #include <Nazara/Core/Config.hpp>
 #include <Nazara/Core/File.hpp>
 #include <Nazara/Core/StringStream.hpp>
+#include <Nazara/Core/Thread.hpp>
 #include <Nazara/Math/Basic.hpp>
+#include <algorithm>
 #include <ctime>
 #include <cstring>
+#include <memory>
 
 #if NAZARA_CORE_DUPLICATE_LOG_TO_COUT
 #include <cstdio>
 #endif
 
+// Les en-têtes inclus après Log.hpp (StringStream notamment) ont pu désactiver les macros de verrouillage
+#if NAZARA_CORE_THREADSAFE && NAZARA_THREADSAFETY_LOG
+#include <Nazara/Core/ThreadSafety.hpp>
+#else
+#include <Nazara/Core/ThreadSafetyOff.hpp>
+#endif
+
 #include <Nazara/Core/Debug.hpp>
 
 namespace
@@ -26,25 +36,58 @@ namespace
 	};
 
 	static_assert(sizeof(errorType)/sizeof(const char*) == nzErrorType_Max+1, "Error type array is incomplete");
+
+	const unsigned int timeLength = 23; // "JJ/MM/AAAA - HH:MM:SS: "
+
+	static_assert(NAZARA_CORE_LOG_ASYNC_LINESIZE > timeLength + 1, "Async log line size is too small");
+
+	// Une erreur signalée par le fichier de log pendant que le verrou est pris reviendrait écrire dans le log,
+	// le verrou n'étant pas récursif, ce message est ignoré plutôt que de bloquer le thread
+	thread_local bool fileOperation = false;
 }
 
+// File circulaire bornée, à plusieurs producteurs et un seul consommateur (le thread d'écriture)
+// Chaque case porte un numéro de séquence indiquant si elle est libre ou prête à être lue, aucun verrou n'est donc nécessaire
+struct NzLogAsyncQueue
+{
+	struct Entry
+	{
+		std::atomic<unsigned int> sequence;
+		unsigned int size;
+		char line[NAZARA_CORE_LOG_ASYNC_LINESIZE];
+	};
+
+	NzThread thread;
+	std::unique_ptr<Entry[]> entries;
+	std::atomic<unsigned int> readPosition;
+	std::atomic<unsigned int> writePosition;
+	std::atomic_bool running;
+	unsigned int capacity;
+};
+
 NzLog::NzLog() :
 m_filePath("NazaraLog.log"),
 m_file(nullptr),
-m_append(false),
+m_asyncQueue(nullptr),
+m_asyncProducerQueue(nullptr),
+m_asyncProducerCount(0),
+m_droppedCount(0),
 m_enabled(true),
-m_writeTime(true)
+m_writeTime(true),
+m_append(false)
 {
 }
 
 NzLog::~NzLog()
 {
+	EnableAsync(false);
+
 	delete m_file;
 }
 
 void NzLog::Enable(bool enable)
 {
-	NazaraLock(m_mutex)
+	NazaraWriteLock(m_mutex)
 
 	if (m_enabled == enable)
 		return;
@@ -59,26 +102,102 @@ void NzLog::Enable(bool enable)
 
 void NzLog::EnableAppend(bool enable)
 {
-	NazaraLock(m_mutex)
+	NazaraWriteLock(m_mutex)
 
 	m_append = enable;
 	if (!m_append && m_file)
 	{
+		fileOperation = true;
 		m_file->Delete();
+		fileOperation = false;
+
+		delete m_file;
 		m_file = nullptr;
 	}
 }
 
+void NzLog::EnableAsync(bool enable, unsigned int capacity)
+{
+	if (enable == (m_asyncQueue != nullptr))
+		return;
+
+	if (enable)
+	{
+		#if NAZARA_CORE_SAFE
+		if (capacity == 0)
+		{
+			NazaraError("Capacity must be over zero");
+			return;
+		}
+		#endif
+
+		NzLogAsyncQueue* queue = new NzLogAsyncQueue;
+		queue->capacity = NzGetNearestPowerOfTwo(capacity);
+		queue->entries.reset(new NzLogAsyncQueue::Entry[queue->capacity]);
+		queue->readPosition = 0;
+		queue->running = true;
+		queue->writePosition = 0;
+
+		for (unsigned int i = 0; i < queue->capacity; ++i)
+			queue->entries[i].sequence = i;
+
+		queue->thread = NzThread(AsyncWriterProc, this, queue);
+
+		m_asyncQueue = queue;
+		m_asyncProducerQueue = queue;
+	}
+	else
+	{
+		// On retire la file aux producteurs, puis on attend que ceux qui l'utilisaient encore aient terminé
+		m_asyncProducerQueue = nullptr;
+		while (m_asyncProducerCount > 0)
+			NzThread::Sleep(0);
+
+		// Le thread d'écriture vide la file une dernière fois avant de se terminer
+		m_asyncQueue->running = false;
+		m_asyncQueue->thread.Join();
+
+		delete m_asyncQueue;
+		m_asyncQueue = nullptr;
+	}
+}
+
 void NzLog::EnableDateTime(bool enable)
 {
-	NazaraLock(m_mutex)
+	NazaraWriteLock(m_mutex)
 
 	m_writeTime = enable;
 }
 
+void NzLog::Flush()
+{
+	NzLogAsyncQueue* queue = m_asyncQueue;
+	if (queue)
+	{
+		// On attend que tout ce qui a été envoyé jusqu'ici soit écrit
+		unsigned int target = queue->writePosition;
+		while (static_cast<int>(queue->readPosition - target) < 0)
+			NzThread::Sleep(1);
+	}
+
+	NazaraWriteLock(m_mutex)
+
+	if (m_file && m_file->IsOpen())
+	{
+		fileOperation = true;
+		m_file->Flush();
+		fileOperation = false;
+	}
+}
+
+nzUInt64 NzLog::GetDroppedCount() const
+{
+	return m_droppedCount;
+}
+
 NzString NzLog::GetFile() const
 {
-	NazaraLock(m_mutex)
+	NazaraReadLock(m_mutex)
 
 	if (m_file)
 		return m_file->GetPath();
@@ -86,16 +205,19 @@ NzString NzLog::GetFile() const
 		return NzString();
 }
 
-bool NzLog::IsEnabled() const
+bool NzLog::IsAsync() const
 {
-	NazaraLock(m_mutex)
+	return m_asyncQueue != nullptr;
+}
 
+bool NzLog::IsEnabled() const
+{
 	return m_enabled;
 }
 
 void NzLog::SetFile(const NzString& filePath)
 {
-	NazaraLock(m_mutex)
+	NazaraWriteLock(m_mutex)
 
 	m_filePath = filePath;
 	if (m_file)
@@ -104,36 +226,80 @@ void NzLog::SetFile(const NzString& filePath)
 
 void NzLog::Write(const NzString& string)
 {
-	NazaraLock(m_mutex)
+	if (!m_enabled)
+		return;
+
+	// En mode asynchrone, la ligne est formatée directement dans la file, sans verrou ni allocation
+	m_asyncProducerCount++;
 
-	if (m_enabled)
+	NzLogAsyncQueue* queue = m_asyncProducerQueue;
+	if (queue)
 	{
-		if (!m_file)
-			m_file = new NzFile(m_filePath, NzFile::Text | NzFile::WriteOnly | ((m_append) ? NzFile::Append : NzFile::Truncate));
+		NzLogAsyncQueue::Entry* entry;
+		unsigned int position = queue->writePosition.load(std::memory_order_relaxed);
+		while (true)
+		{
+			entry = &queue->entries[position & (queue->capacity-1)];
 
-		NzString line;
+			int diff = static_cast<int>(entry->sequence.load(std::memory_order_acquire) - position);
+			if (diff == 0)
+			{
+				if (queue->writePosition.compare_exchange_weak(position, position+1, std::memory_order_relaxed))
+					break;
+			}
+			else if (diff < 0)
+			{
+				// La file est pleine, le disque ne suit pas: on abandonne la ligne plutôt que de bloquer
+				entry = nullptr;
+				break;
+			}
+			else
+				position = queue->writePosition.load(std::memory_order_relaxed);
+		}
 
-		if (m_writeTime)
+		if (entry)
 		{
-			line.Reserve(23 + string.GetSize() + 1);
-			line.Resize(23);
+			unsigned int size = (m_writeTime) ? FormatTime(entry->line) : 0;
+			unsigned int length = std::min(string.GetSize(), NAZARA_CORE_LOG_ASYNC_LINESIZE - size - 1);
+			if (length > 0)
+				std::memcpy(&entry->line[size], string.GetConstBuffer(), length);
+
+			size += length;
+			entry->line[size++] = '\n';
+			entry->size = size;
 
-			time_t currentTime = std::time(nullptr);
-			std::strftime(&line[0], 24, "%d/%m/%Y - %H:%M:%S: ", std::localtime(&currentTime));
+			entry->sequence.store(position+1, std::memory_order_release);
 		}
 		else
-			line.Reserve(string.GetSize() + 1);
+			m_droppedCount++;
+
+		m_asyncProducerCount--;
+		return;
+	}
+
+	m_asyncProducerCount--;
 
-		line += string;
-		line += '\n';
+	if (fileOperation)
+		return;
 
-		if (m_file->IsOpen())
-			m_file->Write(line);
+	NazaraWriteLock(m_mutex)
 
-		#if NAZARA_CORE_DUPLICATE_LOG_TO_COUT
-		std::fputs(line.GetConstBuffer(), stdout);
-		#endif
+	NzString line;
+
+	if (m_writeTime)
+	{
+		line.Reserve(timeLength + string.GetSize() + 1);
+		line.Resize(timeLength);
+
+		FormatTime(&line[0]);
 	}
+	else
+		line.Reserve(string.GetSize() + 1);
+
+	line += string;
+	line += '\n';
+
+	WriteToFile(line.GetConstBuffer(), line.GetSize());
 }
 
 void NzLog::WriteError(nzErrorType type, const NzString& error)
@@ -155,3 +321,89 @@ NzLog* NzLog::Instance()
 	static NzLog log;
 	return &log;
 }
+
+unsigned int NzLog::FormatTime(char* buffer) const
+{
+	time_t currentTime = std::time(nullptr);
+
+	// Plusieurs threads peuvent formater en même temps en mode asynchrone, std::localtime n'est donc pas utilisable
+	std::tm localTime;
+	#if defined(NAZARA_PLATFORM_WINDOWS)
+	localtime_s(&localTime, &currentTime);
+	#else
+	localtime_r(&currentTime, &localTime);
+	#endif
+
+	char time[timeLength + 1];
+	std::strftime(time, timeLength + 1, "%d/%m/%Y - %H:%M:%S: ", &localTime);
+	std::memcpy(buffer, time, timeLength);
+
+	return timeLength;
+}
+
+void NzLog::WriteToFile(const char* string, unsigned int size)
+{
+	if (!m_enabled)
+		return;
+
+	if (!m_file)
+		m_file = new NzFile(m_filePath, NzFile::Text | NzFile::WriteOnly | ((m_append) ? NzFile::Append : NzFile::Truncate));
+
+	if (m_file->IsOpen())
+		m_file->Write(string, sizeof(char), size);
+
+	#if NAZARA_CORE_DUPLICATE_LOG_TO_COUT
+	std::fwrite(string, sizeof(char), size, stdout);
+	#endif
+}
+
+void NzLog::AsyncWriterProc(NzLog* log, NzLogAsyncQueue* queue)
+{
+	// Les lignes sont regroupées pour n'effectuer qu'une écriture par passage
+	const unsigned int batchCapacity = 32*NAZARA_CORE_LOG_ASYNC_LINESIZE;
+	std::unique_ptr<char[]> batch(new char[batchCapacity]);
+
+	unsigned int readPosition = queue->readPosition;
+	while (true)
+	{
+		bool running = queue->running;
+
+		unsigned int batchSize = 0;
+		unsigned int lineCount = 0;
+		while (true)
+		{
+			NzLogAsyncQueue::Entry& entry = queue->entries[readPosition & (queue->capacity-1)];
+			bool ready = (entry.sequence.load(std::memory_order_acquire) == readPosition+1);
+
+			if (!ready || batchSize + entry.size > batchCapacity)
+			{
+				if (batchSize > 0)
+				{
+					NazaraWriteLock(log->m_mutex)
+
+					log->WriteToFile(batch.get(), batchSize);
+					batchSize = 0;
+				}
+
+				queue->readPosition.store(readPosition, std::memory_order_release);
+
+				if (!ready)
+					break;
+			}
+
+			std::memcpy(&batch[batchSize], entry.line, entry.size);
+			batchSize += entry.size;
+			lineCount++;
+
+			// La case redevient disponible pour le tour suivant
+			entry.sequence.store(readPosition + queue->capacity, std::memory_order_release);
+			readPosition++;
+		}
+
+		if (!running)
+			break;
+
+		if (lineCount == 0)
+			NzThread::Sleep(NAZARA_CORE_LOG_ASYNC_INTERVAL);
+	}
+}
@@ -0,0 +1,157 @@
+// Copyright (C) 2014 Jérôme Leclercq
+// This file is part of the "Nazara Engine - Core module"
+// For conditions of distribution and use, see copyright notice in Config.hpp
+
+#include <Nazara/Core/MemoryArena.hpp>
+#include <Nazara/Core/Error.hpp>
+#include <algorithm>
+#include <cstdlib>
+#include <Nazara/Core/Debug.hpp>
+
+struct NzMemoryArena::Page
+{
+	Page* next;
+	std::size_t size;
+};
+
+namespace
+{
+	// Les données d'une page suivent son en-tête, de façon à rester alignées sur 16 octets
+	const std::size_t pageHeaderSize = 16;
+
+	inline nzUInt8* AlignPointer(nzUInt8* ptr, std::size_t alignment)
+	{
+		std::size_t mask = alignment - 1;
+		return reinterpret_cast<nzUInt8*>((reinterpret_cast<std::size_t>(ptr) + mask) & ~mask);
+	}
+}
+
+NzMemoryArena::NzMemoryArena(std::size_t pageSize) :
+m_pages(nullptr),
+m_cursor(nullptr),
+m_end(nullptr),
+m_allocatedSize(0),
+m_capacity(0),
+m_pageSize(std::max(pageSize, static_cast<std::size_t>(64))),
+m_pageCount(0)
+{
+}
+
+NzMemoryArena::~NzMemoryArena()
+{
+	Release();
+}
+
+void* NzMemoryArena::Allocate(std::size_t size, std::size_t alignment)
+{
+	#if NAZARA_CORE_SAFE
+	if (alignment == 0 || (alignment & (alignment - 1)) != 0)
+	{
+		NazaraError("Alignment must be a power of two");
+		return nullptr;
+	}
+	#endif
+
+	nzUInt8* ptr = AlignPointer(m_cursor, alignment);
+	if (!m_cursor || ptr > m_end || size > static_cast<std::size_t>(m_end - ptr))
+	{
+		if (!AllocatePage(size + alignment))
+			return nullptr;
+
+		ptr = AlignPointer(m_cursor, alignment);
+	}
+
+	m_cursor = ptr + size;
+	m_allocatedSize += size;
+
+	return ptr;
+}
+
+std::size_t NzMemoryArena::GetAllocatedSize() const
+{
+	return m_allocatedSize;
+}
+
+std::size_t NzMemoryArena::GetCapacity() const
+{
+	return m_capacity;
+}
+
+unsigned int NzMemoryArena::GetPageCount() const
+{
+	return m_pageCount;
+}
+
+std::size_t NzMemoryArena::GetPageSize() const
+{
+	return m_pageSize;
+}
+
+void NzMemoryArena::Release()
+{
+	while (m_pages)
+	{
+		Page* next = m_pages->next;
+		std::free(m_pages);
+
+		m_pages = next;
+	}
+
+	m_allocatedSize = 0;
+	m_capacity = 0;
+	m_cursor = nullptr;
+	m_end = nullptr;
+	m_pageCount = 0;
+}
+
+void NzMemoryArena::Reset()
+{
+	// Si l'arène a débordé sur plusieurs pages, on les fusionne en une seule pour que les prochaines utilisations n'allouent plus
+	if (m_pageCount > 1)
+	{
+		std::size_t capacity = m_capacity;
+		Release();
+
+		if (!AllocatePage(capacity))
+			return;
+	}
+	else if (m_pages)
+	{
+		m_cursor = reinterpret_cast<nzUInt8*>(m_pages) + pageHeaderSize;
+		m_end = m_cursor + m_pages->size;
+	}
+
+	m_allocatedSize = 0;
+}
+
+NzMemoryArena& NzMemoryArena::GetThreadArena()
+{
+	static thread_local NzMemoryArena arena;
+	return arena;
+}
+
+bool NzMemoryArena::AllocatePage(std::size_t minSize)
+{
+	static_assert(sizeof(Page) <= pageHeaderSize, "Page header is too big");
+
+	std::size_t size = std::max(m_pageSize, minSize);
+
+	Page* page = static_cast<Page*>(std::malloc(pageHeaderSize + size));
+	if (!page)
+	{
+		NazaraError("Failed to allocate arena page");
+		return false;
+	}
+
+	// La nouvelle page devient la page courante, le reste de la précédente est abandonné jusqu'au prochain Reset
+	page->next = m_pages;
+	page->size = size;
+
+	m_pages = page;
+	m_cursor = reinterpret_cast<nzUInt8*>(page) + pageHeaderSize;
+	m_end = m_cursor + size;
+	m_capacity += size;
+	m_pageCount++;
+
+	return true;
+}
@@ -0,0 +1,226 @@
+// Copyright (C) 2014 Jérôme Leclercq
+// This file is part of the "Nazara Engine - Core module"
+// For conditions of distribution and use, see copyright notice in Config.hpp
+
+#include <Nazara/Core/MemoryPool.hpp>
+#include <Nazara/Core/Error.hpp>
+#include <Nazara/Core/LockGuard.hpp>
+#include <algorithm>
+#include <cstdlib>
+#include <Nazara/Core/Debug.hpp>
+
+namespace
+{
+	// Le premier mot d'un bloc libre contient l'index (+1) du bloc libre suivant
+	inline std::atomic<nzUInt32>* GetNextLink(nzUInt8* block)
+	{
+		return reinterpret_cast<std::atomic<nzUInt32>*>(block);
+	}
+
+	inline nzUInt64 MakeHead(nzUInt64 tag, nzUInt32 link)
+	{
+		return (tag << 32) | link;
+	}
+}
+
+NzMemoryPool::NzMemoryPool(unsigned int blockSize, unsigned int blocksPerChunk) :
+m_freeHead(0),
+m_allocatedBlockCount(0),
+m_chunkCount(0),
+m_blocksPerChunk(std::max(blocksPerChunk, 1U))
+{
+	// Un bloc libre doit pouvoir contenir le lien vers le suivant, et rester aligné
+	m_blockSize = (std::max(blockSize, static_cast<unsigned int>(sizeof(nzUInt32))) + 3) & ~3U;
+
+	for (unsigned int i = 0; i < MaxChunkCount; ++i)
+		m_chunks[i] = nullptr;
+}
+
+NzMemoryPool::~NzMemoryPool()
+{
+	// Des blocs encore utilisés (Typiquement par des objets statiques détruits après le pool) restent valides,
+	// leurs chunks sont alors volontairement abandonnés
+	if (m_allocatedBlockCount != 0)
+		return;
+
+	unsigned int chunkCount = m_chunkCount;
+	for (unsigned int i = 0; i < chunkCount; ++i)
+		std::free(m_chunks[i]);
+}
+
+void* NzMemoryPool::Allocate()
+{
+	nzUInt64 head = m_freeHead.load(std::memory_order_acquire);
+	for (;;)
+	{
+		nzUInt32 link = static_cast<nzUInt32>(head);
+		if (link == 0)
+		{
+			if (!Grow())
+				return nullptr;
+
+			head = m_freeHead.load(std::memory_order_acquire);
+			continue;
+		}
+
+		// Le bloc peut être pris entre temps par un autre thread, le compteur de la tête fera alors échouer l'échange
+		nzUInt8* block = GetBlock(link - 1);
+		nzUInt32 next = GetNextLink(block)->load(std::memory_order_relaxed);
+		if (m_freeHead.compare_exchange_weak(head, MakeHead((head >> 32) + 1, next), std::memory_order_acquire, std::memory_order_acquire))
+		{
+			m_allocatedBlockCount++;
+			return block;
+		}
+	}
+}
+
+void NzMemoryPool::Free(void* ptr)
+{
+	if (!ptr)
+		return;
+
+	nzUInt8* block = static_cast<nzUInt8*>(ptr);
+
+	// On retrouve l'index du bloc en parcourant les chunks, du plus grand (et donc du plus peuplé) au plus petit
+	nzUInt32 index = 0;
+	bool found = false;
+	for (int i = m_chunkCount-1; i >= 0; --i)
+	{
+		nzUInt8* chunk = m_chunks[i].load(std::memory_order_acquire);
+		nzUInt32 blockCount = m_blocksPerChunk << i;
+		if (block >= chunk && block < chunk + blockCount*m_blockSize)
+		{
+			index = m_blocksPerChunk*((1U << i) - 1) + static_cast<nzUInt32>((block - chunk)/m_blockSize);
+			found = true;
+			break;
+		}
+	}
+
+	#if NAZARA_CORE_SAFE
+	if (!found)
+	{
+		NazaraError("Pointer does not belong to this pool");
+		return;
+	}
+	#else
+	NazaraUnused(found);
+	#endif
+
+	nzUInt64 head = m_freeHead.load(std::memory_order_relaxed);
+	do
+		GetNextLink(block)->store(static_cast<nzUInt32>(head), std::memory_order_relaxed);
+	while (!m_freeHead.compare_exchange_weak(head, MakeHead((head >> 32) + 1, index + 1), std::memory_order_release, std::memory_order_relaxed));
+
+	m_allocatedBlockCount--;
+}
+
+unsigned int NzMemoryPool::GetAllocatedBlockCount() const
+{
+	return m_allocatedBlockCount;
+}
+
+unsigned int NzMemoryPool::GetBlockSize() const
+{
+	return m_blockSize;
+}
+
+unsigned int NzMemoryPool::GetCapacity() const
+{
+	// Les chunks doublent de taille à chaque agrandissement
+	return m_blocksPerChunk*((1U << m_chunkCount) - 1);
+}
+
+unsigned int NzMemoryPool::GetChunkCount() const
+{
+	return m_chunkCount;
+}
+
+void* NzMemoryPool::AllocateShared(std::size_t size)
+{
+	NzMemoryPool* pool = GetSharedPool(size);
+	if (pool)
+		return pool->Allocate();
+	else
+		return std::malloc(size);
+}
+
+void NzMemoryPool::FreeShared(void* ptr, std::size_t size)
+{
+	NzMemoryPool* pool = GetSharedPool(size);
+	if (pool)
+		pool->Free(ptr);
+	else
+		std::free(ptr);
+}
+
+NzMemoryPool* NzMemoryPool::GetSharedPool(std::size_t size)
+{
+	static NzMemoryPool pools[] = {
+		{16}, {32}, {48}, {64}, {80}, {96}, {112}, {128},
+		{144}, {160}, {176}, {192}, {208}, {224}, {240}, {256}
+	};
+
+	static_assert(sizeof(pools)/sizeof(NzMemoryPool) == SharedMaxSize/SharedGranularity, "Shared pool array is incomplete");
+
+	if (size == 0 || size > SharedMaxSize)
+		return nullptr;
+
+	return &pools[(size - 1)/SharedGranularity];
+}
+
+nzUInt8* NzMemoryPool::GetBlock(nzUInt32 index) const
+{
+	// Le chunk i contient m_blocksPerChunk*2^i blocs, et commence à l'index m_blocksPerChunk*(2^i - 1)
+	nzUInt32 chunkIndex = 0;
+	nzUInt32 first = 0;
+	while (index >= first + (m_blocksPerChunk << chunkIndex))
+	{
+		first += m_blocksPerChunk << chunkIndex;
+		chunkIndex++;
+	}
+
+	return m_chunks[chunkIndex].load(std::memory_order_acquire) + (index - first)*m_blockSize;
+}
+
+bool NzMemoryPool::Grow()
+{
+	NzLockGuard lock(m_growMutex);
+
+	// Un autre thread a pu agrandir le pool pendant que nous attendions le verrou
+	if (static_cast<nzUInt32>(m_freeHead.load(std::memory_order_acquire)) != 0)
+		return true;
+
+	unsigned int chunkIndex = m_chunkCount;
+	nzUInt64 firstIndex = static_cast<nzUInt64>(m_blocksPerChunk)*((1ULL << chunkIndex) - 1);
+	nzUInt64 blockCount = static_cast<nzUInt64>(m_blocksPerChunk) << chunkIndex;
+	if (chunkIndex >= MaxChunkCount || firstIndex + blockCount >= 0xFFFFFFFFULL)
+	{
+		NazaraError("Memory pool is full");
+		return false;
+	}
+
+	nzUInt8* chunk = static_cast<nzUInt8*>(std::malloc(static_cast<std::size_t>(blockCount*m_blockSize)));
+	if (!chunk)
+	{
+		NazaraError("Failed to allocate memory pool chunk");
+		return false;
+	}
+
+	// On chaîne les blocs du nouveau chunk entre eux
+	for (nzUInt32 i = 0; i < blockCount-1; ++i)
+		GetNextLink(&chunk[i*m_blockSize])->store(static_cast<nzUInt32>(firstIndex + i + 2), std::memory_order_relaxed);
+
+	nzUInt8* last = &chunk[(blockCount-1)*m_blockSize];
+
+	// Le chunk doit être visible avant que ses blocs ne puissent être pris
+	m_chunks[chunkIndex].store(chunk, std::memory_order_release);
+	m_chunkCount++;
+
+	// D'autres threads peuvent libérer des blocs pendant ce temps, la chaîne est donc insérée en tête
+	nzUInt64 head = m_freeHead.load(std::memory_order_relaxed);
+	do
+		GetNextLink(last)->store(static_cast<nzUInt32>(head), std::memory_order_relaxed);
+	while (!m_freeHead.compare_exchange_weak(head, MakeHead((head >> 32) + 1, static_cast<nzUInt32>(firstIndex + 1)), std::memory_order_release, std::memory_order_relaxed));
+
+	return true;
+}
@@ -0,0 +1,161 @@
+// Copyright (C) 2014 Jérôme Leclercq
+// This file is part of the "Nazara Engine - Core module"
+// For conditions of distribution and use, see copyright notice in Config.hpp
+
+#include <Nazara/Core/PerformanceCounters.hpp>
+#include <Nazara/Core/Clock.hpp>
+#include <Nazara/Core/Error.hpp>
+#include <Nazara/Core/LockGuard.hpp>
+#include <Nazara/Core/Mutex.hpp>
+#include <atomic>
+#include <cstring>
+#include <memory>
+#include <vector>
+#include <Nazara/Core/Debug.hpp>
+
+namespace
+{
+	const char* counterNames[] = {
+		"BufferMaps",      // nzPerformanceCounter_BufferMaps
+		"CulledNodes",     // nzPerformanceCounter_CulledNodes
+		"DrawCalls",       // nzPerformanceCounter_DrawCalls
+		"DrawnInstances",  // nzPerformanceCounter_DrawnInstances
+		"ProgramBinds",    // nzPerformanceCounter_ProgramBinds
+		"SkinnedVertices", // nzPerformanceCounter_SkinnedVertices
+		"StateUpdates",    // nzPerformanceCounter_StateUpdates
+		"TextureBinds",    // nzPerformanceCounter_TextureBinds
+		"VisibleNodes"     // nzPerformanceCounter_VisibleNodes
+	};
+
+	static_assert(sizeof(counterNames)/sizeof(const char*) == nzPerformanceCounter_Max+1, "Performance counter name array is incomplete");
+
+	const unsigned int counterCount = nzPerformanceCounter_Max+1;
+
+	// Seul le thread propriétaire écrit ses compteurs, la lecture se fait depuis EndFrame
+	struct ThreadCounters
+	{
+		std::atomic<nzUInt64> values[counterCount];
+	};
+
+	std::vector<std::unique_ptr<ThreadCounters>> s_threadCounters;
+	NzFrameStatistics s_lastFrame;
+	NzMutex s_mutex;
+	nzUInt64 s_frameIndex = 0;
+	nzUInt64 s_frameStart = 0;
+	nzUInt64 s_previousTotals[counterCount] = {0};
+	nzUInt64 s_resetTotals[counterCount] = {0};
+	thread_local ThreadCounters* s_currentCounters = nullptr;
+
+	ThreadCounters* GetThreadCounters()
+	{
+		if (!s_currentCounters)
+		{
+			std::unique_ptr<ThreadCounters> counters(new ThreadCounters);
+			for (unsigned int i = 0; i < counterCount; ++i)
+				counters->values[i] = 0;
+
+			NzLockGuard lock(s_mutex);
+
+			s_currentCounters = counters.get();
+			s_threadCounters.push_back(std::move(counters));
+		}
+
+		return s_currentCounters;
+	}
+
+	// Le verrou doit être pris
+	void ComputeTotals(nzUInt64* totals)
+	{
+		std::memset(totals, 0, counterCount*sizeof(nzUInt64));
+		for (auto& counters : s_threadCounters)
+		{
+			for (unsigned int i = 0; i < counterCount; ++i)
+				totals[i] += counters->values[i].load(std::memory_order_relaxed);
+		}
+	}
+}
+
+void NzPerformanceCounters::Add(nzPerformanceCounter counter, nzUInt64 value)
+{
+	#ifdef NAZARA_DEBUG
+	if (counter > nzPerformanceCounter_Max)
+	{
+		NazaraError("Performance counter out of enum");
+		return;
+	}
+	#endif
+
+	// Pas besoin d'une incrémentation atomique puisque personne d'autre n'écrit dans ce compteur
+	std::atomic<nzUInt64>& atomicValue = GetThreadCounters()->values[counter];
+	atomicValue.store(atomicValue.load(std::memory_order_relaxed) + value, std::memory_order_relaxed);
+}
+
+void NzPerformanceCounters::EndFrame()
+{
+	nzUInt64 now = NzGetMicroseconds();
+	nzUInt64 totals[counterCount];
+
+	NzLockGuard lock(s_mutex);
+
+	ComputeTotals(totals);
+	for (unsigned int i = 0; i < counterCount; ++i)
+	{
+		s_lastFrame.counters[i] = totals[i] - s_previousTotals[i];
+		s_previousTotals[i] = totals[i];
+	}
+
+	s_lastFrame.frameIndex = s_frameIndex++;
+	s_lastFrame.frameTime = (s_frameStart != 0) ? now - s_frameStart : 0;
+	s_frameStart = now;
+}
+
+NzFrameStatistics NzPerformanceCounters::GetFrameStatistics()
+{
+	NzLockGuard lock(s_mutex);
+
+	return s_lastFrame;
+}
+
+const char* NzPerformanceCounters::GetName(nzPerformanceCounter counter)
+{
+	#ifdef NAZARA_DEBUG
+	if (counter > nzPerformanceCounter_Max)
+	{
+		NazaraError("Performance counter out of enum");
+		return nullptr;
+	}
+	#endif
+
+	return counterNames[counter];
+}
+
+nzUInt64 NzPerformanceCounters::GetTotal(nzPerformanceCounter counter)
+{
+	#ifdef NAZARA_DEBUG
+	if (counter > nzPerformanceCounter_Max)
+	{
+		NazaraError("Performance counter out of enum");
+		return 0;
+	}
+	#endif
+
+	nzUInt64 totals[counterCount];
+
+	NzLockGuard lock(s_mutex);
+	ComputeTotals(totals);
+
+	return totals[counter] - s_resetTotals[counter];
+}
+
+void NzPerformanceCounters::Reset()
+{
+	// Les compteurs des threads ne peuvent être remis à zéro sans risque, on retient donc leurs valeurs actuelles
+	NzLockGuard lock(s_mutex);
+
+	ComputeTotals(s_resetTotals);
+	std::memcpy(s_previousTotals, s_resetTotals, counterCount*sizeof(nzUInt64));
+	std::memset(&s_lastFrame, 0, sizeof(NzFrameStatistics));
+
+	s_frameIndex = 0;
+	s_frameStart = 0;
+}
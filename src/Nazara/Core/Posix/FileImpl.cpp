@@ -100,6 +100,22 @@ std::size_t NzFileImpl::Read(void* buffer, std::size_t size)
 		return 0;
 }
 
+std::size_t NzFileImpl::ReadAt(void* buffer, std::size_t size, nzUInt64 offset)
+{
+	// pread peut lire moins que demandé sans être en fin de fichier, on boucle donc jusqu'à tout avoir
+	std::size_t total = 0;
+	while (total < size)
+	{
+		ssize_t bytes = pread64(m_fileDescriptor, static_cast<char*>(buffer) + total, size - total, offset + total);
+		if (bytes <= 0)
+			break;
+
+		total += static_cast<std::size_t>(bytes);
+	}
+
+	return total;
+}
+
 bool NzFileImpl::SetCursorPos(NzFile::CursorPosition pos, nzInt64 offset)
 {
 	int moveMethod;
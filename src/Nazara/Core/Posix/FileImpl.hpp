@@ -35,6 +35,7 @@ class NzFileImpl : NzNonCopyable
 		nzUInt64 GetCursorPos() const;
 		bool Open(const NzString& filePath, unsigned int mode);
 		std::size_t Read(void* buffer, std::size_t size);
+		std::size_t ReadAt(void* buffer, std::size_t size, nzUInt64 offset);
 		bool SetCursorPos(NzFile::CursorPosition pos, nzInt64 offset);
 		std::size_t Write(const void* buffer, std::size_t size);
 
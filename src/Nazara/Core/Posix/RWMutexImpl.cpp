@@ -0,0 +1,46 @@
+// Copyright (C) 2014 Jérôme Leclercq
+// This file is part of the "Nazara Engine - Core module"
+// For conditions of distribution and use, see copyright notice in Config.hpp
+
+#include <Nazara/Core/Posix/RWMutexImpl.hpp>
+#include <Nazara/Core/Debug.hpp>
+
+NzRWMutexImpl::NzRWMutexImpl()
+{
+	pthread_rwlock_init(&m_handle, NULL);
+}
+
+NzRWMutexImpl::~NzRWMutexImpl()
+{
+	pthread_rwlock_destroy(&m_handle);
+}
+
+void NzRWMutexImpl::LockRead()
+{
+	pthread_rwlock_rdlock(&m_handle);
+}
+
+void NzRWMutexImpl::LockWrite()
+{
+	pthread_rwlock_wrlock(&m_handle);
+}
+
+bool NzRWMutexImpl::TryLockRead()
+{
+	return pthread_rwlock_tryrdlock(&m_handle) == 0;
+}
+
+bool NzRWMutexImpl::TryLockWrite()
+{
+	return pthread_rwlock_trywrlock(&m_handle) == 0;
+}
+
+void NzRWMutexImpl::UnlockRead()
+{
+	pthread_rwlock_unlock(&m_handle);
+}
+
+void NzRWMutexImpl::UnlockWrite()
+{
+	pthread_rwlock_unlock(&m_handle);
+}
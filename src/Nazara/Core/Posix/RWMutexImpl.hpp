@@ -0,0 +1,31 @@
+// Copyright (C) 2014 Jérôme Leclercq
+// This file is part of the "Nazara Engine - Core module"
+// For conditions of distribution and use, see copyright notice in Config.hpp
+
+#pragma once
+
+#ifndef NAZARA_RWMUTEXIMPL_HPP
+#define NAZARA_RWMUTEXIMPL_HPP
+
+#include <pthread.h>
+
+class NzRWMutexImpl
+{
+	public:
+		NzRWMutexImpl();
+		~NzRWMutexImpl();
+
+		void LockRead();
+		void LockWrite();
+
+		bool TryLockRead();
+		bool TryLockWrite();
+
+		void UnlockRead();
+		void UnlockWrite();
+
+	private:
+		pthread_rwlock_t m_handle;
+};
+
+#endif // NAZARA_RWMUTEXIMPL_HPP
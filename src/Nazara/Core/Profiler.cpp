@@ -0,0 +1,249 @@
+// Copyright (C) 2014 Jérôme Leclercq
+// This file is part of the "Nazara Engine - Core module"
+// For conditions of distribution and use, see copyright notice in Config.hpp
+
+#include <Nazara/Core/Profiler.hpp>
+#include <Nazara/Core/Clock.hpp>
+#include <Nazara/Core/Error.hpp>
+#include <Nazara/Core/File.hpp>
+#include <Nazara/Core/LockGuard.hpp>
+#include <Nazara/Core/Mutex.hpp>
+#include <Nazara/Core/StringStream.hpp>
+#include <atomic>
+#include <memory>
+#include <vector>
+#include <Nazara/Core/Debug.hpp>
+
+namespace
+{
+	struct Event
+	{
+		const char* name;
+		nzUInt64 start;
+		nzUInt64 duration;
+	};
+
+	const unsigned int chunkEventCount = 4096;
+
+	struct EventChunk
+	{
+		Event events[chunkEventCount];
+		std::atomic_uint count;
+		std::atomic<EventChunk*> next;
+	};
+
+	// Seul le thread propriétaire écrit dans son tampon, l'export peut le lire en même temps grâce aux compteurs atomiques
+	struct ThreadBuffer
+	{
+		~ThreadBuffer()
+		{
+			while (first)
+			{
+				EventChunk* next = first->next;
+				delete first;
+
+				first = next;
+			}
+		}
+
+		EventChunk* current;
+		EventChunk* first;
+		NzString name;
+		unsigned int id;
+	};
+
+	std::atomic_bool s_enabled(true);
+	std::vector<std::unique_ptr<ThreadBuffer>> s_buffers;
+	NzMutex s_buffersMutex;
+	thread_local ThreadBuffer* s_currentBuffer = nullptr;
+
+	EventChunk* CreateChunk()
+	{
+		EventChunk* chunk = new EventChunk;
+		chunk->count = 0;
+		chunk->next = nullptr;
+
+		return chunk;
+	}
+
+	ThreadBuffer* GetThreadBuffer()
+	{
+		if (!s_currentBuffer)
+		{
+			std::unique_ptr<ThreadBuffer> buffer(new ThreadBuffer);
+			buffer->first = CreateChunk();
+			buffer->current = buffer->first;
+
+			NzLockGuard lock(s_buffersMutex);
+
+			buffer->id = s_buffers.size();
+			buffer->name = "Thread #" + NzString::Number(buffer->id);
+
+			s_currentBuffer = buffer.get();
+			s_buffers.push_back(std::move(buffer));
+		}
+
+		return s_currentBuffer;
+	}
+
+	void WriteEscaped(NzStringStream& stream, const char* string)
+	{
+		for (; *string; ++string)
+		{
+			char c = *string;
+			if (c == '"' || c == '\\')
+				stream << '\\';
+
+			stream << c;
+		}
+	}
+}
+
+void NzProfiler::Clear()
+{
+	// Ne doit pas être appelée pendant que d'autres threads enregistrent des zones
+	NzLockGuard lock(s_buffersMutex);
+
+	for (auto& buffer : s_buffers)
+	{
+		EventChunk* chunk = buffer->first->next;
+		while (chunk)
+		{
+			EventChunk* next = chunk->next;
+			delete chunk;
+
+			chunk = next;
+		}
+
+		buffer->first->count = 0;
+		buffer->first->next = nullptr;
+		buffer->current = buffer->first;
+	}
+}
+
+bool NzProfiler::ExportChromeTrace(const NzString& filePath)
+{
+	NzFile file(filePath, NzFile::Text | NzFile::WriteOnly | NzFile::Truncate);
+	if (!file.IsOpen())
+	{
+		NazaraError("Failed to open \"" + filePath + '"');
+		return false;
+	}
+
+	if (!file.Write(ExportChromeTrace()))
+	{
+		NazaraError("Failed to write trace");
+		return false;
+	}
+
+	return true;
+}
+
+NzString NzProfiler::ExportChromeTrace()
+{
+	// Format "Trace Event" lisible par chrome://tracing, les zones imbriquées sont déduites de leurs intervalles
+	NzStringStream stream;
+	stream << "{\"traceEvents\":[";
+
+	bool first = true;
+
+	NzLockGuard lock(s_buffersMutex);
+	for (auto& buffer : s_buffers)
+	{
+		if (!first)
+			stream << ',';
+
+		first = false;
+
+		stream << "\n{\"name\":\"thread_name\",\"ph\":\"M\",\"pid\":0,\"tid\":" << buffer->id << ",\"args\":{\"name\":\"";
+		WriteEscaped(stream, buffer->name.GetConstBuffer());
+		stream << "\"}}";
+
+		for (EventChunk* chunk = buffer->first; chunk; chunk = chunk->next.load(std::memory_order_acquire))
+		{
+			unsigned int count = chunk->count.load(std::memory_order_acquire);
+			for (unsigned int i = 0; i < count; ++i)
+			{
+				const Event& event = chunk->events[i];
+
+				stream << ",\n{\"name\":\"";
+				WriteEscaped(stream, event.name);
+				stream << "\",\"cat\":\"Nazara\",\"ph\":\"X\",\"pid\":0,\"tid\":" << buffer->id;
+				stream << ",\"ts\":" << event.start << ",\"dur\":" << event.duration << '}';
+			}
+		}
+	}
+
+	stream << "\n],\"displayTimeUnit\":\"ms\"}\n";
+
+	return stream.ToString();
+}
+
+unsigned int NzProfiler::GetEventCount()
+{
+	NzLockGuard lock(s_buffersMutex);
+
+	unsigned int count = 0;
+	for (auto& buffer : s_buffers)
+	{
+		for (EventChunk* chunk = buffer->first; chunk; chunk = chunk->next.load(std::memory_order_acquire))
+			count += chunk->count.load(std::memory_order_acquire);
+	}
+
+	return count;
+}
+
+bool NzProfiler::IsEnabled()
+{
+	return s_enabled;
+}
+
+void NzProfiler::RecordZone(const char* name, nzUInt64 start, nzUInt64 end)
+{
+	ThreadBuffer* buffer = GetThreadBuffer();
+
+	EventChunk* chunk = buffer->current;
+	unsigned int index = chunk->count.load(std::memory_order_relaxed);
+	if (index == chunkEventCount)
+	{
+		EventChunk* newChunk = CreateChunk();
+		chunk->next.store(newChunk, std::memory_order_release);
+
+		buffer->current = newChunk;
+		chunk = newChunk;
+		index = 0;
+	}
+
+	Event& event = chunk->events[index];
+	event.name = name;
+	event.start = start;
+	event.duration = end - start;
+
+	// L'événement n'est visible par l'export qu'une fois complètement écrit
+	chunk->count.store(index + 1, std::memory_order_release);
+}
+
+void NzProfiler::SetEnabled(bool enabled)
+{
+	s_enabled = enabled;
+}
+
+void NzProfiler::SetThreadName(const NzString& name)
+{
+	ThreadBuffer* buffer = GetThreadBuffer();
+
+	NzLockGuard lock(s_buffersMutex);
+	buffer->name = name;
+}
+
+NzProfilerZone::NzProfilerZone(const char* name) :
+m_name((s_enabled) ? name : nullptr),
+m_start((m_name) ? NzGetMicroseconds() : 0)
+{
+}
+
+NzProfilerZone::~NzProfilerZone()
+{
+	if (m_name)
+		NzProfiler::RecordZone(m_name, m_start, NzGetMicroseconds());
+}
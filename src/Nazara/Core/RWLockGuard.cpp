@@ -0,0 +1,29 @@
+// Copyright (C) 2014 Jérôme Leclercq
+// This file is part of the "Nazara Engine - Core module"
+// For conditions of distribution and use, see copyright notice in Config.hpp
+
+#include <Nazara/Core/RWLockGuard.hpp>
+#include <Nazara/Core/RWMutex.hpp>
+#include <Nazara/Core/Debug.hpp>
+
+NzReadLockGuard::NzReadLockGuard(NzRWMutex& mutex) :
+m_mutex(mutex)
+{
+	m_mutex.LockRead();
+}
+
+NzReadLockGuard::~NzReadLockGuard()
+{
+	m_mutex.UnlockRead();
+}
+
+NzWriteLockGuard::NzWriteLockGuard(NzRWMutex& mutex) :
+m_mutex(mutex)
+{
+	m_mutex.LockWrite();
+}
+
+NzWriteLockGuard::~NzWriteLockGuard()
+{
+	m_mutex.UnlockWrite();
+}
@@ -0,0 +1,55 @@
+// Copyright (C) 2014 Jérôme Leclercq
+// This file is part of the "Nazara Engine - Core module"
+// For conditions of distribution and use, see copyright notice in Config.hpp
+
+#include <Nazara/Core/RWMutex.hpp>
+
+#if defined(NAZARA_PLATFORM_WINDOWS)
+	#include <Nazara/Core/Win32/RWMutexImpl.hpp>
+#elif defined(NAZARA_PLATFORM_POSIX)
+	#include <Nazara/Core/Posix/RWMutexImpl.hpp>
+#else
+	#error Lack of implementation: RWMutex
+#endif
+
+#include <Nazara/Core/Debug.hpp>
+
+NzRWMutex::NzRWMutex()
+{
+	m_impl = new NzRWMutexImpl;
+}
+
+NzRWMutex::~NzRWMutex()
+{
+	delete m_impl;
+}
+
+void NzRWMutex::LockRead()
+{
+	m_impl->LockRead();
+}
+
+void NzRWMutex::LockWrite()
+{
+	m_impl->LockWrite();
+}
+
+bool NzRWMutex::TryLockRead()
+{
+	return m_impl->TryLockRead();
+}
+
+bool NzRWMutex::TryLockWrite()
+{
+	return m_impl->TryLockWrite();
+}
+
+void NzRWMutex::UnlockRead()
+{
+	m_impl->UnlockRead();
+}
+
+void NzRWMutex::UnlockWrite()
+{
+	m_impl->UnlockWrite();
+}
@@ -11,18 +11,63 @@
 #include <typeinfo>
 #include <Nazara/Core/Debug.hpp>
 
+namespace
+{
+	// Les notifications pouvant s'imbriquer (Un listener libérant une autre ressource), chaque thread garde la pile
+	// des ressources dont il est en train de notifier les listeners, et dont il tient donc déjà le verrou
+	struct NotificationScope
+	{
+		NotificationScope(const NzResource* notifiedResource);
+		~NotificationScope();
+
+		const NzResource* resource;
+		NotificationScope* previous;
+	};
+
+	thread_local NotificationScope* currentNotification = nullptr;
+
+	NotificationScope::NotificationScope(const NzResource* notifiedResource) :
+	resource(notifiedResource),
+	previous(currentNotification)
+	{
+		currentNotification = this;
+	}
+
+	NotificationScope::~NotificationScope()
+	{
+		currentNotification = previous;
+	}
+
+	bool IsNotifying(const NzResource* resource)
+	{
+		for (NotificationScope* scope = currentNotification; scope; scope = scope->previous)
+		{
+			if (scope->resource == resource)
+				return true;
+		}
+
+		return false;
+	}
+}
+
 NzResource::NzResource(bool persistent) :
 m_resourcePersistent(persistent),
-m_resourceReferenceCount(0),
-m_resourceListenersLocked(false)
+m_resourceReferenceCount(0)
 {
 }
 
 NzResource::~NzResource()
 {
-	m_resourceListenersLocked = true;
-	for (auto& pair : m_resourceListeners)
-		pair.first->OnResourceReleased(this, pair.second.first);
+	NotificationScope scope(this);
+
+	// Un listener peut encore s'ajouter ou se retirer depuis l'évènement (Voir NotifyResourceListeners)
+	unsigned int count = m_resourceListeners.size();
+	for (unsigned int i = 0; i < count; ++i)
+	{
+		const ResourceListenerEntry& entry = m_resourceListeners[i];
+		if (entry.referenceCount > 0)
+			entry.listener->OnResourceReleased(this, entry.index);
+	}
 
 	#if NAZARA_CORE_SAFE
 	if (m_resourceReferenceCount > 0)
@@ -32,15 +77,31 @@ NzResource::~NzResource()
 
 void NzResource::AddResourceListener(NzResourceListener* listener, int index) const
 {
-	///DOC: Est ignoré si appelé depuis un évènement
-	NazaraLock(m_mutex)
-
-	if (!m_resourceListenersLocked)
+	///DOC: Depuis un évènement de cette ressource, le listener ne sera notifié qu'à partir de l'évènement suivant
+	// Le thread qui notifie tient déjà le verrou
+	bool notifying = IsNotifying(this);
+	if (!notifying)
+		LockResourceListeners();
+
+	bool found = false;
+	for (ResourceListenerEntry& entry : m_resourceListeners)
 	{
-		auto pair = m_resourceListeners.insert(std::make_pair(listener, std::make_pair(index, 1U)));
-		if (!pair.second)
-			pair.first->second.second++;
+		if (entry.listener == listener)
+		{
+			// Un listener retiré pendant la notification en cours est toujours présent, avec un compteur nul
+			if (entry.referenceCount++ == 0)
+				entry.index = index;
+
+			found = true;
+			break;
+		}
 	}
+
+	if (!found)
+		m_resourceListeners.push_back(ResourceListenerEntry{listener, index, 1U});
+
+	if (!notifying)
+		UnlockResourceListeners();
 }
 
 void NzResource::AddResourceReference() const
@@ -60,15 +121,24 @@ bool NzResource::IsPersistent() const
 
 void NzResource::RemoveResourceListener(NzResourceListener* listener) const
 {
-	///DOC: Est ignoré si appelé depuis un évènement
-	NazaraLock(m_mutex);
-
-	if (!m_resourceListenersLocked)
+	///DOC: Depuis un évènement de cette ressource, le listener n'est plus appelé par la suite de la notification
+	// Le thread qui notifie tient déjà le verrou
+	bool notifying = IsNotifying(this);
+	if (!notifying)
+		LockResourceListeners();
+
+	unsigned int count = m_resourceListeners.size();
+	for (unsigned int i = 0; i < count; ++i)
 	{
-		ResourceListenerMap::iterator it = m_resourceListeners.find(listener);
-		if (it != m_resourceListeners.end())
-			RemoveResourceListenerIterator(it);
+		if (m_resourceListeners[i].listener == listener)
+		{
+			RemoveResourceListenerEntry(i, notifying);
+			break;
+		}
 	}
+
+	if (!notifying)
+		UnlockResourceListeners();
 }
 
 bool NzResource::RemoveResourceReference() const
@@ -107,45 +177,77 @@ bool NzResource::SetPersistent(bool persistent, bool checkReferenceCount)
 
 void NzResource::NotifyCreated()
 {
-	NazaraLock(m_mutex)
-
-	m_resourceListenersLocked = true;
+	NotifyResourceListeners(&NzResourceListener::OnResourceCreated);
+}
 
-	auto it = m_resourceListeners.begin();
-	while (it != m_resourceListeners.end())
-	{
-		if (!it->first->OnResourceCreated(this, it->second.first))
-			RemoveResourceListenerIterator(it++);
-		else
-			++it;
-	}
+void NzResource::NotifyDestroy()
+{
+	NotifyResourceListeners(&NzResourceListener::OnResourceDestroy);
+}
 
-	m_resourceListenersLocked = false;
+void NzResource::LockResourceListeners() const
+{
+	#if NAZARA_CORE_THREADSAFE && NAZARA_THREADSAFETY_RESOURCE
+	// Les sections critiques sont très courtes (hors évènements), un spinlock évite l'appel système d'un mutex
+	m_resourceListenersSpinlock.Lock();
+	#endif
 }
 
-void NzResource::NotifyDestroy()
+void NzResource::NotifyResourceListeners(bool (NzResourceListener::*callback)(const NzResource*, int))
 {
-	NazaraLock(m_mutex)
+	// Le verrou est tenu pendant toute la notification : un listener retiré par un autre thread ne peut donc plus être
+	// appelé une fois RemoveResourceListener terminé (Le spinlock cède son temps processeur en cas d'attente prolongée)
+	LockResourceListeners();
 
-	m_resourceListenersLocked = true;
+	NotificationScope scope(this);
 
-	auto it = m_resourceListeners.begin();
-	while (it != m_resourceListeners.end())
+	// Les listeners ajoutés pendant la notification ne sont pas notifiés, et les entrées retirées restent en place
+	// (Avec un compteur nul) jusqu'à la fin du parcours, le tableau peut cependant être réalloué par un ajout
+	unsigned int count = m_resourceListeners.size();
+	for (unsigned int i = 0; i < count; ++i)
 	{
-		if (!it->first->OnResourceDestroy(this, it->second.first))
-			RemoveResourceListenerIterator(it++);
+		const ResourceListenerEntry& entry = m_resourceListeners[i];
+		if (entry.referenceCount == 0)
+			continue;
+
+		if (!(entry.listener->*callback)(this, entry.index) && m_resourceListeners[i].referenceCount > 0)
+			RemoveResourceListenerEntry(i, true);
+	}
+
+	unsigned int i = 0;
+	while (i < m_resourceListeners.size())
+	{
+		if (m_resourceListeners[i].referenceCount == 0)
+		{
+			// L'ordre des listeners n'a pas d'importance, on remplace celui-ci par le dernier pour éviter un décalage
+			m_resourceListeners[i] = m_resourceListeners.back();
+			m_resourceListeners.pop_back();
+		}
 		else
-			++it;
+			i++;
 	}
 
-	m_resourceListenersLocked = false;
+	UnlockResourceListeners();
 }
 
-void NzResource::RemoveResourceListenerIterator(ResourceListenerMap::iterator iterator) const
+void NzResource::RemoveResourceListenerEntry(unsigned int entryIndex, bool notifying) const
 {
-	unsigned int& referenceCount = iterator->second.second;
-	if (referenceCount == 1)
-		m_resourceListeners.erase(iterator);
+	ResourceListenerEntry& entry = m_resourceListeners[entryIndex];
+	if (entry.referenceCount == 1 && !notifying)
+	{
+		// L'ordre des listeners n'a pas d'importance, on remplace celui-ci par le dernier pour éviter un décalage
+		if (entryIndex != m_resourceListeners.size()-1)
+			entry = m_resourceListeners.back();
+
+		m_resourceListeners.pop_back();
+	}
 	else
-		referenceCount--;
+		entry.referenceCount--;
+}
+
+void NzResource::UnlockResourceListeners() const
+{
+	#if NAZARA_CORE_THREADSAFE && NAZARA_THREADSAFETY_RESOURCE
+	m_resourceListenersSpinlock.Unlock();
+	#endif
 }
@@ -0,0 +1,482 @@
+// Copyright (C) 2014 Jérôme Leclercq
+// This file is part of the "Nazara Engine - Core module"
+// For conditions of distribution and use, see copyright notice in Config.hpp
+
+#include <Nazara/Core/Simd.hpp>
+#include <Nazara/Core/HardwareInfo.hpp>
+#include <cmath>
+#include <cstring>
+#include <Nazara/Core/Debug.hpp>
+
+namespace
+{
+	// Les versions scalaires reprennent exactement les calculs du template de NzMatrix4
+	void ScalarComputeAABB(const void* positions, unsigned int stride, unsigned int count, float* minimum, float* maximum)
+	{
+		// Les comparaisons sous forme de ternaires sont compilées sans branchement (minss/maxss)
+		float minX = minimum[0], minY = minimum[1], minZ = minimum[2];
+		float maxX = maximum[0], maxY = maximum[1], maxZ = maximum[2];
+
+		const nzUInt8* ptr = static_cast<const nzUInt8*>(positions);
+		for (unsigned int i = 0; i < count; ++i)
+		{
+			const float* position = reinterpret_cast<const float*>(ptr);
+			minX = (position[0] < minX) ? position[0] : minX;
+			minY = (position[1] < minY) ? position[1] : minY;
+			minZ = (position[2] < minZ) ? position[2] : minZ;
+			maxX = (position[0] > maxX) ? position[0] : maxX;
+			maxY = (position[1] > maxY) ? position[1] : maxY;
+			maxZ = (position[2] > maxZ) ? position[2] : maxZ;
+
+			ptr += stride;
+		}
+
+		minimum[0] = minX;
+		minimum[1] = minY;
+		minimum[2] = minZ;
+		maximum[0] = maxX;
+		maximum[1] = maxY;
+		maximum[2] = maxZ;
+	}
+
+	void ScalarMatrix4Concatenate(const float* a, const float* b, float* result)
+	{
+		float temp[16];
+		for (unsigned int i = 0; i < 4; ++i)
+		{
+			const float* row = &a[i*4];
+			for (unsigned int j = 0; j < 4; ++j)
+				temp[i*4 + j] = row[0]*b[j] + row[1]*b[4 + j] + row[2]*b[8 + j] + row[3]*b[12 + j];
+		}
+
+		std::memcpy(result, temp, 16*sizeof(float));
+	}
+
+	void ScalarMatrix4ConcatenateAffine(const float* a, const float* b, float* result)
+	{
+		float temp[16];
+		for (unsigned int i = 0; i < 3; ++i)
+		{
+			const float* row = &a[i*4];
+			for (unsigned int j = 0; j < 3; ++j)
+				temp[i*4 + j] = row[0]*b[j] + row[1]*b[4 + j] + row[2]*b[8 + j];
+
+			temp[i*4 + 3] = 0.f;
+		}
+
+		for (unsigned int j = 0; j < 3; ++j)
+			temp[12 + j] = a[12]*b[j] + a[13]*b[4 + j] + a[14]*b[8 + j] + b[12 + j];
+
+		temp[15] = 1.f;
+
+		std::memcpy(result, temp, 16*sizeof(float));
+	}
+
+	void ScalarMatrix4InverseAffine(const float* m, float determinant, float* result)
+	{
+		float inv[16];
+		inv[0] = m[5]*m[10] - m[9]*m[6];
+		inv[1] = -m[1]*m[10] + m[9]*m[2];
+		inv[2] = m[1]*m[6] - m[5]*m[2];
+		inv[3] = 0.f;
+
+		inv[4] = -m[4]*m[10] + m[8]*m[6];
+		inv[5] = m[0]*m[10] - m[8]*m[2];
+		inv[6] = -m[0]*m[6] + m[4]*m[2];
+		inv[7] = 0.f;
+
+		inv[8] = m[4]*m[9] - m[8]*m[5];
+		inv[9] = -m[0]*m[9] + m[8]*m[1];
+		inv[10] = m[0]*m[5] - m[4]*m[1];
+		inv[11] = 0.f;
+
+		inv[12] = -m[4]*m[9]*m[14] + m[4]*m[10]*m[13] + m[8]*m[5]*m[14] - m[8]*m[6]*m[13] - m[12]*m[5]*m[10] + m[12]*m[6]*m[9];
+		inv[13] = m[0]*m[9]*m[14] - m[0]*m[10]*m[13] - m[8]*m[1]*m[14] + m[8]*m[2]*m[13] + m[12]*m[1]*m[10] - m[12]*m[2]*m[9];
+		inv[14] = -m[0]*m[5]*m[14] + m[0]*m[6]*m[13] + m[4]*m[1]*m[14] - m[4]*m[2]*m[13] - m[12]*m[1]*m[6] + m[12]*m[2]*m[5];
+
+		float invDet = 1.f / determinant;
+		for (unsigned int i = 0; i < 16; ++i)
+			inv[i] *= invDet;
+
+		inv[15] = 1.f;
+
+		std::memcpy(result, inv, 16*sizeof(float));
+	}
+
+	// La matrice est copiée localement, le compilateur devant sinon la relire après chaque écriture
+	struct ScalarVectorTransform
+	{
+		ScalarVectorTransform(const float* m, bool translate) :
+		m11(m[0]), m12(m[1]), m13(m[2]),
+		m21(m[4]), m22(m[5]), m23(m[6]),
+		m31(m[8]), m32(m[9]), m33(m[10]),
+		m41((translate) ? m[12] : 0.f), m42((translate) ? m[13] : 0.f), m43((translate) ? m[14] : 0.f)
+		{
+		}
+
+		template<bool normalize>
+		void Transform(float x, float y, float z, float* rx, float* ry, float* rz) const
+		{
+			float tx = m11*x + m21*y + m31*z + m41;
+			float ty = m12*x + m22*y + m32*z + m42;
+			float tz = m13*x + m23*y + m33*z + m43;
+
+			if (normalize)
+			{
+				float squaredLength = tx*tx + ty*ty + tz*tz;
+				if (squaredLength > 0.f)
+				{
+					float invLength = 1.f / std::sqrt(squaredLength);
+					tx *= invLength;
+					ty *= invLength;
+					tz *= invLength;
+				}
+			}
+
+			*rx = tx;
+			*ry = ty;
+			*rz = tz;
+		}
+
+		float m11, m12, m13;
+		float m21, m22, m23;
+		float m31, m32, m33;
+		float m41, m42, m43;
+	};
+
+	template<bool normalize>
+	void ScalarTransformVectorsImpl(const ScalarVectorTransform& transform, const nzUInt8* inputPtr, unsigned int inputStride, nzUInt8* outputPtr, unsigned int outputStride, unsigned int count)
+	{
+		for (unsigned int i = 0; i < count; ++i)
+		{
+			const float* in = reinterpret_cast<const float*>(inputPtr);
+			float* out = reinterpret_cast<float*>(outputPtr);
+			transform.Transform<normalize>(in[0], in[1], in[2], &out[0], &out[1], &out[2]);
+
+			inputPtr += inputStride;
+			outputPtr += outputStride;
+		}
+	}
+
+	template<bool normalize>
+	void ScalarTransformVectorsSoAImpl(const ScalarVectorTransform& transform, const float* inputX, const float* inputY, const float* inputZ, float* outputX, float* outputY, float* outputZ, unsigned int count)
+	{
+		for (unsigned int i = 0; i < count; ++i)
+			transform.Transform<normalize>(inputX[i], inputY[i], inputZ[i], &outputX[i], &outputY[i], &outputZ[i]);
+	}
+
+	void ScalarTransformVectors(const float* m, const void* input, unsigned int inputStride, void* output, unsigned int outputStride, unsigned int count, bool translate, bool normalize)
+	{
+		ScalarVectorTransform transform(m, translate);
+		const nzUInt8* inputPtr = static_cast<const nzUInt8*>(input);
+		nzUInt8* outputPtr = static_cast<nzUInt8*>(output);
+
+		if (normalize)
+			ScalarTransformVectorsImpl<true>(transform, inputPtr, inputStride, outputPtr, outputStride, count);
+		else
+			ScalarTransformVectorsImpl<false>(transform, inputPtr, inputStride, outputPtr, outputStride, count);
+	}
+
+	void ScalarTransformVectorsSoA(const float* m, const float* inputX, const float* inputY, const float* inputZ, float* outputX, float* outputY, float* outputZ, unsigned int count, bool translate, bool normalize)
+	{
+		ScalarVectorTransform transform(m, translate);
+
+		if (normalize)
+			ScalarTransformVectorsSoAImpl<true>(transform, inputX, inputY, inputZ, outputX, outputY, outputZ, count);
+		else
+			ScalarTransformVectorsSoAImpl<false>(transform, inputX, inputY, inputZ, outputX, outputY, outputZ, count);
+	}
+
+	#if NAZARA_SIMD_SSE2
+	// Les chargements ne supposent aucun alignement, une matrice alignée (NAZARA_MATH_MATRIX4_ALIGNED) évite simplement
+	// qu'une ligne chevauche deux lignes de cache
+	#define NzSplat(v, i) _mm_shuffle_ps(v, v, _MM_SHUFFLE(i, i, i, i))
+
+	inline __m128 SSECombine(const float* row, __m128 b0, __m128 b1, __m128 b2, __m128 b3)
+	{
+		__m128 a = _mm_loadu_ps(row);
+
+		__m128 r = _mm_mul_ps(NzSplat(a, 0), b0);
+		r = _mm_add_ps(r, _mm_mul_ps(NzSplat(a, 1), b1));
+		r = _mm_add_ps(r, _mm_mul_ps(NzSplat(a, 2), b2));
+		r = _mm_add_ps(r, _mm_mul_ps(NzSplat(a, 3), b3));
+
+		return r;
+	}
+
+	inline __m128 SSECross(__m128 a, __m128 b)
+	{
+		__m128 ayzx = _mm_shuffle_ps(a, a, _MM_SHUFFLE(3, 0, 2, 1));
+		__m128 azxy = _mm_shuffle_ps(a, a, _MM_SHUFFLE(3, 1, 0, 2));
+		__m128 byzx = _mm_shuffle_ps(b, b, _MM_SHUFFLE(3, 0, 2, 1));
+		__m128 bzxy = _mm_shuffle_ps(b, b, _MM_SHUFFLE(3, 1, 0, 2));
+
+		return _mm_sub_ps(_mm_mul_ps(ayzx, bzxy), _mm_mul_ps(azxy, byzx));
+	}
+
+	inline __m128 SSEMaskXYZ()
+	{
+		return _mm_castsi128_ps(_mm_set_epi32(0, -1, -1, -1));
+	}
+
+	inline __m128 SSELoadVector3(const float* ptr)
+	{
+		// Seuls trois flottants sont lus, le vecteur pouvant se trouver en fin de tampon
+		__m128 xy = _mm_castpd_ps(_mm_load_sd(reinterpret_cast<const double*>(ptr)));
+		return _mm_movelh_ps(xy, _mm_load_ss(&ptr[2]));
+	}
+
+	inline void SSEStoreVector3(float* ptr, __m128 v)
+	{
+		_mm_storel_pi(reinterpret_cast<__m64*>(ptr), v);
+		_mm_store_ss(&ptr[2], _mm_movehl_ps(v, v));
+	}
+
+	void SSEComputeAABB(const void* positions, unsigned int stride, unsigned int count, float* minimum, float* maximum)
+	{
+		const nzUInt8* ptr = static_cast<const nzUInt8*>(positions);
+
+		// Deux paires d'accumulateurs, pour ne pas attendre le résultat du min/max précédent à chaque position
+		__m128 min0 = SSELoadVector3(minimum);
+		__m128 max0 = SSELoadVector3(maximum);
+		__m128 min1 = min0;
+		__m128 max1 = max0;
+
+		unsigned int pairCount = count/2;
+		for (unsigned int i = 0; i < pairCount; ++i)
+		{
+			__m128 a = SSELoadVector3(reinterpret_cast<const float*>(ptr));
+			__m128 b = SSELoadVector3(reinterpret_cast<const float*>(ptr + stride));
+
+			min0 = _mm_min_ps(min0, a);
+			max0 = _mm_max_ps(max0, a);
+			min1 = _mm_min_ps(min1, b);
+			max1 = _mm_max_ps(max1, b);
+
+			ptr += 2*stride;
+		}
+
+		if (count & 1)
+		{
+			__m128 a = SSELoadVector3(reinterpret_cast<const float*>(ptr));
+			min0 = _mm_min_ps(min0, a);
+			max0 = _mm_max_ps(max0, a);
+		}
+
+		SSEStoreVector3(minimum, _mm_min_ps(min0, min1));
+		SSEStoreVector3(maximum, _mm_max_ps(max0, max1));
+	}
+
+	void SSEMatrix4Concatenate(const float* a, const float* b, float* result)
+	{
+		__m128 b0 = _mm_loadu_ps(&b[0]);
+		__m128 b1 = _mm_loadu_ps(&b[4]);
+		__m128 b2 = _mm_loadu_ps(&b[8]);
+		__m128 b3 = _mm_loadu_ps(&b[12]);
+
+		// Toutes les lignes sont calculées avant l'écriture, la destination pouvant être l'une des sources
+		__m128 r0 = SSECombine(&a[0], b0, b1, b2, b3);
+		__m128 r1 = SSECombine(&a[4], b0, b1, b2, b3);
+		__m128 r2 = SSECombine(&a[8], b0, b1, b2, b3);
+		__m128 r3 = SSECombine(&a[12], b0, b1, b2, b3);
+
+		_mm_storeu_ps(&result[0], r0);
+		_mm_storeu_ps(&result[4], r1);
+		_mm_storeu_ps(&result[8], r2);
+		_mm_storeu_ps(&result[12], r3);
+	}
+
+	void SSEMatrix4ConcatenateAffine(const float* a, const float* b, float* result)
+	{
+		__m128 b0 = _mm_loadu_ps(&b[0]);
+		__m128 b1 = _mm_loadu_ps(&b[4]);
+		__m128 b2 = _mm_loadu_ps(&b[8]);
+		__m128 b3 = _mm_loadu_ps(&b[12]);
+
+		// Les dernières colonnes sont ignorées puis forcées à (0, 0, 0, 1), comme pour la version scalaire
+		__m128 a0 = _mm_loadu_ps(&a[0]);
+		__m128 a1 = _mm_loadu_ps(&a[4]);
+		__m128 a2 = _mm_loadu_ps(&a[8]);
+		__m128 a3 = _mm_loadu_ps(&a[12]);
+
+		__m128 r0 = _mm_add_ps(_mm_add_ps(_mm_mul_ps(NzSplat(a0, 0), b0), _mm_mul_ps(NzSplat(a0, 1), b1)), _mm_mul_ps(NzSplat(a0, 2), b2));
+		__m128 r1 = _mm_add_ps(_mm_add_ps(_mm_mul_ps(NzSplat(a1, 0), b0), _mm_mul_ps(NzSplat(a1, 1), b1)), _mm_mul_ps(NzSplat(a1, 2), b2));
+		__m128 r2 = _mm_add_ps(_mm_add_ps(_mm_mul_ps(NzSplat(a2, 0), b0), _mm_mul_ps(NzSplat(a2, 1), b1)), _mm_mul_ps(NzSplat(a2, 2), b2));
+		__m128 r3 = _mm_add_ps(_mm_add_ps(_mm_add_ps(_mm_mul_ps(NzSplat(a3, 0), b0), _mm_mul_ps(NzSplat(a3, 1), b1)), _mm_mul_ps(NzSplat(a3, 2), b2)), b3);
+
+		__m128 mask = SSEMaskXYZ();
+		_mm_storeu_ps(&result[0], _mm_and_ps(r0, mask));
+		_mm_storeu_ps(&result[4], _mm_and_ps(r1, mask));
+		_mm_storeu_ps(&result[8], _mm_and_ps(r2, mask));
+		_mm_storeu_ps(&result[12], _mm_or_ps(_mm_and_ps(r3, mask), _mm_set_ps(1.f, 0.f, 0.f, 0.f)));
+	}
+
+	void SSEMatrix4InverseAffine(const float* m, float determinant, float* result)
+	{
+		__m128 mask = SSEMaskXYZ();
+		__m128 r0 = _mm_and_ps(_mm_loadu_ps(&m[0]), mask);
+		__m128 r1 = _mm_and_ps(_mm_loadu_ps(&m[4]), mask);
+		__m128 r2 = _mm_and_ps(_mm_loadu_ps(&m[8]), mask);
+		__m128 r3 = _mm_loadu_ps(&m[12]);
+
+		// Les colonnes de l'inverse de la partie 3x3 sont les produits vectoriels des lignes
+		__m128 c0 = SSECross(r1, r2);
+		__m128 c1 = SSECross(r2, r0);
+		__m128 c2 = SSECross(r0, r1);
+		__m128 c3 = _mm_setzero_ps();
+		_MM_TRANSPOSE4_PS(c0, c1, c2, c3);
+
+		__m128 invDet = _mm_set1_ps(1.f / determinant);
+		c0 = _mm_mul_ps(c0, invDet);
+		c1 = _mm_mul_ps(c1, invDet);
+		c2 = _mm_mul_ps(c2, invDet);
+
+		// Translation: -t * R⁻¹
+		__m128 t = _mm_add_ps(_mm_add_ps(_mm_mul_ps(NzSplat(r3, 0), c0), _mm_mul_ps(NzSplat(r3, 1), c1)), _mm_mul_ps(NzSplat(r3, 2), c2));
+		t = _mm_and_ps(_mm_sub_ps(_mm_setzero_ps(), t), mask);
+
+		_mm_storeu_ps(&result[0], c0);
+		_mm_storeu_ps(&result[4], c1);
+		_mm_storeu_ps(&result[8], c2);
+		_mm_storeu_ps(&result[12], _mm_or_ps(t, _mm_set_ps(1.f, 0.f, 0.f, 0.f)));
+	}
+
+	void SSETransformVectors(const float* m, const void* input, unsigned int inputStride, void* output, unsigned int outputStride, unsigned int count, bool translate, bool normalize)
+	{
+		__m128 mask = SSEMaskXYZ();
+		__m128 r0 = _mm_and_ps(_mm_loadu_ps(&m[0]), mask);
+		__m128 r1 = _mm_and_ps(_mm_loadu_ps(&m[4]), mask);
+		__m128 r2 = _mm_and_ps(_mm_loadu_ps(&m[8]), mask);
+		__m128 r3 = (translate) ? _mm_and_ps(_mm_loadu_ps(&m[12]), mask) : _mm_setzero_ps();
+
+		const nzUInt8* inPtr = static_cast<const nzUInt8*>(input);
+		nzUInt8* outPtr = static_cast<nzUInt8*>(output);
+
+		for (unsigned int i = 0; i < count; ++i)
+		{
+			// Seuls trois flottants sont lus et écrits, le vecteur suivant pouvant appartenir à un autre attribut
+			const float* in = reinterpret_cast<const float*>(inPtr);
+			__m128 r = _mm_add_ps(_mm_mul_ps(_mm_set1_ps(in[0]), r0), r3);
+			r = _mm_add_ps(r, _mm_mul_ps(_mm_set1_ps(in[1]), r1));
+			r = _mm_add_ps(r, _mm_mul_ps(_mm_set1_ps(in[2]), r2));
+
+			if (normalize)
+			{
+				__m128 squared = _mm_mul_ps(r, r);
+				__m128 squaredLength = _mm_add_ps(_mm_add_ps(NzSplat(squared, 0), NzSplat(squared, 1)), NzSplat(squared, 2));
+				__m128 normalized = _mm_div_ps(r, _mm_sqrt_ps(squaredLength));
+				r = _mm_and_ps(normalized, _mm_cmpgt_ps(squaredLength, _mm_setzero_ps())); // Un vecteur nul le reste
+			}
+
+			SSEStoreVector3(reinterpret_cast<float*>(outPtr), r);
+
+			inPtr += inputStride;
+			outPtr += outputStride;
+		}
+	}
+
+	void SSETransformVectorsSoA(const float* m, const float* inputX, const float* inputY, const float* inputZ, float* outputX, float* outputY, float* outputZ, unsigned int count, bool translate, bool normalize)
+	{
+		__m128 m11 = _mm_set1_ps(m[0]), m12 = _mm_set1_ps(m[1]), m13 = _mm_set1_ps(m[2]);
+		__m128 m21 = _mm_set1_ps(m[4]), m22 = _mm_set1_ps(m[5]), m23 = _mm_set1_ps(m[6]);
+		__m128 m31 = _mm_set1_ps(m[8]), m32 = _mm_set1_ps(m[9]), m33 = _mm_set1_ps(m[10]);
+		__m128 m41 = _mm_setzero_ps(), m42 = _mm_setzero_ps(), m43 = _mm_setzero_ps();
+		if (translate)
+		{
+			m41 = _mm_set1_ps(m[12]);
+			m42 = _mm_set1_ps(m[13]);
+			m43 = _mm_set1_ps(m[14]);
+		}
+
+		// Quatre vecteurs par itération, le reste passe par la version scalaire
+		unsigned int blockCount = count/4;
+		for (unsigned int i = 0; i < blockCount*4; i += 4)
+		{
+			__m128 x = _mm_loadu_ps(&inputX[i]);
+			__m128 y = _mm_loadu_ps(&inputY[i]);
+			__m128 z = _mm_loadu_ps(&inputZ[i]);
+
+			__m128 rx = _mm_add_ps(_mm_add_ps(_mm_add_ps(_mm_mul_ps(x, m11), _mm_mul_ps(y, m21)), _mm_mul_ps(z, m31)), m41);
+			__m128 ry = _mm_add_ps(_mm_add_ps(_mm_add_ps(_mm_mul_ps(x, m12), _mm_mul_ps(y, m22)), _mm_mul_ps(z, m32)), m42);
+			__m128 rz = _mm_add_ps(_mm_add_ps(_mm_add_ps(_mm_mul_ps(x, m13), _mm_mul_ps(y, m23)), _mm_mul_ps(z, m33)), m43);
+
+			if (normalize)
+			{
+				__m128 squaredLength = _mm_add_ps(_mm_add_ps(_mm_mul_ps(rx, rx), _mm_mul_ps(ry, ry)), _mm_mul_ps(rz, rz));
+				__m128 nonZero = _mm_cmpgt_ps(squaredLength, _mm_setzero_ps());
+				__m128 length = _mm_sqrt_ps(squaredLength);
+
+				rx = _mm_and_ps(_mm_div_ps(rx, length), nonZero);
+				ry = _mm_and_ps(_mm_div_ps(ry, length), nonZero);
+				rz = _mm_and_ps(_mm_div_ps(rz, length), nonZero);
+			}
+
+			_mm_storeu_ps(&outputX[i], rx);
+			_mm_storeu_ps(&outputY[i], ry);
+			_mm_storeu_ps(&outputZ[i], rz);
+		}
+
+		unsigned int offset = blockCount*4;
+		ScalarTransformVectorsSoA(m, &inputX[offset], &inputY[offset], &inputZ[offset], &outputX[offset], &outputY[offset], &outputZ[offset], count - offset, translate, normalize);
+	}
+
+	#undef NzSplat
+	#endif
+
+	bool s_enabled = false;
+}
+
+bool NzSimd::Enable(bool enable)
+{
+	///DOC: Ne doit pas être appelé pendant qu'un autre thread effectue des calculs
+	if (enable)
+	{
+		if (!IsSupported())
+			return false;
+
+		#if NAZARA_SIMD_SSE2
+		ComputeAABB = SSEComputeAABB;
+		Matrix4Concatenate = SSEMatrix4Concatenate;
+		Matrix4ConcatenateAffine = SSEMatrix4ConcatenateAffine;
+		Matrix4InverseAffine = SSEMatrix4InverseAffine;
+		TransformVectors = SSETransformVectors;
+		TransformVectorsSoA = SSETransformVectorsSoA;
+		#endif
+	}
+	else
+	{
+		ComputeAABB = ScalarComputeAABB;
+		Matrix4Concatenate = ScalarMatrix4Concatenate;
+		Matrix4ConcatenateAffine = ScalarMatrix4ConcatenateAffine;
+		Matrix4InverseAffine = ScalarMatrix4InverseAffine;
+		TransformVectors = ScalarTransformVectors;
+		TransformVectorsSoA = ScalarTransformVectorsSoA;
+	}
+
+	s_enabled = enable;
+	return true;
+}
+
+bool NzSimd::IsEnabled()
+{
+	return s_enabled;
+}
+
+bool NzSimd::IsSupported()
+{
+	#if NAZARA_SIMD_SSE2
+	if (!NzHardwareInfo::IsInitialized() && !NzHardwareInfo::Initialize())
+		return false;
+
+	return NzHardwareInfo::HasCapability(nzProcessorCap_SSE2);
+	#else
+	return false;
+	#endif
+}
+
+void (*NzSimd::ComputeAABB)(const void* positions, unsigned int stride, unsigned int count, float* minimum, float* maximum) = ScalarComputeAABB;
+void (*NzSimd::Matrix4Concatenate)(const float* left, const float* right, float* result) = ScalarMatrix4Concatenate;
+void (*NzSimd::Matrix4ConcatenateAffine)(const float* left, const float* right, float* result) = ScalarMatrix4ConcatenateAffine;
+void (*NzSimd::Matrix4InverseAffine)(const float* matrix, float determinant, float* result) = ScalarMatrix4InverseAffine;
+void (*NzSimd::TransformVectors)(const float* matrix, const void* input, unsigned int inputStride, void* output, unsigned int outputStride, unsigned int count, bool translate, bool normalize) = ScalarTransformVectors;
+void (*NzSimd::TransformVectorsSoA)(const float* matrix, const float* inputX, const float* inputY, const float* inputZ, float* outputX, float* outputY, float* outputZ, unsigned int count, bool translate, bool normalize) = ScalarTransformVectorsSoA;
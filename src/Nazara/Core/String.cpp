@@ -16,6 +16,13 @@
 #include <limits>
 #include <sstream>
 #include <Utfcpp/utf8.h>
+
+// SSE2 fait partie de l'ABI x64, on peut donc l'utiliser sans vérification à l'exécution
+#if defined(__SSE2__) || defined(_M_X64) || (defined(_M_IX86_FP) && _M_IX86_FP >= 2)
+	#define NAZARA_STRING_SSE2
+	#include <emmintrin.h>
+#endif
+
 #include <Nazara/Core/Debug.hpp>
 
 // Cet algorithme est inspiré de la documentation de Qt
@@ -60,52 +67,218 @@ inline int nzStrcasecmp(const char* s1, const char* s2)
 
 inline int nzUnicodecasecmp(const char* s1, const char* s2)
 {
-    int ret = 0;
-	utf8::unchecked::iterator<const char*> it1(s1);
-	utf8::unchecked::iterator<const char*> it2(s2);
+	int ret = 0;
 
-    while (!(ret = NzUnicode::GetLowercase(*it1) - NzUnicode::GetLowercase(*it2)) && *it2)
-        ++it1, ++it2;
+	while (true)
+	{
+		unsigned char c1 = static_cast<unsigned char>(*s1);
+		unsigned char c2 = static_cast<unsigned char>(*s2);
 
-    return ret != 0 ? (ret > 0 ? 1 : -1) : 0;
+		// Chemin rapide: deux caractères ASCII se comparent sans passer par les tables Unicode
+		if ((c1 | c2) < 0x80)
+		{
+			ret = static_cast<unsigned char>(nzToLower(c1)) - static_cast<unsigned char>(nzToLower(c2));
+			if (ret != 0 || c2 == '\0')
+				break;
+
+			s1++;
+			s2++;
+		}
+		else
+		{
+			ret = NzUnicode::GetLowercase(utf8::unchecked::next(s1)) - NzUnicode::GetLowercase(utf8::unchecked::next(s2));
+			if (ret != 0)
+				break;
+		}
+	}
+
+	return ret != 0 ? (ret > 0 ? 1 : -1) : 0;
+}
+
+#ifdef NAZARA_STRING_SSE2
+inline unsigned int nzCountTrailingZeros(unsigned int mask)
+{
+	#if defined(NAZARA_COMPILER_GCC) || defined(NAZARA_COMPILER_CLANG) || defined(NAZARA_COMPILER_INTEL)
+	return __builtin_ctz(mask);
+	#else
+	unsigned int count = 0;
+	while ((mask & 1) == 0)
+	{
+		mask >>= 1;
+		count++;
+	}
+
+	return count;
+	#endif
+}
+#endif
+
+inline bool nzIsAscii(const char* string, unsigned int size)
+{
+	unsigned int i = 0;
+
+	#ifdef NAZARA_STRING_SSE2
+	for (; i + 16 <= size; i += 16)
+	{
+		__m128i block = _mm_loadu_si128(reinterpret_cast<const __m128i*>(&string[i]));
+		if (_mm_movemask_epi8(block) != 0)
+			return false;
+	}
+	#endif
+
+	for (; i < size; ++i)
+	{
+		if (static_cast<unsigned char>(string[i]) >= 0x80)
+			return false;
+	}
+
+	return true;
+}
+
+inline bool nzAsciiEqualsCaseInsensitive(const char* s1, const char* s2, unsigned int size)
+{
+	for (unsigned int i = 0; i < size; ++i)
+	{
+		if (nzToLower(s1[i]) != nzToLower(s2[i]))
+			return false;
+	}
+
+	return true;
+}
+
+// Recherche d'une sous-chaîne, renvoie un pointeur sur la première occurrence ou nullptr
+// La version SSE2 filtre seize positions à la fois sur le premier et le dernier octet du motif, avant de vérifier le reste
+inline const char* nzFindSubstring(const char* string, unsigned int size, const char* pattern, unsigned int patternSize)
+{
+	if (patternSize == 0 || patternSize > size)
+		return nullptr;
+
+	if (patternSize == 1)
+		return static_cast<const char*>(std::memchr(string, pattern[0], size));
+
+	unsigned int last = size - patternSize; // Dernière position de départ possible
+	unsigned int i = 0;
+
+	#ifdef NAZARA_STRING_SSE2
+	const __m128i first = _mm_set1_epi8(pattern[0]);
+	const __m128i end = _mm_set1_epi8(pattern[patternSize-1]);
+
+	for (; i + 15 <= last; i += 16)
+	{
+		__m128i blockFirst = _mm_loadu_si128(reinterpret_cast<const __m128i*>(&string[i]));
+		__m128i blockLast = _mm_loadu_si128(reinterpret_cast<const __m128i*>(&string[i + patternSize - 1]));
+
+		unsigned int mask = _mm_movemask_epi8(_mm_and_si128(_mm_cmpeq_epi8(blockFirst, first), _mm_cmpeq_epi8(blockLast, end)));
+		while (mask != 0)
+		{
+			unsigned int bit = nzCountTrailingZeros(mask);
+			const char* candidate = &string[i + bit];
+			if (std::memcmp(candidate + 1, pattern + 1, patternSize - 2) == 0)
+				return candidate;
+
+			mask &= mask - 1;
+		}
+	}
+	#endif
+
+	while (i <= last)
+	{
+		const char* candidate = static_cast<const char*>(std::memchr(&string[i], pattern[0], last - i + 1));
+		if (!candidate)
+			return nullptr;
+
+		if (std::memcmp(candidate + 1, pattern + 1, patternSize - 1) == 0)
+			return candidate;
+
+		i = static_cast<unsigned int>(candidate - string) + 1;
+	}
+
+	return nullptr;
+}
+
+// Même principe, en comparant les octets ASCII sans tenir compte de la casse
+inline const char* nzFindSubstringCaseInsensitive(const char* string, unsigned int size, const char* pattern, unsigned int patternSize)
+{
+	if (patternSize == 0 || patternSize > size)
+		return nullptr;
+
+	char firstLower = nzToLower(pattern[0]);
+	char firstUpper = nzToUpper(pattern[0]);
+	char endLower = nzToLower(pattern[patternSize-1]);
+	char endUpper = nzToUpper(pattern[patternSize-1]);
+
+	unsigned int last = size - patternSize;
+	unsigned int i = 0;
+
+	#ifdef NAZARA_STRING_SSE2
+	const __m128i firstL = _mm_set1_epi8(firstLower);
+	const __m128i firstU = _mm_set1_epi8(firstUpper);
+	const __m128i endL = _mm_set1_epi8(endLower);
+	const __m128i endU = _mm_set1_epi8(endUpper);
+
+	for (; i + 15 <= last; i += 16)
+	{
+		__m128i blockFirst = _mm_loadu_si128(reinterpret_cast<const __m128i*>(&string[i]));
+		__m128i blockLast = _mm_loadu_si128(reinterpret_cast<const __m128i*>(&string[i + patternSize - 1]));
+
+		__m128i eqFirst = _mm_or_si128(_mm_cmpeq_epi8(blockFirst, firstL), _mm_cmpeq_epi8(blockFirst, firstU));
+		__m128i eqLast = _mm_or_si128(_mm_cmpeq_epi8(blockLast, endL), _mm_cmpeq_epi8(blockLast, endU));
+
+		unsigned int mask = _mm_movemask_epi8(_mm_and_si128(eqFirst, eqLast));
+		while (mask != 0)
+		{
+			unsigned int bit = nzCountTrailingZeros(mask);
+			const char* candidate = &string[i + bit];
+			if (nzAsciiEqualsCaseInsensitive(candidate, pattern, patternSize))
+				return candidate;
+
+			mask &= mask - 1;
+		}
+	}
+	#endif
+
+	for (; i <= last; ++i)
+	{
+		char c = string[i];
+		if ((c == firstLower || c == firstUpper) && nzAsciiEqualsCaseInsensitive(&string[i], pattern, patternSize))
+			return &string[i];
+	}
+
+	return nullptr;
 }
 
 NzString::NzString() :
-m_sharedString(&emptyString)
+m_sharedString(&emptyString),
+m_localString(1, LocalCapacity, 0, m_localBuffer)
 {
 }
 
-NzString::NzString(char character)
+NzString::NzString(char character) :
+NzString()
 {
 	if (character != '\0')
 	{
-		m_sharedString = new SharedString;
-		m_sharedString->capacity = 1;
+		char* str = AllocateBuffer(1);
+		str[0] = character;
+		str[1] = '\0';
+
 		m_sharedString->size = 1;
-		m_sharedString->string = new char[2];
-		m_sharedString->string[0] = character;
-		m_sharedString->string[1] = '\0';
 	}
-	else
-		m_sharedString = &emptyString;
 }
 
-NzString::NzString(unsigned int length, char character)
+NzString::NzString(unsigned int length, char character) :
+NzString()
 {
 	if (length > 0)
 	{
-		m_sharedString = new SharedString;
-		m_sharedString->capacity = length;
-		m_sharedString->size = length;
-		m_sharedString->string = new char[length+1];
-
+		char* str = AllocateBuffer(length);
 		if (character != '\0')
-			std::memset(m_sharedString->string, character, length);
+			std::memset(str, character, length);
 
-		m_sharedString->string[length] = '\0';
+		str[length] = '\0';
+
+		m_sharedString->size = length;
 	}
-	else
-		m_sharedString = &emptyString;
 }
 
 NzString::NzString(const char* string) :
@@ -113,50 +286,46 @@ NzString(string, (string) ? std::strlen(string) : 0)
 {
 }
 
-NzString::NzString(const char* string, unsigned int length)
+NzString::NzString(const char* string, unsigned int length) :
+NzString()
 {
 	if (length > 0)
 	{
-		m_sharedString = new SharedString;
-		m_sharedString->capacity = length;
+		char* str = AllocateBuffer(length);
+		std::memcpy(str, string, length);
+		str[length] = '\0';
+
 		m_sharedString->size = length;
-		m_sharedString->string = new char[length+1];
-		std::memcpy(m_sharedString->string, string, length);
-		m_sharedString->string[length] = '\0';
 	}
-	else
-		m_sharedString = &emptyString;
 }
 
-NzString::NzString(const std::string& string)
+NzString::NzString(const std::string& string) :
+NzString()
 {
 	if (string.size() > 0)
 	{
-		m_sharedString = new SharedString;
-		m_sharedString->capacity = string.capacity();
+		char* str = AllocateBuffer(string.capacity());
+		std::memcpy(str, string.c_str(), string.size()+1);
+
 		m_sharedString->size = string.size();
-		m_sharedString->string = new char[string.capacity()+1];
-		std::memcpy(m_sharedString->string, string.c_str(), string.size()+1);
 	}
-	else
-		m_sharedString = &emptyString;
 }
 
 NzString::NzString(const NzString& string) :
-m_sharedString(string.m_sharedString)
+NzString()
 {
-	if (m_sharedString != &emptyString)
-		m_sharedString->refCount++;
+	Set(string);
 }
 
 NzString::NzString(NzString&& string) noexcept :
-m_sharedString(string.m_sharedString)
+NzString()
 {
-	string.m_sharedString = &emptyString;
+	MoveFrom(string);
 }
 
 NzString::NzString(SharedString* sharedString) :
-m_sharedString(sharedString)
+m_sharedString(sharedString),
+m_localString(1, LocalCapacity, 0, m_localBuffer)
 {
 }
 
@@ -492,27 +661,16 @@ unsigned int NzString::Find(char character, int start, nzUInt32 flags) const
 	if (pos >= m_sharedString->size)
 		return npos;
 
+	const char* ch;
 	if (flags & CaseInsensitive)
-	{
-		char ch = nzToLower(character);
-		const char* str = m_sharedString->string;
-		do
-		{
-			if (nzToLower(*str) == ch)
-				return static_cast<unsigned int>(str - m_sharedString->string);
-		}
-		while (*++str);
+		ch = nzFindSubstringCaseInsensitive(&m_sharedString->string[pos], m_sharedString->size - pos, &character, 1);
+	else
+		ch = static_cast<const char*>(std::memchr(&m_sharedString->string[pos], character, m_sharedString->size - pos));
 
-		return npos;
-	}
+	if (ch)
+		return static_cast<unsigned int>(ch - m_sharedString->string);
 	else
-	{
-		char* ch = std::strchr(&m_sharedString->string[pos], character);
-		if (ch)
-			return static_cast<unsigned int>(ch - m_sharedString->string);
-		else
-			return npos;
-	}
+		return npos;
 }
 
 unsigned int NzString::Find(const char* string, int start, nzUInt32 flags) const
@@ -527,10 +685,14 @@ unsigned int NzString::Find(const char* string, int start, nzUInt32 flags) const
 	if (pos >= m_sharedString->size)
 		return npos;
 
-	char* str = &m_sharedString->string[pos];
+	const char* str = &m_sharedString->string[pos];
+	unsigned int size = m_sharedString->size - pos;
+	unsigned int length = std::strlen(string);
+
 	if (flags & CaseInsensitive)
 	{
-		if (flags & HandleUtf8)
+		// Les tables Unicode ne sont nécessaires que si l'une des deux chaînes contient des caractères non-ASCII
+		if ((flags & HandleUtf8) && (!nzIsAscii(string, length) || !nzIsAscii(str, size)))
 		{
 			while (utf8::internal::is_trail(*str))
 				str++;
@@ -544,7 +706,8 @@ unsigned int NzString::Find(const char* string, int start, nzUInt32 flags) const
 				if (NzUnicode::GetLowercase(*it) == c)
 				{
 					const char* ptrPos = it.base();
-					++it;
+					utf8::unchecked::iterator<const char*> it1(it);
+					++it1;
 
 					utf8::unchecked::iterator<const char*> it2(t);
 					while (true)
@@ -552,13 +715,13 @@ unsigned int NzString::Find(const char* string, int start, nzUInt32 flags) const
 						if (*it2 == '\0')
 							return static_cast<unsigned int>(ptrPos - m_sharedString->string);
 
-						if (*it == '\0')
+						if (*it1 == '\0')
 							return npos;
 
-						if (NzUnicode::GetLowercase(*it) != NzUnicode::GetLowercase(*it2))
+						if (NzUnicode::GetLowercase(*it1) != NzUnicode::GetLowercase(*it2))
 							break;
 
-						++it;
+						++it1;
 						++it2;
 					}
 				}
@@ -567,39 +730,16 @@ unsigned int NzString::Find(const char* string, int start, nzUInt32 flags) const
 		}
 		else
 		{
-			char c = nzToLower(string[0]);
-			do
-			{
-				if (nzToLower(*str) == c)
-				{
-					char* ptrPos = str;
-					str++;
-
-					const char* ptr = &string[1];
-					while (true)
-					{
-						if (*ptr == '\0')
-							return static_cast<unsigned int>(ptrPos - m_sharedString->string);
-
-						if (*str == '\0')
-							return npos;
-
-						if (nzToLower(*str) != nzToLower(*ptr))
-							break;
-
-						ptr++;
-						str++;
-					}
-				}
-			}
-			while (*++str);
+			const char* ptr = nzFindSubstringCaseInsensitive(str, size, string, length);
+			if (ptr)
+				return static_cast<unsigned int>(ptr - m_sharedString->string);
 		}
 	}
 	else
 	{
-		char* ch = std::strstr(&m_sharedString->string[pos], string);
-		if (ch)
-			return static_cast<unsigned int>(ch - m_sharedString->string);
+		const char* ptr = nzFindSubstring(str, size, string, length);
+		if (ptr)
+			return static_cast<unsigned int>(ptr - m_sharedString->string);
 	}
 
 	return npos;
@@ -1959,9 +2099,9 @@ NzString& NzString::Insert(int pos, const char* string, unsigned int length)
 	else
 	{
 		unsigned int newSize = m_sharedString->size + length;
-		char* newString = new char[newSize+1];
 
-		char* ptr = newString;
+		NzString newString;
+		char* ptr = newString.AllocateBuffer(newSize);
 
 		if (start > 0)
 		{
@@ -1977,11 +2117,9 @@ NzString& NzString::Insert(int pos, const char* string, unsigned int length)
 		else
 			*ptr = '\0';
 
-		ReleaseString();
-		m_sharedString = new SharedString;
-		m_sharedString->capacity = newSize;
-		m_sharedString->size = newSize;
-		m_sharedString->string = newString;
+		newString.m_sharedString->size = newSize;
+
+		Set(std::move(newString));
 	}
 
 	return *this;
@@ -2243,10 +2381,10 @@ unsigned int NzString::Replace(const char* oldString, unsigned int oldLength, co
 		if (newSize == m_sharedString->size) // Alors c'est que Count(oldString) == 0
 			return 0;
 
-		char* newString = new char[newSize+1];
+		NzString newString;
 
 		///Algo 4.Replace#2
-		char* ptr = newString;
+		char* ptr = newString.AllocateBuffer(newSize);
 		const char* p = m_sharedString->string;
 
 		while ((pos = Find(oldString, pos, flags)) != npos)
@@ -2265,11 +2403,9 @@ unsigned int NzString::Replace(const char* oldString, unsigned int oldLength, co
 
 		std::strcpy(ptr, p); // Ajoute le caractère de fin par la même occasion
 
-		ReleaseString();
-		m_sharedString = new SharedString;
-		m_sharedString->capacity = newSize;
-		m_sharedString->size = newSize;
-		m_sharedString->string = newString;
+		newString.m_sharedString->size = newSize;
+
+		Set(std::move(newString));
 	}
 
 	return count;
@@ -2516,17 +2652,16 @@ void NzString::Reserve(unsigned int bufferSize)
 	if (m_sharedString->capacity >= bufferSize)
 		return;
 
-	char* ptr = new char[bufferSize+1];
+	NzString newString;
+	char* ptr = newString.AllocateBuffer(bufferSize);
 	if (m_sharedString->size > 0)
 		std::memcpy(ptr, m_sharedString->string, m_sharedString->size+1);
+	else
+		ptr[0] = '\0';
 
-	unsigned int size = m_sharedString->size;
+	newString.m_sharedString->size = m_sharedString->size;
 
-	ReleaseString();
-	m_sharedString = new SharedString;
-	m_sharedString->capacity = bufferSize;
-	m_sharedString->size = size;
-	m_sharedString->string = ptr;
+	Set(std::move(newString));
 }
 
 NzString& NzString::Resize(int size, char character)
@@ -2555,17 +2690,17 @@ NzString& NzString::Resize(int size, char character)
 	}
 	else // On veut forcément agrandir la chaine
 	{
-		char* newString = new char[newSize+1];
-		std::memcpy(newString, m_sharedString->string, m_sharedString->size);
+		NzString newString;
+		char* ptr = newString.AllocateBuffer(newSize);
+		std::memcpy(ptr, m_sharedString->string, m_sharedString->size);
 
 		if (character != '\0')
-			std::memset(&newString[m_sharedString->size], character, newSize-m_sharedString->size);
+			std::memset(&ptr[m_sharedString->size], character, newSize-m_sharedString->size);
 
-		ReleaseString();
-		m_sharedString = new SharedString;
-		m_sharedString->capacity = newSize;
-		m_sharedString->size = newSize;
-		m_sharedString->string = newString;
+		ptr[newSize] = '\0';
+		newString.m_sharedString->size = newSize;
+
+		Set(std::move(newString));
 	}
 
 	return *this;
@@ -2583,7 +2718,8 @@ NzString NzString::Resized(int size, char character) const
 	if (newSize == m_sharedString->size)
 		return *this;
 
-	char* str = new char[newSize+1];
+	NzString result;
+	char* str = result.AllocateBuffer(newSize);
 	if (newSize > m_sharedString->size)
 	{
 		std::memcpy(str, m_sharedString->string, m_sharedString->size);
@@ -2595,7 +2731,9 @@ NzString NzString::Resized(int size, char character) const
 
 	str[newSize] = '\0';
 
-	return NzString(new SharedString(1, newSize, newSize, str));
+	result.m_sharedString->size = newSize;
+
+	return result;
 }
 
 NzString& NzString::Reverse()
@@ -2617,7 +2755,8 @@ NzString NzString::Reversed() const
 	if (m_sharedString->size == 0)
 		return NzString();
 
-	char* str = new char[m_sharedString->size+1];
+	NzString result;
+	char* str = result.AllocateBuffer(m_sharedString->size);
 
 	char* ptr = &str[m_sharedString->size-1];
 	char* p = m_sharedString->string;
@@ -2628,7 +2767,9 @@ NzString NzString::Reversed() const
 
 	str[m_sharedString->size] = '\0';
 
-	return NzString(new SharedString(1, m_sharedString->size, m_sharedString->size, str));
+	result.m_sharedString->size = m_sharedString->size;
+
+	return result;
 }
 
 NzString& NzString::Set(char character)
@@ -2640,9 +2781,7 @@ NzString& NzString::Set(char character)
 		else
 		{
 			ReleaseString();
-			m_sharedString = new SharedString;
-			m_sharedString->capacity = 1;
-			m_sharedString->string = new char[2];
+			AllocateBuffer(1);
 		}
 
 		m_sharedString->size = 1;
@@ -2664,9 +2803,7 @@ NzString& NzString::Set(unsigned int length, char character)
 		else
 		{
 			ReleaseString();
-			m_sharedString = new SharedString;
-			m_sharedString->capacity = length;
-			m_sharedString->string = new char[length+1];
+			AllocateBuffer(length);
 		}
 
 		m_sharedString->size = length;
@@ -2697,9 +2834,7 @@ NzString& NzString::Set(const char* string, unsigned int length)
 		{
 			ReleaseString();
 
-			m_sharedString = new SharedString;
-			m_sharedString->capacity = length;
-			m_sharedString->string = new char[length+1];
+			AllocateBuffer(length);
 		}
 
 		m_sharedString->size = length;
@@ -2722,9 +2857,7 @@ NzString& NzString::Set(const std::string& string)
 		{
 			ReleaseString();
 
-			m_sharedString = new SharedString;
-			m_sharedString->capacity = string.size();
-			m_sharedString->string = new char[string.size()+1];
+			AllocateBuffer(string.size());
 		}
 
 		m_sharedString->size = string.size();
@@ -2738,18 +2871,35 @@ NzString& NzString::Set(const std::string& string)
 
 NzString& NzString::Set(const NzString& string)
 {
+	if (this == &string)
+		return *this;
+
 	ReleaseString();
 
-	m_sharedString = string.m_sharedString;
-	if (m_sharedString != &emptyString)
-		m_sharedString->refCount++;
+	if (string.IsLocal())
+	{
+		// Les chaînes courtes ne sont jamais partagées, une copie coûte moins cher qu'une allocation
+		std::memcpy(m_localBuffer, string.m_localBuffer, string.m_localString.size+1);
+		m_localString.size = string.m_localString.size;
+		m_sharedString = &m_localString;
+	}
+	else
+	{
+		m_sharedString = string.m_sharedString;
+		if (m_sharedString != &emptyString)
+			m_sharedString->refCount++;
+	}
 
 	return *this;
 }
 
 NzString& NzString::Set(NzString&& string) noexcept
 {
-	std::swap(m_sharedString, string.m_sharedString);
+	if (this != &string)
+	{
+		ReleaseString();
+		MoveFrom(string);
+	}
 
 	return *this;
 }
@@ -2767,7 +2917,8 @@ NzString NzString::Simplified(nzUInt32 flags) const
 	if (m_sharedString->size == 0)
 		return NzString();
 
-	char* str = new char[m_sharedString->size+1];
+	NzString result;
+	char* str = result.AllocateBuffer(m_sharedString->size);
 	char* p = str;
 
 	const char* ptr = m_sharedString->string;
@@ -2820,7 +2971,9 @@ NzString NzString::Simplified(nzUInt32 flags) const
 
 	*p = '\0';
 
-	return NzString(new SharedString(1, m_sharedString->size, p-str, str));
+	result.m_sharedString->size = p-str;
+
+	return result;
 }
 
 NzString& NzString::Simplify(nzUInt32 flags)
@@ -3089,11 +3242,14 @@ NzString NzString::SubString(int startPos, int endPos) const
 		return NzString();
 
 	unsigned int size = minEnd-start+1;
-	char* str = new char[size+1];
+	NzString result;
+	char* str = result.AllocateBuffer(size);
 	std::memcpy(str, &m_sharedString->string[start], size);
 	str[size] = '\0';
 
-	return NzString(new SharedString(1, size, size, str));
+	result.m_sharedString->size = size;
+
+	return result;
 }
 
 NzString NzString::SubStringFrom(char character, int startPos, bool fromLast, bool include, nzUInt32 flags) const
@@ -3188,7 +3344,15 @@ NzString NzString::SubStringTo(const NzString& string, int startPos, bool toLast
 
 void NzString::Swap(NzString& str)
 {
-	std::swap(m_sharedString, str.m_sharedString);
+	if (IsLocal() || str.IsLocal())
+	{
+		// Le buffer local ne peut pas changer de propriétaire, on passe par une chaîne temporaire
+		NzString temp(std::move(*this));
+		MoveFrom(str);
+		str.MoveFrom(temp);
+	}
+	else
+		std::swap(m_sharedString, str.m_sharedString);
 }
 
 bool NzString::ToBool(bool* value, nzUInt32 flags) const
@@ -3272,7 +3436,8 @@ NzString NzString::ToLower(nzUInt32 flags) const
 	}
 	else
 	{
-		char* str = new char[m_sharedString->size+1];
+		NzString result;
+		char* str = result.AllocateBuffer(m_sharedString->size);
 
 		char* ptr = m_sharedString->string;
 		char* s = str;
@@ -3282,7 +3447,9 @@ NzString NzString::ToLower(nzUInt32 flags) const
 
 		*s = '\0';
 
-		return NzString(new SharedString(1, m_sharedString->size, m_sharedString->size, str));
+		result.m_sharedString->size = m_sharedString->size;
+
+		return result;
 	}
 }
 
@@ -3304,7 +3471,8 @@ NzString NzString::ToUpper(nzUInt32 flags) const
 	}
 	else
 	{
-		char* str = new char[m_sharedString->size+1];
+		NzString result;
+		char* str = result.AllocateBuffer(m_sharedString->size);
 
 		char* ptr = m_sharedString->string;
 		char* s = str;
@@ -3314,7 +3482,9 @@ NzString NzString::ToUpper(nzUInt32 flags) const
 
 		*s = '\0';
 
-		return NzString(new SharedString(1, m_sharedString->size, m_sharedString->size, str));
+		result.m_sharedString->size = m_sharedString->size;
+
+		return result;
 	}
 }
 
@@ -3545,7 +3715,7 @@ NzString& NzString::operator=(const NzString& string)
 
 NzString& NzString::operator=(NzString&& string) noexcept
 {
-	return Set(string);
+	return Set(std::move(string));
 }
 
 NzString NzString::operator+(char character) const
@@ -3554,13 +3724,16 @@ NzString NzString::operator+(char character) const
 		return *this;
 
 	unsigned int totalSize = m_sharedString->size+1;
-	char* str = new char[totalSize+1];
+	NzString result;
+	char* str = result.AllocateBuffer(totalSize);
 	std::memcpy(str, m_sharedString->string, m_sharedString->size);
 
 	str[m_sharedString->size] = character;
 	str[totalSize] = '\0';
 
-	return NzString(new SharedString(1, totalSize, totalSize, str));
+	result.m_sharedString->size = totalSize;
+
+	return result;
 }
 
 NzString NzString::operator+(const char* string) const
@@ -3576,11 +3749,14 @@ NzString NzString::operator+(const char* string) const
 		return *this;
 
 	unsigned int totalSize = m_sharedString->size + length;
-	char* str = new char[totalSize+1];
+	NzString result;
+	char* str = result.AllocateBuffer(totalSize);
 	std::memcpy(str, m_sharedString->string, m_sharedString->size);
 	std::memcpy(&str[m_sharedString->size], string, length+1);
 
-	return NzString(new SharedString(1, totalSize, totalSize, str));
+	result.m_sharedString->size = totalSize;
+
+	return result;
 }
 
 NzString NzString::operator+(const std::string& string) const
@@ -3592,11 +3768,14 @@ NzString NzString::operator+(const std::string& string) const
 		return string;
 
 	unsigned int totalSize = m_sharedString->size + string.size();
-	char* str = new char[totalSize+1];
+	NzString result;
+	char* str = result.AllocateBuffer(totalSize);
 	std::memcpy(str, m_sharedString->string, m_sharedString->size);
 	std::memcpy(&str[m_sharedString->size], string.c_str(), string.size()+1);
 
-	return NzString(new SharedString(1, totalSize, totalSize, str));
+	result.m_sharedString->size = totalSize;
+
+	return result;
 }
 
 NzString NzString::operator+(const NzString& string) const
@@ -3608,11 +3787,14 @@ NzString NzString::operator+(const NzString& string) const
 		return string;
 
 	unsigned int totalSize = m_sharedString->size + string.m_sharedString->size;
-	char* str = new char[totalSize+1];
+	NzString result;
+	char* str = result.AllocateBuffer(totalSize);
 	std::memcpy(str, m_sharedString->string, m_sharedString->size);
 	std::memcpy(&str[m_sharedString->size], string.m_sharedString->string, string.m_sharedString->size+1);
 
-	return NzString(new SharedString(1, totalSize, totalSize, str));
+	result.m_sharedString->size = totalSize;
+
+	return result;
 }
 
 NzString& NzString::operator+=(char character)
@@ -3839,10 +4021,13 @@ bool NzString::operator>=(const std::string& string) const
 NzString NzString::Boolean(bool boolean)
 {
 	unsigned int size = (boolean) ? 4 : 5;
-	char* str = new char[size+1];
+	NzString result;
+	char* str = result.AllocateBuffer(size);
 	std::memcpy(str, (boolean) ? "true" : "false", size+1);
 
-	return NzString(new SharedString(1, size, size, str));
+	result.m_sharedString->size = size;
+
+	return result;
 }
 
 int NzString::Compare(const NzString& first, const NzString& second)
@@ -3936,10 +4121,13 @@ NzString NzString::Number(unsigned long long number, nzUInt8 radix)
 NzString NzString::Pointer(const void* ptr)
 {
 	unsigned int size = sizeof(ptr)*2+2;
-	char* str = new char[size+1];
+	NzString result;
+	char* str = result.AllocateBuffer(size);
 	std::sprintf(str, "0x%p", ptr);
 
-	return NzString(new SharedString(1, size, size, str));
+	result.m_sharedString->size = size;
+
+	return result;
 }
 
 NzString NzString::Unicode(char32_t character)
@@ -3957,11 +4145,14 @@ NzString NzString::Unicode(char32_t character)
     else
 		count = 4;
 
-	char* str = new char[count+1];
+	NzString result;
+	char* str = result.AllocateBuffer(count);
 	utf8::append(character, str);
 	str[count] = '\0';
 
-	return NzString(new SharedString(1, count, count, str));
+	result.m_sharedString->size = count;
+
+	return result;
 }
 
 NzString NzString::Unicode(const char* u8String)
@@ -3982,11 +4173,14 @@ NzString NzString::Unicode(const char16_t* u16String)
 
 	count *= 2; // On s'assure d'avoir la place suffisante
 
-	char* str = new char[count+1];
+	NzString result;
+	char* str = result.AllocateBuffer(count);
 	char* r = utf8::utf16to8(u16String, ptr, str);
 	*r = '\0';
 
-	return NzString(new SharedString(1, count, r-str, str));
+	result.m_sharedString->size = r-str;
+
+	return result;
 }
 
 NzString NzString::Unicode(const char32_t* u32String)
@@ -4010,11 +4204,14 @@ NzString NzString::Unicode(const char32_t* u32String)
 	}
 	while (*++ptr);
 
-	char* str = new char[count+1];
+	NzString result;
+	char* str = result.AllocateBuffer(count);
 	char* r = utf8::utf32to8(u32String, ptr, str);
 	*r = '\0';
 
-	return NzString(new SharedString(1, count, count, str));
+	result.m_sharedString->size = count;
+
+	return result;
 }
 
 NzString NzString::Unicode(const wchar_t* wString)
@@ -4038,11 +4235,14 @@ NzString NzString::Unicode(const wchar_t* wString)
 	}
 	while (*++ptr);
 
-	char* str = new char[count+1];
+	NzString result;
+	char* str = result.AllocateBuffer(count);
 	char* r = utf8::utf32to8(wString, ptr, str);
 	*r = '\0';
 
-	return NzString(new SharedString(1, count, count, str));
+	result.m_sharedString->size = count;
+
+	return result;
 }
 
 std::istream& operator>>(std::istream& is, NzString& str)
@@ -4087,11 +4287,14 @@ NzString operator+(char character, const NzString& string)
 		return NzString(character);
 
 	unsigned int totalSize = string.m_sharedString->size+1;
-	char* str = new char[totalSize+1];
+	NzString result;
+	char* str = result.AllocateBuffer(totalSize);
 	str[0] = character;
 	std::memcpy(&str[1], string.m_sharedString->string, string.m_sharedString->size+1);
 
-	return NzString(new NzString::SharedString(1, totalSize, totalSize, str));
+	result.m_sharedString->size = totalSize;
+
+	return result;
 }
 
 NzString operator+(const char* string, const NzString& nstring)
@@ -4104,11 +4307,14 @@ NzString operator+(const char* string, const NzString& nstring)
 
 	unsigned int size = std::strlen(string);
 	unsigned int totalSize = size + nstring.m_sharedString->size;
-	char* str = new char[totalSize+1];
+	NzString result;
+	char* str = result.AllocateBuffer(totalSize);
 	std::memcpy(str, string, size);
 	std::memcpy(&str[size], nstring.m_sharedString->string, nstring.m_sharedString->size+1);
 
-	return NzString(new NzString::SharedString(1, totalSize, totalSize, str));
+	result.m_sharedString->size = totalSize;
+
+	return result;
 }
 
 NzString operator+(const std::string& string, const NzString& nstring)
@@ -4120,11 +4326,14 @@ NzString operator+(const std::string& string, const NzString& nstring)
 		return string;
 
 	unsigned int totalSize = string.size() + nstring.m_sharedString->size;
-	char* str = new char[totalSize+1];
+	NzString result;
+	char* str = result.AllocateBuffer(totalSize);
 	std::memcpy(str, string.c_str(), string.size());
 	std::memcpy(&str[string.size()], nstring.m_sharedString->string, nstring.m_sharedString->size+1);
 
-	return NzString(new NzString::SharedString(1, totalSize, totalSize, str));
+	result.m_sharedString->size = totalSize;
+
+	return result;
 }
 
 bool operator==(const NzString& first, const NzString& second)
@@ -4259,8 +4468,20 @@ bool operator>=(const std::string& string, const NzString& nstring)
 	return !operator<(string, nstring);
 }
 
+char* NzString::AllocateBuffer(unsigned int capacity)
+{
+	// La chaîne doit avoir été libérée au préalable, le contenu du buffer retourné n'est pas initialisé
+	if (capacity <= LocalCapacity)
+		m_sharedString = &m_localString;
+	else
+		m_sharedString = new SharedString(1, capacity, 0, new char[capacity+1]);
+
+	return m_sharedString->string;
+}
+
 void NzString::EnsureOwnership(bool discardContent)
 {
+	// Une chaîne locale n'est jamais partagée, son compteur vaut toujours 1
 	if (m_sharedString == &emptyString)
 		return;
 
@@ -4283,11 +4504,37 @@ bool NzString::FillHash(NzAbstractHash* hazh) const
 	return true;
 }
 
+bool NzString::IsLocal() const
+{
+	return m_sharedString == &m_localString;
+}
+
+void NzString::MoveFrom(NzString& string)
+{
+	// La chaîne doit avoir été libérée au préalable
+	if (string.IsLocal())
+	{
+		std::memcpy(m_localBuffer, string.m_localBuffer, string.m_localString.size+1);
+		m_localString.size = string.m_localString.size;
+		m_sharedString = &m_localString;
+	}
+	else
+		m_sharedString = string.m_sharedString;
+
+	string.m_sharedString = &emptyString;
+}
+
 void NzString::ReleaseString()
 {
 	if (m_sharedString == &emptyString)
 		return;
 
+	if (IsLocal())
+	{
+		m_sharedString = &emptyString;
+		return;
+	}
+
 	if (--m_sharedString->refCount == 0)
 	{
 		delete[] m_sharedString->string;
@@ -0,0 +1,488 @@
+// Copyright (C) 2014 Jérôme Leclercq
+// This file is part of the "Nazara Engine - Core module"
+// For conditions of distribution and use, see copyright notice in Config.hpp
+
+#include <Nazara/Core/StringView.hpp>
+#include <Nazara/Core/Config.hpp>
+#include <Nazara/Core/Error.hpp>
+#include <algorithm>
+#include <cctype>
+#include <cstdlib>
+#include <cstring>
+#include <limits>
+#include <Nazara/Core/Debug.hpp>
+
+namespace
+{
+	inline char ToLower(char character)
+	{
+		if (character >= 'A' && character <= 'Z')
+			return character + ('a' - 'A');
+		else
+			return character;
+	}
+
+	inline bool CompareCaseInsensitive(const char* s1, const char* s2, unsigned int size)
+	{
+		for (unsigned int i = 0; i < size; ++i)
+		{
+			if (ToLower(s1[i]) != ToLower(s2[i]))
+				return false;
+		}
+
+		return true;
+	}
+
+	inline bool IsSpace(char character)
+	{
+		return std::isspace(static_cast<unsigned char>(character)) != 0;
+	}
+
+	// Puissances de dix exactement représentables par un double
+	const double powersOfTen[] =
+	{
+		1e0,  1e1,  1e2,  1e3,  1e4,  1e5,  1e6,  1e7,  1e8,  1e9,  1e10, 1e11,
+		1e12, 1e13, 1e14, 1e15, 1e16, 1e17, 1e18, 1e19, 1e20, 1e21, 1e22
+	};
+}
+
+bool NzStringView::EndsWith(const NzStringView& string, nzUInt32 flags) const
+{
+	if (string.m_size == 0 || string.m_size > m_size)
+		return false;
+
+	const char* ptr = &m_string[m_size - string.m_size];
+	if (flags & NzString::CaseInsensitive)
+		return CompareCaseInsensitive(ptr, string.m_string, string.m_size);
+	else
+		return std::memcmp(ptr, string.m_string, string.m_size) == 0;
+}
+
+unsigned int NzStringView::Find(char character, unsigned int start) const
+{
+	if (start >= m_size)
+		return npos;
+
+	const void* ptr = std::memchr(&m_string[start], character, m_size - start);
+	if (ptr)
+		return static_cast<const char*>(ptr) - m_string;
+	else
+		return npos;
+}
+
+unsigned int NzStringView::Find(const NzStringView& string, unsigned int start) const
+{
+	if (string.m_size == 0 || start >= m_size || string.m_size > m_size - start)
+		return npos;
+
+	const char* limit = &m_string[m_size - string.m_size];
+	const char* ptr = &m_string[start];
+	while ((ptr = static_cast<const char*>(std::memchr(ptr, string.m_string[0], limit - ptr + 1))))
+	{
+		if (std::memcmp(ptr, string.m_string, string.m_size) == 0)
+			return ptr - m_string;
+
+		if (++ptr > limit)
+			break;
+	}
+
+	return npos;
+}
+
+unsigned int NzStringView::FindAny(const char* characters, unsigned int start) const
+{
+	if (!characters || !characters[0])
+		return npos;
+
+	for (unsigned int i = start; i < m_size; ++i)
+	{
+		if (std::strchr(characters, m_string[i]))
+			return i;
+	}
+
+	return npos;
+}
+
+NzStringView NzStringView::GetWord(unsigned int index) const
+{
+	NzStringTokenizer tokenizer = NzStringTokenizer::Words(*this);
+
+	NzStringView word;
+	for (unsigned int i = 0; i <= index; ++i)
+	{
+		if (!tokenizer.GetNext(&word))
+			return NzStringView();
+	}
+
+	return word;
+}
+
+unsigned int NzStringView::Split(std::vector<NzStringView>& result, char separation) const
+{
+	// Comme NzString::Split, les morceaux vides sont ignorés
+	unsigned int start = 0;
+	while (start < m_size)
+	{
+		unsigned int sep = Find(separation, start);
+		if (sep == npos)
+			sep = m_size;
+
+		if (sep > start)
+			result.push_back(NzStringView(&m_string[start], sep - start));
+
+		start = sep+1;
+	}
+
+	return result.size();
+}
+
+unsigned int NzStringView::SplitAny(std::vector<NzStringView>& result, const char* separations) const
+{
+	NzStringTokenizer tokenizer(*this, separations);
+
+	NzStringView token;
+	while (tokenizer.GetNext(&token))
+		result.push_back(token);
+
+	return result.size();
+}
+
+bool NzStringView::StartsWith(const NzStringView& string, nzUInt32 flags) const
+{
+	if (string.m_size == 0 || string.m_size > m_size)
+		return false;
+
+	if (flags & NzString::CaseInsensitive)
+		return CompareCaseInsensitive(m_string, string.m_string, string.m_size);
+	else
+		return std::memcmp(m_string, string.m_string, string.m_size) == 0;
+}
+
+NzStringView NzStringView::SubString(int startPos, int endPos) const
+{
+	// Même sémantique que NzString::SubString (endPos inclus, les positions négatives partent de la fin)
+	if (startPos < 0)
+		startPos = std::max(static_cast<int>(m_size) + startPos, 0);
+
+	unsigned int start = static_cast<unsigned int>(startPos);
+
+	if (endPos < 0)
+	{
+		endPos = m_size + endPos;
+		if (endPos < 0)
+			return NzStringView();
+	}
+
+	if (m_size == 0)
+		return NzStringView();
+
+	unsigned int minEnd = std::min(static_cast<unsigned int>(endPos), m_size-1);
+	if (start > minEnd || start >= m_size)
+		return NzStringView();
+
+	return NzStringView(&m_string[start], minEnd - start + 1);
+}
+
+bool NzStringView::ToDouble(double* value) const
+{
+	if (m_size == 0)
+		return false;
+
+	const char* ptr = m_string;
+	const char* end = m_string + m_size;
+
+	bool negative = false;
+	if (*ptr == '-' || *ptr == '+')
+	{
+		negative = (*ptr == '-');
+		ptr++;
+	}
+
+	// On accumule les chiffres significatifs dans un entier, l'exposant décimal est corrigé en conséquence
+	nzUInt64 mantissa = 0;
+	int exponent = 0;
+	unsigned int digitCount = 0;
+	unsigned int significantDigits = 0;
+	bool truncated = false;
+
+	for (; ptr != end && *ptr >= '0' && *ptr <= '9'; ++ptr, ++digitCount)
+	{
+		if (significantDigits < 19)
+		{
+			mantissa = mantissa*10 + (*ptr - '0');
+			if (mantissa != 0)
+				significantDigits++;
+		}
+		else
+		{
+			exponent++;
+			truncated |= (*ptr != '0');
+		}
+	}
+
+	if (ptr != end && *ptr == '.')
+	{
+		for (++ptr; ptr != end && *ptr >= '0' && *ptr <= '9'; ++ptr, ++digitCount)
+		{
+			if (significantDigits < 19)
+			{
+				mantissa = mantissa*10 + (*ptr - '0');
+				if (mantissa != 0)
+					significantDigits++;
+
+				exponent--;
+			}
+			else
+				truncated |= (*ptr != '0');
+		}
+	}
+
+	if (digitCount == 0)
+	{
+		// Peut-être "inf" ou "nan", on laisse la bibliothèque standard s'en occuper
+		char buffer[16];
+		if (m_size >= sizeof(buffer))
+			return false;
+
+		std::memcpy(buffer, m_string, m_size);
+		buffer[m_size] = '\0';
+
+		char* strEnd;
+		double result = std::strtod(buffer, &strEnd);
+		if (strEnd != &buffer[m_size])
+			return false;
+
+		if (value)
+			*value = result;
+
+		return true;
+	}
+
+	if (ptr != end && (*ptr == 'e' || *ptr == 'E'))
+	{
+		ptr++;
+
+		bool negativeExponent = false;
+		if (ptr != end && (*ptr == '-' || *ptr == '+'))
+		{
+			negativeExponent = (*ptr == '-');
+			ptr++;
+		}
+
+		if (ptr == end || *ptr < '0' || *ptr > '9')
+			return false;
+
+		int exp = 0;
+		for (; ptr != end && *ptr >= '0' && *ptr <= '9'; ++ptr)
+		{
+			if (exp < 100000)
+				exp = exp*10 + (*ptr - '0');
+		}
+
+		exponent += (negativeExponent) ? -exp : exp;
+	}
+
+	if (ptr != end)
+		return false;
+
+	if (!value)
+		return true;
+
+	// Chemin rapide de Clinger: la mantisse et la puissance de dix sont exactes, le résultat est donc correctement arrondi
+	if (!truncated && mantissa <= (1ULL << 53) && exponent >= -22 && exponent <= 22)
+	{
+		double result = static_cast<double>(mantissa);
+		if (exponent < 0)
+			result /= powersOfTen[-exponent];
+		else
+			result *= powersOfTen[exponent];
+
+		*value = (negative) ? -result : result;
+		return true;
+	}
+
+	// Cas rare (trop de chiffres significatifs ou exposant extrême), on passe par strtod pour garder la précision
+	char buffer[128];
+	if (m_size < sizeof(buffer))
+	{
+		std::memcpy(buffer, m_string, m_size);
+		buffer[m_size] = '\0';
+
+		*value = std::strtod(buffer, nullptr);
+	}
+	else
+		*value = std::strtod(ToString().GetConstBuffer(), nullptr);
+
+	return true;
+}
+
+bool NzStringView::ToFloat(float* value) const
+{
+	double result;
+	if (!ToDouble(&result))
+		return false;
+
+	if (value)
+		*value = static_cast<float>(result);
+
+	return true;
+}
+
+bool NzStringView::ToInteger(long long* value, nzUInt8 radix) const
+{
+	#if NAZARA_CORE_SAFE
+	if (radix < 2 || radix > 36)
+	{
+		NazaraError("Radix must be between 2 and 36");
+		return false;
+	}
+	#endif
+
+	if (m_size == 0)
+		return false;
+
+	const char* ptr = m_string;
+	const char* end = m_string + m_size;
+
+	bool negative = false;
+	if (*ptr == '-' || *ptr == '+')
+	{
+		negative = (*ptr == '-');
+		if (++ptr == end)
+			return false;
+	}
+
+	const unsigned long long limit = (negative) ? static_cast<unsigned long long>(std::numeric_limits<long long>::max()) + 1 :
+	                                              static_cast<unsigned long long>(std::numeric_limits<long long>::max());
+
+	unsigned long long total = 0;
+	for (; ptr != end; ++ptr)
+	{
+		char c = *ptr;
+
+		unsigned int digit;
+		if (c >= '0' && c <= '9')
+			digit = c - '0';
+		else if (c >= 'a' && c <= 'z')
+			digit = c - 'a' + 10;
+		else if (c >= 'A' && c <= 'Z')
+			digit = c - 'A' + 10;
+		else
+			return false;
+
+		if (digit >= radix)
+			return false;
+
+		if (total > (limit - digit)/radix)
+			return false; // Dépassement
+
+		total = total*radix + digit;
+	}
+
+	if (value)
+		*value = (negative) ? static_cast<long long>(0ULL - total) : static_cast<long long>(total);
+
+	return true;
+}
+
+NzString NzStringView::ToString() const
+{
+	return NzString(m_string, m_size);
+}
+
+NzStringView NzStringView::Trimmed() const
+{
+	unsigned int start = 0;
+	while (start < m_size && IsSpace(m_string[start]))
+		start++;
+
+	unsigned int end = m_size;
+	while (end > start && IsSpace(m_string[end-1]))
+		end--;
+
+	return NzStringView(&m_string[start], end - start);
+}
+
+const unsigned int NzStringView::npos(std::numeric_limits<unsigned int>::max());
+
+NzStringTokenizer::NzStringTokenizer(const NzStringView& string, const char* separators, bool keepEmpty) :
+m_string(string),
+m_separators(separators),
+m_position(0),
+m_finished(false),
+m_keepEmpty(keepEmpty),
+m_trimCarriageReturn(false)
+{
+}
+
+bool NzStringTokenizer::GetNext(NzStringView* token)
+{
+	if (m_finished)
+		return false;
+
+	unsigned int size = m_string.GetSize();
+	const char* str = m_string.GetConstBuffer();
+
+	if (!m_keepEmpty)
+	{
+		while (m_position < size && std::strchr(m_separators, str[m_position]))
+			m_position++;
+
+		if (m_position >= size)
+		{
+			m_finished = true;
+			return false;
+		}
+	}
+
+	unsigned int start = m_position;
+	unsigned int end = m_string.FindAny(m_separators, start);
+	if (end == NzStringView::npos)
+	{
+		// Dernier morceau, qu'il soit vide ou non (Si keepEmpty est actif)
+		end = size;
+		m_finished = true;
+	}
+
+	m_position = end+1;
+
+	if (m_trimCarriageReturn && end > start && str[end-1] == '\r')
+		end--;
+
+	if (token)
+		*token = NzStringView(&str[start], end - start);
+
+	return true;
+}
+
+NzStringView NzStringTokenizer::GetRemaining() const
+{
+	if (m_finished)
+		return NzStringView();
+
+	return NzStringView(&m_string.GetConstBuffer()[m_position], m_string.GetSize() - m_position);
+}
+
+bool NzStringTokenizer::IsFinished() const
+{
+	return m_finished;
+}
+
+void NzStringTokenizer::Reset()
+{
+	m_finished = false;
+	m_position = 0;
+}
+
+NzStringTokenizer NzStringTokenizer::Lines(const NzStringView& string)
+{
+	NzStringTokenizer tokenizer(string, "\n", true);
+	tokenizer.m_trimCarriageReturn = true;
+
+	return tokenizer;
+}
+
+NzStringTokenizer NzStringTokenizer::Words(const NzStringView& string)
+{
+	return NzStringTokenizer(string, " \t\r\n\v\f", false);
+}
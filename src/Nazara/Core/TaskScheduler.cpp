@@ -32,6 +32,11 @@ bool NzTaskScheduler::Initialize()
 	return NzTaskSchedulerImpl::Initialize(GetWorkerCount());
 }
 
+bool NzTaskScheduler::IsInitialized()
+{
+	return NzTaskSchedulerImpl::IsInitialized();
+}
+
 void NzTaskScheduler::Run()
 {
 	NzTaskSchedulerImpl::Run(&s_pendingWorks[0], s_pendingWorks.size());
@@ -5,10 +5,12 @@
 #include <Nazara/Core/Win32/FileImpl.hpp>
 #include <Nazara/Core/Error.hpp>
 #include <Nazara/Core/Win32/Time.hpp>
+#include <cstring>
 #include <memory>
 #include <Nazara/Core/Debug.hpp>
 
 NzFileImpl::NzFileImpl(const NzFile* parent) :
+m_readAtHandle(nullptr),
 m_endOfFile(false),
 m_endOfFileUpdated(true)
 {
@@ -18,6 +20,14 @@ m_endOfFileUpdated(true)
 void NzFileImpl::Close()
 {
 	CloseHandle(m_handle);
+
+	if (m_readAtHandle)
+	{
+		if (m_readAtHandle != INVALID_HANDLE_VALUE)
+			CloseHandle(m_readAtHandle);
+
+		m_readAtHandle = nullptr;
+	}
 }
 
 bool NzFileImpl::EndOfFile() const
@@ -94,8 +104,11 @@ bool NzFileImpl::Open(const NzString& filePath, unsigned int mode)
 
 	std::unique_ptr<wchar_t[]> path(filePath.GetWideBuffer());
 	m_handle = CreateFileW(path.get(), access, shareMode, nullptr, openMode, 0, nullptr);
+	if (m_handle == INVALID_HANDLE_VALUE)
+		return false;
 
-	return m_handle != INVALID_HANDLE_VALUE;
+	m_filePath = filePath;
+	return true;
 }
 
 std::size_t NzFileImpl::Read(void* buffer, std::size_t size)
@@ -136,6 +149,38 @@ std::size_t NzFileImpl::Read(void* buffer, std::size_t size)
 		return 0;
 }
 
+std::size_t NzFileImpl::ReadAt(void* buffer, std::size_t size, nzUInt64 offset)
+{
+	// Sur un handle synchrone, ReadFile déplace le curseur même lorsqu'une position est donnée par la structure OVERLAPPED
+	// La lecture passe donc par un second handle, ouvert en mode asynchrone (Il n'a alors pas de curseur)
+	HANDLE handle = GetReadAtHandle();
+	if (handle == INVALID_HANDLE_VALUE)
+		return 0;
+
+	OVERLAPPED overlapped;
+	std::memset(&overlapped, 0, sizeof(OVERLAPPED));
+	overlapped.Offset = static_cast<DWORD>(offset & 0xFFFFFFFF);
+	overlapped.OffsetHigh = static_cast<DWORD>(offset >> 32);
+
+	// Un évènement par lecture, plusieurs threads pouvant lire en même temps sur le même handle
+	overlapped.hEvent = CreateEventW(nullptr, TRUE, FALSE, nullptr);
+	if (!overlapped.hEvent)
+	{
+		NazaraError("Failed to create event: " + NzError::GetLastSystemError());
+		return 0;
+	}
+
+	DWORD read = 0;
+	if (!ReadFile(handle, buffer, size, nullptr, &overlapped) && GetLastError() != ERROR_IO_PENDING)
+		read = 0; // Fin de fichier (ERROR_HANDLE_EOF) ou erreur
+	else if (!GetOverlappedResult(handle, &overlapped, &read, TRUE))
+		read = 0;
+
+	CloseHandle(overlapped.hEvent);
+
+	return read;
+}
+
 bool NzFileImpl::SetCursorPos(NzFile::CursorPosition pos, nzInt64 offset)
 {
 	DWORD moveMethod;
@@ -182,6 +227,31 @@ std::size_t NzFileImpl::Write(const void* buffer, std::size_t size)
 	return written;
 }
 
+HANDLE NzFileImpl::GetReadAtHandle()
+{
+	HANDLE handle = m_readAtHandle;
+	if (handle)
+		return handle;
+
+	// Le handle principal peut avoir été ouvert en écriture, le partage en écriture doit donc être autorisé
+	std::unique_ptr<wchar_t[]> path(m_filePath.GetWideBuffer());
+	handle = CreateFileW(path.get(), GENERIC_READ, FILE_SHARE_READ | FILE_SHARE_WRITE, nullptr, OPEN_EXISTING, FILE_FLAG_OVERLAPPED, nullptr);
+	if (handle == INVALID_HANDLE_VALUE)
+		NazaraError("Failed to open file for positioned reads: " + NzError::GetLastSystemError());
+
+	// Plusieurs threads peuvent lire en même temps (NzFile ne prend qu'un verrou en lecture), le premier handle créé est gardé
+	HANDLE previous = InterlockedCompareExchangePointer(&m_readAtHandle, handle, nullptr);
+	if (previous)
+	{
+		if (handle != INVALID_HANDLE_VALUE)
+			CloseHandle(handle);
+
+		return previous;
+	}
+
+	return handle;
+}
+
 bool NzFileImpl::Copy(const NzString& sourcePath, const NzString& targetPath)
 {
 	std::unique_ptr<wchar_t[]> srcPath(sourcePath.GetWideBuffer());
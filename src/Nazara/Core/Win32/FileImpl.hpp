@@ -10,11 +10,11 @@
 #include <Nazara/Prerequesites.hpp>
 #include <Nazara/Core/File.hpp>
 #include <Nazara/Core/NonCopyable.hpp>
+#include <Nazara/Core/String.hpp>
 #include <ctime>
 #include <windows.h>
 
 class NzFile;
-class NzString;
 
 class NzFileImpl : NzNonCopyable
 {
@@ -28,6 +28,7 @@ class NzFileImpl : NzNonCopyable
 		nzUInt64 GetCursorPos() const;
 		bool Open(const NzString& filePath, unsigned int mode);
 		std::size_t Read(void* buffer, std::size_t size);
+		std::size_t ReadAt(void* buffer, std::size_t size, nzUInt64 offset);
 		bool SetCursorPos(NzFile::CursorPosition pos, nzInt64 offset);
 		std::size_t Write(const void* buffer, std::size_t size);
 
@@ -41,7 +42,11 @@ class NzFileImpl : NzNonCopyable
 		static bool Rename(const NzString& sourcePath, const NzString& targetPath);
 
 	private:
+		HANDLE GetReadAtHandle();
+
 		HANDLE m_handle;
+		HANDLE volatile m_readAtHandle;
+		NzString m_filePath;
 		mutable bool m_endOfFile;
 		mutable bool m_endOfFileUpdated;
 };
@@ -0,0 +1,87 @@
+// Copyright (C) 2014 Jérôme Leclercq
+// This file is part of the "Nazara Engine - Core module"
+// For conditions of distribution and use, see copyright notice in Config.hpp
+
+#include <Nazara/Core/Win32/RWMutexImpl.hpp>
+#include <Nazara/Core/Debug.hpp>
+
+NzRWMutexImpl::NzRWMutexImpl()
+{
+	#if NAZARA_CORE_WINDOWS_VISTA
+	InitializeSRWLock(&m_lock);
+	#elif NAZARA_CORE_WINDOWS_CS_SPINLOCKS > 0
+	InitializeCriticalSectionAndSpinCount(&m_criticalSection, NAZARA_CORE_WINDOWS_CS_SPINLOCKS);
+	#else
+	InitializeCriticalSection(&m_criticalSection);
+	#endif
+}
+
+#if !NAZARA_CORE_WINDOWS_VISTA
+NzRWMutexImpl::~NzRWMutexImpl()
+{
+	DeleteCriticalSection(&m_criticalSection);
+}
+#endif
+
+void NzRWMutexImpl::LockRead()
+{
+	#if NAZARA_CORE_WINDOWS_VISTA
+	AcquireSRWLockShared(&m_lock);
+	#else
+	EnterCriticalSection(&m_criticalSection);
+	#endif
+}
+
+void NzRWMutexImpl::LockWrite()
+{
+	#if NAZARA_CORE_WINDOWS_VISTA
+	AcquireSRWLockExclusive(&m_lock);
+	#else
+	EnterCriticalSection(&m_criticalSection);
+	#endif
+}
+
+bool NzRWMutexImpl::TryLockRead()
+{
+	#if NAZARA_CORE_WINDOWS_VISTA
+	// TryAcquireSRWLock* n'existe que depuis Windows 7, sous Vista la tentative échoue systématiquement
+	#if _WIN32_WINNT >= 0x0601
+	return TryAcquireSRWLockShared(&m_lock) != 0;
+	#else
+	return false;
+	#endif
+	#else
+	return TryEnterCriticalSection(&m_criticalSection) != 0;
+	#endif
+}
+
+bool NzRWMutexImpl::TryLockWrite()
+{
+	#if NAZARA_CORE_WINDOWS_VISTA
+	#if _WIN32_WINNT >= 0x0601
+	return TryAcquireSRWLockExclusive(&m_lock) != 0;
+	#else
+	return false;
+	#endif
+	#else
+	return TryEnterCriticalSection(&m_criticalSection) != 0;
+	#endif
+}
+
+void NzRWMutexImpl::UnlockRead()
+{
+	#if NAZARA_CORE_WINDOWS_VISTA
+	ReleaseSRWLockShared(&m_lock);
+	#else
+	LeaveCriticalSection(&m_criticalSection);
+	#endif
+}
+
+void NzRWMutexImpl::UnlockWrite()
+{
+	#if NAZARA_CORE_WINDOWS_VISTA
+	ReleaseSRWLockExclusive(&m_lock);
+	#else
+	LeaveCriticalSection(&m_criticalSection);
+	#endif
+}
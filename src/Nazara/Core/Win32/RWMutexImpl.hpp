@@ -0,0 +1,41 @@
+// Copyright (C) 2014 Jérôme Leclercq
+// This file is part of the "Nazara Engine - Core module"
+// For conditions of distribution and use, see copyright notice in Config.hpp
+
+#pragma once
+
+#ifndef NAZARA_RWMUTEXIMPL_HPP
+#define NAZARA_RWMUTEXIMPL_HPP
+
+#include <Nazara/Prerequesites.hpp>
+#include <windows.h>
+
+class NzRWMutexImpl
+{
+	public:
+		NzRWMutexImpl();
+		#if NAZARA_CORE_WINDOWS_VISTA
+		~NzRWMutexImpl() = default;
+		#else
+		~NzRWMutexImpl();
+		#endif
+
+		void LockRead();
+		void LockWrite();
+
+		bool TryLockRead();
+		bool TryLockWrite();
+
+		void UnlockRead();
+		void UnlockWrite();
+
+	private:
+		#if NAZARA_CORE_WINDOWS_VISTA
+		SRWLOCK m_lock;
+		#else
+		// Pas de verrou lecteurs/écrivain avant Vista, les lectures deviennent exclusives
+		CRITICAL_SECTION m_criticalSection;
+		#endif
+};
+
+#endif // NAZARA_RWMUTEXIMPL_HPP
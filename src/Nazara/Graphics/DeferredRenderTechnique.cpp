@@ -4,6 +4,7 @@
 
 #include <Nazara/Graphics/DeferredRenderTechnique.hpp>
 #include <Nazara/Core/ErrorFlags.hpp>
+#include <Nazara/Core/Profiler.hpp>
 #include <Nazara/Graphics/AbstractBackground.hpp>
 #include <Nazara/Graphics/Camera.hpp>
 #include <Nazara/Graphics/DeferredBloomPass.hpp>
@@ -155,6 +156,8 @@ void NzDeferredRenderTechnique::Clear(const NzScene* scene) const
 
 bool NzDeferredRenderTechnique::Draw(const NzScene* scene) const
 {
+	NazaraProfile("NzDeferredRenderTechnique::Draw")
+
 	NzRecti viewerViewport = scene->GetViewer()->GetViewport();
 
 	NzVector2ui viewportDimensions(viewerViewport.width, viewerViewport.height);
@@ -3,6 +3,7 @@
 // For conditions of distribution and use, see copyright notice in Config.hpp
 
 #include <Nazara/Graphics/ForwardRenderQueue.hpp>
+#include <Nazara/Core/Profiler.hpp>
 #include <Nazara/Graphics/AbstractViewer.hpp>
 #include <Nazara/Graphics/Light.hpp>
 #include <Nazara/Graphics/Model.hpp>
@@ -237,6 +238,8 @@ void NzForwardRenderQueue::Clear(bool fully)
 
 void NzForwardRenderQueue::Sort(const NzAbstractViewer* viewer)
 {
+	NazaraProfile("NzForwardRenderQueue::Sort")
+
 	struct TransparentModelComparator
 	{
 		bool operator()(const std::pair<unsigned int, bool>& index1, const std::pair<unsigned int, bool>& index2)
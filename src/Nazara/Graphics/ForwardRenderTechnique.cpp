@@ -3,6 +3,7 @@
 // For conditions of distribution and use, see copyright notice in Config.hpp
 
 #include <Nazara/Graphics/ForwardRenderTechnique.hpp>
+#include <Nazara/Core/Profiler.hpp>
 #include <Nazara/Graphics/AbstractBackground.hpp>
 #include <Nazara/Graphics/Camera.hpp>
 #include <Nazara/Graphics/Drawable.hpp>
@@ -76,6 +77,8 @@ void NzForwardRenderTechnique::Clear(const NzScene* scene) const
 
 bool NzForwardRenderTechnique::Draw(const NzScene* scene) const
 {
+	NazaraProfile("NzForwardRenderTechnique::Draw")
+
 	m_directionalLights.SetLights(&m_renderQueue.directionalLights[0], m_renderQueue.directionalLights.size());
 	m_lights.SetLights(&m_renderQueue.lights[0], m_renderQueue.lights.size());
 	m_renderQueue.Sort(scene->GetViewer());
@@ -5,12 +5,60 @@
 #include <Nazara/Graphics/Loaders/OBJ/OBJParser.hpp>
 #include <Nazara/Core/Error.hpp>
 #include <Nazara/Core/Log.hpp>
+#include <Nazara/Core/StringView.hpp>
 #include <Nazara/Utility/Config.hpp>
-#include <cstdio>
+#include <cctype>
 #include <memory>
 #include <unordered_map>
 #include <Nazara/Graphics/Debug.hpp>
 
+namespace
+{
+	// Lit jusqu'à count flottants consécutifs, sans copie ni sscanf
+	unsigned int ReadFloats(NzStringTokenizer& tokenizer, float* values, unsigned int count)
+	{
+		NzStringView token;
+		for (unsigned int i = 0; i < count; ++i)
+		{
+			if (!tokenizer.GetNext(&token) || !token.ToFloat(&values[i]))
+				return i;
+		}
+
+		return count;
+	}
+
+	bool ParseIndex(const NzStringView& token, int* index)
+	{
+		long long value;
+		if (!token.ToInteger(&value))
+			return false;
+
+		*index = static_cast<int>(value);
+		return true;
+	}
+
+	bool ParseFaceVertex(const NzStringView& vertex, int* position, int* texCoord, int* normal)
+	{
+		NzStringTokenizer tokenizer(vertex, "/", true);
+
+		// Un index absent (ou vide, comme dans "p//n") vaut zéro
+		NzStringView token;
+		if (!tokenizer.GetNext(&token) || !ParseIndex(token, position))
+			return false;
+
+		*texCoord = 0;
+		*normal = 0;
+
+		if (tokenizer.GetNext(&token) && !token.IsEmpty() && !ParseIndex(token, texCoord))
+			return false;
+
+		if (tokenizer.GetNext(&token) && !token.IsEmpty() && !ParseIndex(token, normal))
+			return false;
+
+		return tokenizer.IsFinished();
+	}
+}
+
 NzOBJParser::NzOBJParser(NzInputStream& stream) :
 m_stream(stream),
 m_streamFlags(stream.GetStreamOptions())
@@ -128,40 +176,24 @@ bool NzOBJParser::Parse()
 				Face face;
 				face.vertices.resize(vertexCount);
 
+				// On découpe la ligne sans copie, chaque sommet étant de la forme p, p/t, p//n ou p/t/n
+				NzStringTokenizer vertexTokenizer(NzStringView(m_currentLine).SubString(2), " ");
+
 				bool error = false;
-				unsigned int pos = 2;
 				for (unsigned int i = 0; i < vertexCount; ++i)
 				{
-					int offset;
 					int& n = face.vertices[i].normal;
 					int& p = face.vertices[i].position;
 					int& t = face.vertices[i].texCoord;
 
-					if (std::sscanf(&m_currentLine[pos], "%d/%d/%d%n", &p, &t, &n, &offset) != 3)
+					NzStringView vertex;
+					if (!vertexTokenizer.GetNext(&vertex) || !ParseFaceVertex(vertex, &p, &t, &n))
 					{
-						if (std::sscanf(&m_currentLine[pos], "%d//%d%n", &p, &n, &offset) != 2)
-						{
-							if (std::sscanf(&m_currentLine[pos], "%d/%d%n", &p, &t, &offset) != 2)
-							{
-								if (std::sscanf(&m_currentLine[pos], "%d%n", &p, &offset) != 1)
-								{
-									#if NAZARA_UTILITY_STRICT_RESOURCE_PARSING
-									UnrecognizedLine();
-									#endif
-									error = true;
-									break;
-								}
-								else
-								{
-									n = 0;
-									t = 0;
-								}
-							}
-							else
-								n = 0;
-						}
-						else
-							t = 0;
+						#if NAZARA_UTILITY_STRICT_RESOURCE_PARSING
+						UnrecognizedLine();
+						#endif
+						error = true;
+						break;
 					}
 
 					if (p < 0)
@@ -221,8 +253,6 @@ bool NzOBJParser::Parse()
 						error = true;
 						break;
 					}
-
-					pos += offset;
 				}
 
 				if (!error)
@@ -298,11 +328,15 @@ bool NzOBJParser::Parse()
 
 			case 'v':
 			{
-				NzString word = m_currentLine.GetWord(0).ToLower();
-				if (word == 'v')
+				NzStringTokenizer tokenizer = NzStringTokenizer::Words(m_currentLine);
+
+				NzStringView word;
+				tokenizer.GetNext(&word);
+
+				if (word == "v" || word == "V")
 				{
 					NzVector4f vertex(NzVector3f::Zero(), 1.f);
-					unsigned int paramCount = std::sscanf(&m_currentLine[2], "%f %f %f %f", &vertex.x, &vertex.y, &vertex.z, &vertex.w);
+					unsigned int paramCount = ReadFloats(tokenizer, &vertex.x, 4);
 					if (paramCount >= 3)
 						m_positions.push_back(vertex);
 					#if NAZARA_UTILITY_STRICT_RESOURCE_PARSING
@@ -310,10 +344,10 @@ bool NzOBJParser::Parse()
 						UnrecognizedLine();
 					#endif
 				}
-				else if (word == "vn")
+				else if (word.GetSize() == 2 && std::tolower(word[1]) == 'n')
 				{
 					NzVector3f normal(NzVector3f::Zero());
-					unsigned int paramCount = std::sscanf(&m_currentLine[3], "%f %f %f", &normal.x, &normal.y, &normal.z);
+					unsigned int paramCount = ReadFloats(tokenizer, &normal.x, 3);
 					if (paramCount == 3)
 						m_normals.push_back(normal);
 					#if NAZARA_UTILITY_STRICT_RESOURCE_PARSING
@@ -321,10 +355,10 @@ bool NzOBJParser::Parse()
 						UnrecognizedLine();
 					#endif
 				}
-				else if (word == "vt")
+				else if (word.GetSize() == 2 && std::tolower(word[1]) == 't')
 				{
 					NzVector3f uvw(NzVector3f::Zero());
-					unsigned int paramCount = std::sscanf(&m_currentLine[3], "%f %f %f", &uvw.x, &uvw.y, &uvw.z);
+					unsigned int paramCount = ReadFloats(tokenizer, &uvw.x, 3);
 					if (paramCount >= 2)
 						m_texCoords.push_back(uvw);
 					#if NAZARA_UTILITY_STRICT_RESOURCE_PARSING
@@ -23,6 +23,8 @@ bool NzModelParameters::IsValid() const
 }
 
 NzModel::NzModel() :
+m_animationInstancer(nullptr),
+m_animationInstance(nullptr),
 m_currentSequence(nullptr),
 m_animationEnabled(true),
 m_boundingVolumeUpdated(true),
@@ -35,6 +37,8 @@ m_skinCount(1)
 NzModel::NzModel(const NzModel& model) :
 NzSceneNode(model),
 m_materials(model.m_materials),
+m_animationInstancer(model.m_animationInstancer),
+m_animationInstance(nullptr),
 m_boundingVolume(model.m_boundingVolume),
 m_currentSequence(model.m_currentSequence),
 m_animationEnabled(model.m_animationEnabled),
@@ -55,6 +59,10 @@ m_skinCount(model.m_skinCount)
 
 		if (m_mesh->GetAnimationType() == nzAnimationType_Skeletal)
 			m_skeleton = model.m_skeleton;
+
+		// La copie partage l'instance de l'original
+		if (model.m_animationInstance)
+			m_animationInstance = m_animationInstancer->Acquire(m_mesh, m_animation, m_currentFrame, m_nextFrame, m_interpolation);
 	}
 }
 
@@ -104,7 +112,37 @@ void NzModel::AdvanceAnimation(float elapsedTime)
 		}
 	}
 
-	m_animation->AnimateSkeleton(&m_skeleton, m_currentFrame, m_nextFrame, m_interpolation);
+	if (m_animationInstancer)
+	{
+		// La nouvelle instance est acquise avant de rendre l'ancienne, qui est souvent la même
+		NzAnimationInstancer::Instance* instance = m_animationInstancer->Acquire(m_mesh, m_animation, m_currentFrame, m_nextFrame, m_interpolation);
+		ReleaseAnimationInstance();
+
+		m_animationInstance = instance;
+	}
+	else
+		m_animation->AnimateSkeleton(&m_skeleton, m_currentFrame, m_nextFrame, m_interpolation);
+
+	m_boundingVolume.MakeNull();
+	m_boundingVolumeUpdated = false;
+}
+
+void NzModel::ApplyPose(const NzSkeletalPose& pose)
+{
+	///DOC: Permet de jouer le résultat d'un mélange d'animations, l'animation du modèle doit alors être désactivée
+	///DOC: (EnableAnimation) pour que la pose ne soit pas remplacée lors de la mise à jour
+	#if NAZARA_GRAPHICS_SAFE
+	if (!m_mesh || m_mesh->GetAnimationType() != nzAnimationType_Skeletal)
+	{
+		NazaraError("Model is not skeletal");
+		return;
+	}
+	#endif
+
+	// La pose est propre au modèle
+	ReleaseAnimationInstance();
+
+	pose.Apply(&m_skeleton);
 	m_boundingVolume.MakeNull();
 	m_boundingVolumeUpdated = false;
 }
@@ -119,6 +157,16 @@ NzAnimation* NzModel::GetAnimation() const
 	return m_animation;
 }
 
+const NzAnimationInstancer::Instance* NzModel::GetAnimationInstance() const
+{
+	return m_animationInstance;
+}
+
+NzAnimationInstancer* NzModel::GetAnimationInstancer() const
+{
+	return m_animationInstancer;
+}
+
 const NzBoundingVolumef& NzModel::GetBoundingVolume() const
 {
 	#if NAZARA_GRAPHICS_SAFE
@@ -240,11 +288,18 @@ nzSceneNodeType NzModel::GetSceneNodeType() const
 
 NzSkeleton* NzModel::GetSkeleton()
 {
+	///DOC: En cas de partage de l'animation, il s'agit du squelette partagé: le modifier affecte tous les modèles de l'instance
+	if (m_animationInstance)
+		return m_animationInstance->GetSkeleton();
+
 	return &m_skeleton;
 }
 
 const NzSkeleton* NzModel::GetSkeleton() const
 {
+	if (m_animationInstance)
+		return m_animationInstance->GetSkeleton();
+
 	return &m_skeleton;
 }
 
@@ -302,6 +357,8 @@ void NzModel::Reset()
 	m_matCount = 0;
 	m_skinCount = 0;
 
+	ReleaseAnimationInstance();
+
 	if (m_mesh)
 	{
 		m_animation.Reset();
@@ -343,6 +400,8 @@ bool NzModel::SetAnimation(NzAnimation* animation)
 	}
 	#endif
 
+	ReleaseAnimationInstance();
+
 	m_animation = animation;
 	if (m_animation)
 	{
@@ -360,6 +419,18 @@ bool NzModel::SetAnimation(NzAnimation* animation)
 	return true;
 }
 
+void NzModel::SetAnimationInstancer(NzAnimationInstancer* animationInstancer)
+{
+	///DOC: Les modèles d'un même instancer jouant la même frame d'une animation partagent son évaluation (Squelette et skinning)
+	///DOC: nullptr rend au modèle sa propre évaluation, l'instancer doit survivre au modèle
+	if (animationInstancer == m_animationInstancer)
+		return;
+
+	ReleaseAnimationInstance();
+
+	m_animationInstancer = animationInstancer;
+}
+
 bool NzModel::SetMaterial(const NzString& subMeshName, NzMaterial* material)
 {
 	NzSubMesh* subMesh = m_mesh->GetSubMesh(subMeshName);
@@ -464,6 +535,8 @@ void NzModel::SetMaterial(unsigned int skinIndex, unsigned int matIndex, NzMater
 
 void NzModel::SetMesh(NzMesh* mesh)
 {
+	ReleaseAnimationInstance();
+
 	m_mesh = mesh;
 
 	if (m_mesh)
@@ -578,6 +651,8 @@ NzModel& NzModel::operator=(const NzModel& node)
 {
 	NzSceneNode::operator=(node);
 
+	ReleaseAnimationInstance();
+
 	m_animation = node.m_animation;
 	m_animationEnabled = node.m_animationEnabled;
 	m_boundingVolume = node.m_boundingVolume;
@@ -595,6 +670,10 @@ NzModel& NzModel::operator=(const NzModel& node)
 	if (m_mesh->GetAnimationType() == nzAnimationType_Skeletal)
 		m_skeleton = node.m_skeleton;
 
+	m_animationInstancer = node.m_animationInstancer;
+	if (node.m_animationInstance)
+		m_animationInstance = m_animationInstancer->Acquire(m_mesh, m_animation, m_currentFrame, m_nextFrame, m_interpolation);
+
 	return *this;
 }
 
@@ -602,6 +681,8 @@ NzModel& NzModel::operator=(NzModel&& node)
 {
 	NzSceneNode::operator=(node);
 
+	ReleaseAnimationInstance();
+
 	// Ressources
 	m_animation = std::move(node.m_animation);
 	m_mesh = std::move(node.m_mesh);
@@ -610,6 +691,11 @@ NzModel& NzModel::operator=(NzModel&& node)
 	if (m_mesh->GetAnimationType() == nzAnimationType_Skeletal)
 		m_skeleton = std::move(node.m_skeleton);
 
+	// L'instance partagée change simplement de propriétaire
+	m_animationInstance = node.m_animationInstance;
+	m_animationInstancer = node.m_animationInstancer;
+	node.m_animationInstance = nullptr;
+
 	// Paramètres
 	m_animationEnabled = node.m_animationEnabled;
 	m_boundingVolume = node.m_boundingVolume;
@@ -646,6 +732,15 @@ void NzModel::Register()
 		m_scene->RegisterForUpdate(this);
 }
 
+void NzModel::ReleaseAnimationInstance()
+{
+	if (m_animationInstance)
+	{
+		m_animationInstancer->Release(m_animationInstance);
+		m_animationInstance = nullptr;
+	}
+}
+
 void NzModel::Unregister()
 {
 	m_scene->UnregisterForUpdate(this);
@@ -662,7 +757,7 @@ void NzModel::UpdateBoundingVolume() const
 	if (m_boundingVolume.IsNull())
 	{
 		if (m_mesh->GetAnimationType() == nzAnimationType_Skeletal)
-			m_boundingVolume.Set(m_skeleton.GetAABB());
+			m_boundingVolume.Set(GetSkeleton()->GetAABB());
 		else
 			m_boundingVolume.Set(m_mesh->GetAABB());
 	}
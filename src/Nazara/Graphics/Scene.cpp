@@ -6,6 +6,8 @@
 #include <Nazara/Core/Clock.hpp>
 #include <Nazara/Core/Error.hpp>
 #include <Nazara/Core/ErrorFlags.hpp>
+#include <Nazara/Core/PerformanceCounters.hpp>
+#include <Nazara/Core/Profiler.hpp>
 #include <Nazara/Graphics/Camera.hpp>
 #include <Nazara/Graphics/ColorBackground.hpp>
 #include <Nazara/Graphics/RenderTechniques.hpp>
@@ -65,6 +67,8 @@ void NzScene::AddToVisibilityList(NzUpdatable* object)
 
 void NzScene::Cull()
 {
+	NazaraProfile("NzScene::Cull")
+
 	#if NAZARA_GRAPHICS_SAFE
 	if (!m_impl->viewer)
 	{
@@ -78,6 +82,9 @@ void NzScene::Cull()
 
 	m_impl->visibleUpdateList.clear();
 
+	// Les transformations modifiées depuis la dernière image sont recalculées en une seule passe, plutôt qu'à la demande pendant le culling
+	m_impl->root.UpdateTransforms();
+
 	// Frustum culling
 	RecursiveFrustumCull(m_impl->renderTechnique->GetRenderQueue(), m_impl->viewer->GetFrustum(), &m_impl->root);
 
@@ -88,6 +95,8 @@ void NzScene::Cull()
 
 void NzScene::Draw()
 {
+	NazaraProfile("NzScene::Draw")
+
 	#if NAZARA_GRAPHICS_SAFE
 	if (!m_impl->viewer)
 	{
@@ -208,6 +217,8 @@ void NzScene::UnregisterForUpdate(NzUpdatable* object)
 
 void NzScene::Update()
 {
+	NazaraProfile("NzScene::Update")
+
 	m_impl->update = (m_impl->updatePerSecond == 0 || m_impl->updateClock.GetMilliseconds() > 1000/m_impl->updatePerSecond);
 	if (m_impl->update)
 	{
@@ -222,6 +233,8 @@ void NzScene::Update()
 
 void NzScene::UpdateVisible()
 {
+	NazaraProfile("NzScene::UpdateVisible")
+
 	if (m_impl->update)
 	{
 		for (NzUpdatable* node : m_impl->visibleUpdateList)
@@ -245,7 +258,14 @@ void NzScene::RecursiveFrustumCull(NzAbstractRenderQueue* renderQueue, const NzF
 			///TODO: Empêcher le rendu des enfants si le parent est cullé selon un flag
 			sceneNode->UpdateVisibility(frustum);
 			if (sceneNode->IsVisible())
+			{
 				sceneNode->AddToRenderQueue(renderQueue);
+				NazaraCount(nzPerformanceCounter_VisibleNodes, 1)
+			}
+			else
+			{
+				NazaraCount(nzPerformanceCounter_CulledNodes, 1)
+			}
 		}
 
 		if (child->HasChilds())
@@ -10,7 +10,9 @@
 #include <Nazara/Core/Error.hpp>
 #include <Nazara/Core/File.hpp>
 #include <Nazara/Core/MemoryStream.hpp>
+#include <Nazara/Core/PerformanceCounters.hpp>
 #include <cstdlib>
+#include <cstring>
 #include <stdexcept>
 #include <unordered_map>
 #include <Nazara/Lua/Debug.hpp>
@@ -501,6 +503,23 @@ void NzLuaInstance::PushCFunction(NzLuaCFunction func, int upvalueCount)
 	lua_pushcclosure(m_state, func, upvalueCount);
 }
 
+void NzLuaInstance::PushFrameStatistics(const NzFrameStatistics& statistics)
+{
+	PushTable(0, nzPerformanceCounter_Max+3);
+
+	PushNumber(static_cast<double>(statistics.frameIndex));
+	SetField("frameIndex");
+
+	PushNumber(static_cast<double>(statistics.frameTime));
+	SetField("frameTime");
+
+	for (unsigned int i = 0; i <= nzPerformanceCounter_Max; ++i)
+	{
+		PushNumber(static_cast<double>(statistics.counters[i]));
+		SetField(NzPerformanceCounters::GetName(static_cast<nzPerformanceCounter>(i)));
+	}
+}
+
 void NzLuaInstance::PushFunction(NzLuaFunction func)
 {
 	NzLuaFunction* luaFunc = reinterpret_cast<NzLuaFunction*>(lua_newuserdata(m_state, sizeof(NzLuaFunction)));
@@ -569,6 +588,57 @@ void NzLuaInstance::PushValue(int index)
 	lua_pushvalue(m_state, index);
 }
 
+void NzLuaInstance::RegisterPerformanceCounters()
+{
+	// Expose une table globale PerformanceCounters, pour que les scripts (de tests de performance notamment) puissent lire les compteurs
+	PushTable(0, 4);
+
+	PushFunction([](NzLuaInstance& instance) -> int
+	{
+		NazaraUnused(instance);
+
+		NzPerformanceCounters::EndFrame();
+		return 0;
+	});
+	SetField("EndFrame");
+
+	PushFunction([](NzLuaInstance& instance) -> int
+	{
+		instance.PushFrameStatistics(NzPerformanceCounters::GetFrameStatistics());
+		return 1;
+	});
+	SetField("GetFrameStatistics");
+
+	PushFunction([](NzLuaInstance& instance) -> int
+	{
+		const char* name = instance.CheckString(1);
+		for (unsigned int i = 0; i <= nzPerformanceCounter_Max; ++i)
+		{
+			nzPerformanceCounter counter = static_cast<nzPerformanceCounter>(i);
+			if (std::strcmp(NzPerformanceCounters::GetName(counter), name) == 0)
+			{
+				instance.PushNumber(static_cast<double>(NzPerformanceCounters::GetTotal(counter)));
+				return 1;
+			}
+		}
+
+		instance.Error("Unknown performance counter \"" + NzString(name) + '"');
+		return 0;
+	});
+	SetField("GetTotal");
+
+	PushFunction([](NzLuaInstance& instance) -> int
+	{
+		NazaraUnused(instance);
+
+		NzPerformanceCounters::Reset();
+		return 0;
+	});
+	SetField("Reset");
+
+	SetGlobal("PerformanceCounters");
+}
+
 void NzLuaInstance::Remove(int index)
 {
 	lua_remove(m_state, index);
@@ -5,6 +5,7 @@
 #include <Nazara/Renderer/HardwareBuffer.hpp>
 #include <Nazara/Core/Clock.hpp>
 #include <Nazara/Core/Error.hpp>
+#include <Nazara/Core/PerformanceCounters.hpp>
 #include <Nazara/Renderer/Context.hpp>
 #include <Nazara/Renderer/OpenGL.hpp>
 #include <cstring>
@@ -138,6 +139,8 @@ bool NzHardwareBuffer::IsHardware() const
 
 void* NzHardwareBuffer::Map(nzBufferAccess access, unsigned int offset, unsigned int size)
 {
+	NazaraCount(nzPerformanceCounter_BufferMaps, 1)
+
 	NzContext::EnsureContext();
 
 	NzOpenGL::BindBuffer(m_type, m_buffer);
@@ -15,6 +15,21 @@ bool NzMaterialParams::IsValid() const
 	return true;
 }
 
+bool NzMaterialParams::operator==(const NzMaterialParams& params) const
+{
+	return loadAlphaMap == params.loadAlphaMap &&
+	       loadDiffuseMap == params.loadDiffuseMap &&
+	       loadEmissiveMap == params.loadEmissiveMap &&
+	       loadHeightMap == params.loadHeightMap &&
+	       loadNormalMap == params.loadNormalMap &&
+	       loadSpecularMap == params.loadSpecularMap;
+}
+
+bool NzMaterialParams::operator!=(const NzMaterialParams& params) const
+{
+	return !operator==(params);
+}
+
 NzMaterial::NzMaterial()
 {
 	Reset();
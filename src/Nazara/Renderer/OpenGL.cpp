@@ -5,6 +5,7 @@
 #include <Nazara/Renderer/OpenGL.hpp>
 #include <Nazara/Core/Error.hpp>
 #include <Nazara/Core/Log.hpp>
+#include <Nazara/Core/PerformanceCounters.hpp>
 #include <Nazara/Math/Basic.hpp>
 #include <Nazara/Renderer/Context.hpp>
 #include <Nazara/Renderer/RenderTarget.hpp>
@@ -322,6 +323,8 @@ void NzOpenGL::BindProgram(GLuint id)
 	{
 		glUseProgram(id);
 		s_contextStates->currentProgram = id;
+
+		NazaraCount(nzPerformanceCounter_ProgramBinds, 1)
 	}
 }
 
@@ -378,6 +381,8 @@ void NzOpenGL::BindTexture(nzImageType type, GLuint id)
 	{
 		glBindTexture(TextureTarget[type], id);
 		s_contextStates->texturesBinding[s_contextStates->textureUnit] = id;
+
+		NazaraCount(nzPerformanceCounter_TextureBinds, 1)
 	}
 }
 
@@ -397,6 +402,8 @@ void NzOpenGL::BindTexture(unsigned int textureUnit, nzImageType type, GLuint id
 
 		glBindTexture(TextureTarget[type], id);
 		s_contextStates->texturesBinding[textureUnit] = id;
+
+		NazaraCount(nzPerformanceCounter_TextureBinds, 1)
 	}
 }
 
@@ -7,6 +7,7 @@
 #include <Nazara/Core/Error.hpp>
 #include <Nazara/Core/ErrorFlags.hpp>
 #include <Nazara/Core/Log.hpp>
+#include <Nazara/Core/PerformanceCounters.hpp>
 #include <Nazara/Renderer/AbstractShaderProgram.hpp>
 #include <Nazara/Renderer/Config.hpp>
 #include <Nazara/Renderer/Context.hpp>
@@ -254,6 +255,8 @@ void NzRenderer::DrawFullscreenQuad()
 	}
 
 	glDrawArrays(GL_TRIANGLE_STRIP, 0, 4);
+	NazaraCount(nzPerformanceCounter_DrawCalls, 1)
+	NazaraCount(nzPerformanceCounter_DrawnInstances, 1)
 
 	if (s_useVertexArrayObjects)
 		glBindVertexArray(0);
@@ -306,6 +309,8 @@ void NzRenderer::DrawIndexedPrimitives(nzPrimitiveMode mode, unsigned int firstI
 	}
 
 	glDrawElements(NzOpenGL::PrimitiveMode[mode], indexCount, type, offset);
+	NazaraCount(nzPerformanceCounter_DrawCalls, 1)
+	NazaraCount(nzPerformanceCounter_DrawnInstances, 1)
 
 	if (s_useVertexArrayObjects)
 		glBindVertexArray(0);
@@ -377,6 +382,8 @@ void NzRenderer::DrawIndexedPrimitivesInstanced(unsigned int instanceCount, nzPr
 	}
 
 	glDrawElementsInstanced(NzOpenGL::PrimitiveMode[mode], indexCount, type, offset, instanceCount);
+	NazaraCount(nzPerformanceCounter_DrawCalls, 1)
+	NazaraCount(nzPerformanceCounter_DrawnInstances, instanceCount)
 
 	if (s_useVertexArrayObjects)
 		glBindVertexArray(0);
@@ -407,6 +414,8 @@ void NzRenderer::DrawPrimitives(nzPrimitiveMode mode, unsigned int firstVertex,
 	}
 
 	glDrawArrays(NzOpenGL::PrimitiveMode[mode], firstVertex, vertexCount);
+	NazaraCount(nzPerformanceCounter_DrawCalls, 1)
+	NazaraCount(nzPerformanceCounter_DrawnInstances, 1)
 
 	if (s_useVertexArrayObjects)
 		glBindVertexArray(0);
@@ -458,6 +467,8 @@ void NzRenderer::DrawPrimitivesInstanced(unsigned int instanceCount, nzPrimitive
 	}
 
 	glDrawArraysInstanced(NzOpenGL::PrimitiveMode[mode], firstVertex, vertexCount, instanceCount);
+	NazaraCount(nzPerformanceCounter_DrawCalls, 1)
+	NazaraCount(nzPerformanceCounter_DrawnInstances, instanceCount)
 
 	if (s_useVertexArrayObjects)
 		glBindVertexArray(0);
@@ -1462,6 +1473,8 @@ bool NzRenderer::EnsureStateUpdate()
 	}
 	#endif
 
+	NazaraCount(nzPerformanceCounter_StateUpdates, 1)
+
 	s_target->EnsureTargetUpdated();
 
 	NzAbstractShaderProgram* programImpl = s_program->m_impl;
@@ -26,9 +26,13 @@
  */
 
 #include <Nazara/Utility/Algorithm.hpp>
+#include <Nazara/Core/TaskScheduler.hpp>
+#include <Nazara/Math/Algorithm.hpp>
 #include <Nazara/Math/Basic.hpp>
+#include <Nazara/Utility/Config.hpp>
 #include <Nazara/Utility/IndexIterator.hpp>
 #include <algorithm>
+#include <cstdlib>
 #include <unordered_map>
 #include <Nazara/Utility/Debug.hpp>
 
@@ -123,6 +127,10 @@ namespace
 					*indices++ = triangle.z + indexOffset;
 				}
 
+				// Les sommets sont construits dans l'espace local et transformés en une fois
+				NzTransformPositions(m_matrix, &vertices->position, &vertices->position, m_vertexIndex, sizeof(NzMeshVertex), sizeof(NzMeshVertex));
+				NzTransformNormals(m_matrix, &vertices->normal, &vertices->normal, m_vertexIndex, sizeof(NzMeshVertex), sizeof(NzMeshVertex));
+
 				if (aabb)
 				{
 					NzVector3f totalSize = size * m_matrix.GetScale();
@@ -134,8 +142,8 @@ namespace
 			{
 				NzMeshVertex& vertex = m_vertices[m_vertexIndex];
 
-				vertex.normal = NzVector3f::Normalize(m_matrix.Transform(position, 0.f));
-				vertex.position = m_matrix.Transform(m_size * position.GetNormal());
+				vertex.normal = position.GetNormal();
+				vertex.position = m_size * vertex.normal;
 
 				return m_vertexIndex++;
 			}
@@ -633,6 +641,29 @@ namespace
 			float m_valenceBoostScale;
 			float m_valenceBoostPower;
 	};
+
+	#if NAZARA_UTILITY_MULTITHREADED_TRANSFORM
+	// En dessous, le coût de répartition des tâches dépasse le gain
+	const unsigned int minParallelTransformVertexCount = 16384;
+
+	NzVector3f* Offset(NzVector3f* attribute, unsigned int offset)
+	{
+		return (attribute) ? reinterpret_cast<NzVector3f*>(reinterpret_cast<nzUInt8*>(attribute) + offset) : nullptr;
+	}
+	#endif
+
+	void TransformVertexRange(const NzMatrix4f* matrix, const NzMatrix4f* normalMatrix, NzVector3f* positions, NzVector3f* normals, NzVector3f* tangents, unsigned int vertexCount, unsigned int stride)
+	{
+		if (positions)
+			NzTransformPositions(*matrix, positions, positions, vertexCount, stride, stride);
+
+		// La matrice des normales étant déjà calculée, elles se transforment comme des tangentes
+		if (normals)
+			NzTransformTangents(*normalMatrix, normals, normals, vertexCount, stride, stride);
+
+		if (tangents)
+			NzTransformTangents(*matrix, tangents, tangents, vertexCount, stride, stride);
+	}
 }
 
 /**********************************NzCompute**********************************/
@@ -786,6 +817,8 @@ void NzGenerateCone(float length, float radius, unsigned int subdivision, const
 	const float round = 2.f*static_cast<float>(M_PI);
 	float delta = round/subdivision;
 
+	NzMeshVertex* firstVertex = vertices;
+
 	vertices->position = matrix.GetTranslation(); // matrix.Transform(NzVector3f(0.f));
 	vertices->normal = matrix.Transform(NzVector3f::Up(), 0.f);
 	vertices++;
@@ -793,7 +826,7 @@ void NzGenerateCone(float length, float radius, unsigned int subdivision, const
 	for (unsigned int i = 0; i < subdivision; ++i)
 	{
 		float angle = delta*i;
-		vertices->position = matrix.Transform(NzVector3f(radius*std::sin(angle), -length, radius*std::cos(angle)));
+		vertices->position.Set(radius*std::sin(angle), -length, radius*std::cos(angle));
 		vertices++;
 
 		*indices++ = indexOffset + 0;
@@ -808,6 +841,8 @@ void NzGenerateCone(float length, float radius, unsigned int subdivision, const
 		}
 	}
 
+	NzTransformPositions(matrix, &firstVertex[1].position, &firstVertex[1].position, subdivision, sizeof(NzMeshVertex), sizeof(NzMeshVertex));
+
 	if (aabb)
 	{
 		aabb->MakeZero();
@@ -841,13 +876,17 @@ void NzGenerateCubicSphere(float size, unsigned int subdivision, const NzMatrix4
 		aabb->Set(-totalSize, totalSize);
 	}
 
+	NzMeshVertex* vertex = vertices;
 	for (unsigned int i = 0; i < vertexCount; ++i)
 	{
-		vertices->position = matrix.Transform(size * vertices->position.GetNormal());
-		vertices->normal = vertices->position.GetNormal();
-		//vertices->tangent = ???
-		vertices++;
+		vertex->normal = vertex->position.GetNormal();
+		vertex->position = size * vertex->normal;
+		//vertex->tangent = ???
+		vertex++;
 	}
+
+	NzTransformPositions(matrix, &vertices->position, &vertices->position, vertexCount, sizeof(NzMeshVertex), sizeof(NzMeshVertex));
+	NzTransformNormals(matrix, &vertices->normal, &vertices->normal, vertexCount, sizeof(NzMeshVertex), sizeof(NzMeshVertex));
 }
 
 void NzGenerateIcoSphere(float size, unsigned int recursionLevel, const NzMatrix4f& matrix, const NzRectf& textureCoords, NzMeshVertex* vertices, NzIndexIterator indices, NzBoxf* aabb, unsigned int indexOffset)
@@ -880,14 +919,15 @@ void NzGeneratePlane(const NzVector2ui& subdivision, const NzVector2f& size, con
 	float halfSizeX = size.x / 2.f;
 	float halfSizeY = size.y / 2.f;
 
+	NzMeshVertex* firstVertex = vertices;
+
 	float invHorizontalVertexCount = 1.f/(horizontalVertexCount-1);
 	float invVerticalVertexCount = 1.f/(verticalVertexCount-1);
 	for (unsigned int x = 0; x < horizontalVertexCount; ++x)
 	{
 		for (unsigned int y = 0; y < verticalVertexCount; ++y)
 		{
-			NzVector3f localPos((2.f*x*invHorizontalVertexCount - 1.f) * halfSizeX, 0.f, (2.f*y*invVerticalVertexCount - 1.f) * halfSizeY);
-			vertices->position = matrix * localPos;
+			vertices->position.Set((2.f*x*invHorizontalVertexCount - 1.f) * halfSizeX, 0.f, (2.f*y*invVerticalVertexCount - 1.f) * halfSizeY);
 			vertices->uv.Set(textureCoords.x + x*invHorizontalVertexCount*textureCoords.width, textureCoords.y + y*invVerticalVertexCount*textureCoords.height);
 			vertices->normal = normal;
 			vertices->tangent = tangent;
@@ -906,6 +946,8 @@ void NzGeneratePlane(const NzVector2ui& subdivision, const NzVector2f& size, con
 		}
 	}
 
+	NzTransformPositions(matrix, &firstVertex->position, &firstVertex->position, horizontalVertexCount*verticalVertexCount, sizeof(NzMeshVertex), sizeof(NzMeshVertex));
+
 	if (aabb)
 		aabb->Set(matrix.Transform(NzVector3f(-halfSizeX, 0.f, -halfSizeY), 0.f), matrix.Transform(NzVector3f(halfSizeX, 0.f, halfSizeY), 0.f));
 }
@@ -920,6 +962,7 @@ void NzGenerateUvSphere(float size, unsigned int sliceCount, unsigned int stackC
 	const float pi2 = pi * 2.f;
 	const float pi_2 = pi / 2.f;
 
+	NzMeshVertex* firstVertex = vertices;
 	for (unsigned int stack = 0; stack < stackCount; ++stack)
 	{
 		float stackVal = stack * invStackCount;
@@ -936,8 +979,8 @@ void NzGenerateUvSphere(float size, unsigned int sliceCount, unsigned int stackC
 			normal.x = std::cos(sliceValPi2) * sinStackValPi;
 			normal.z = std::sin(sliceValPi2) * sinStackValPi;
 
-			vertices->position = matrix.Transform(size * normal);
-			vertices->normal = matrix.Transform(normal, 0.f);
+			vertices->position = size * normal;
+			vertices->normal = normal;
 			vertices->uv.Set(textureCoords.x + textureCoords.width*(1.f - sliceVal), textureCoords.y + textureCoords.height*stackVal);
 			vertices++;
 
@@ -954,6 +997,10 @@ void NzGenerateUvSphere(float size, unsigned int sliceCount, unsigned int stackC
 		}
 	}
 
+	unsigned int vertexCount = sliceCount * stackCount;
+	NzTransformPositions(matrix, &firstVertex->position, &firstVertex->position, vertexCount, sizeof(NzMeshVertex), sizeof(NzMeshVertex));
+	NzTransformNormals(matrix, &firstVertex->normal, &firstVertex->normal, vertexCount, sizeof(NzMeshVertex), sizeof(NzMeshVertex));
+
 	if (aabb)
 	{
 		NzVector3f totalSize = size * matrix.GetScale();
@@ -969,3 +1016,33 @@ void NzOptimizeIndices(NzIndexIterator indices, unsigned int indexCount)
 	if (optimizer.Optimize(indices, indexCount) != VertexCacheOptimizer::Success)
 		NazaraWarning("Indices optimizer failed");
 }
+
+void NzTransformVertices(const NzMatrix4f& matrix, NzVector3f* positions, NzVector3f* normals, NzVector3f* tangents, unsigned int vertexCount, unsigned int stride)
+{
+	///DOC: Chacun des attributs peut être nul pour ne pas être transformé
+	if (matrix.IsIdentity())
+		return;
+
+	NzMatrix4f normalMatrix = NzComputeNormalMatrix(matrix);
+
+	#if NAZARA_UTILITY_MULTITHREADED_TRANSFORM
+	unsigned int workerCount = (NzTaskScheduler::IsInitialized()) ? NzTaskScheduler::GetWorkerCount() : 1;
+	if (workerCount > 1 && vertexCount >= minParallelTransformVertexCount)
+	{
+		std::ldiv_t div = std::ldiv(vertexCount, workerCount);
+		for (unsigned int i = 0; i < workerCount; ++i)
+		{
+			unsigned int offset = i*div.quot*stride;
+			unsigned int count = (i == workerCount-1) ? div.quot + div.rem : div.quot;
+
+			NzTaskScheduler::AddTask(TransformVertexRange, &matrix, &normalMatrix, Offset(positions, offset), Offset(normals, offset), Offset(tangents, offset), count, stride);
+		}
+
+		NzTaskScheduler::Run();
+		NzTaskScheduler::WaitForTasks();
+		return;
+	}
+	#endif
+
+	TransformVertexRange(&matrix, &normalMatrix, positions, normals, tangents, vertexCount, stride);
+}
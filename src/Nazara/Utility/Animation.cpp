@@ -4,23 +4,508 @@
 
 #include <Nazara/Utility/Animation.hpp>
 #include <Nazara/Core/Error.hpp>
+#include <Nazara/Core/Simd.hpp>
+#include <Nazara/Core/Spinlock.hpp>
 #include <Nazara/Utility/Config.hpp>
+#include <Nazara/Utility/SkeletalPose.hpp>
 #include <Nazara/Utility/Skeleton.hpp>
+#include <algorithm>
+#include <atomic>
+#include <cmath>
 #include <vector>
 #include <unordered_map>
 #include <Nazara/Utility/Debug.hpp>
 
+namespace
+{
+	enum TrackChannel
+	{
+		TrackChannel_Rotation,
+		TrackChannel_Position,
+		TrackChannel_Scale,
+
+		TrackChannel_Max = TrackChannel_Scale
+	};
+
+	// Une piste par joint et par canal, les clés de toutes les pistes sont rangées à la suite dans des tableaux communs
+	// Chaque clé est formée de quatre entiers 16 bits (w, x, y, z pour une rotation, la quatrième composante d'un vecteur
+	// restant nulle) dont la valeur est offset + entier*step, ce qui permet de les décoder par une seule opération SIMD
+	// Une piste dont l'étendue est trop grande pour être quantifiée à la tolérance près garde des clés flottantes
+	// Une piste constante n'a qu'une seule clé
+	struct CompressedTrack
+	{
+		float offset[4];
+		float step[4];
+		unsigned int firstKey;   // Dans keyFrames
+		unsigned int firstValue; // Dans keyData, ou keyValues si la piste n'est pas quantifiée
+		unsigned int keyCount;
+		bool quantized;
+	};
+
+	const unsigned int invalidFrame = 0xFFFFFFFF;
+	const unsigned int maxKeyInterval = 256; // Borne le coût de la réduction des pistes
+	const unsigned int poseCacheSize = 4;
+
+	// Frame décodée d'une animation compressée, le tableau est alloué une fois pour toutes à la compression
+	// Un emplacement épinglé (en cours de lecture ou d'écriture) ne peut être réutilisé pour une autre frame
+	struct CachedPose
+	{
+		std::vector<NzSequenceJoint> joints;
+		std::atomic_uint frame{invalidFrame}; // Publiée une fois le décodage terminé
+		std::atomic_uint pinCount{0};
+		unsigned int lastUse = 0;
+	};
+}
+
 struct NzAnimationImpl
 {
 	std::unordered_map<NzString, unsigned int> sequenceMap;
 	std::vector<NzSequence> sequences;
-	std::vector<NzSequenceJoint> sequenceJoints; // Uniquement pour les animations squelettiques
+	std::vector<NzSequenceJoint> sequenceJoints; // Uniquement pour les animations squelettiques non-compressées
+	std::vector<CompressedTrack> tracks;         // Uniquement pour les animations squelettiques compressées
+	std::vector<float> keyValues;
+	std::vector<nzInt16> keyData;
+	std::vector<nzUInt16> keyFrames;
+	CachedPose poseCache[poseCacheSize];
+	NzSpinlock poseCacheLock;
 	nzAnimationType type;
+	bool compressed = false;
 	bool loopPointInterpolation = false;
 	unsigned int frameCount;
 	unsigned int jointCount;  // Uniquement pour les animations squelettiques
+	unsigned int poseCacheCounter = 0;
 };
 
+namespace
+{
+	void EncodeKey(const float* values, const CompressedTrack& track, nzInt16* data)
+	{
+		for (unsigned int i = 0; i < 4; ++i)
+		{
+			float quantized = (track.step[i] > 0.f) ? (values[i] - track.offset[i])/track.step[i] : 0.f;
+			data[i] = static_cast<nzInt16>(std::max(-32767.f, std::min(std::floor(quantized + 0.5f), 32767.f)));
+		}
+	}
+
+	void DecodeKey(const nzInt16* data, const CompressedTrack& track, float* values)
+	{
+		for (unsigned int i = 0; i < 4; ++i)
+			values[i] = track.offset[i] + static_cast<float>(data[i])*track.step[i];
+	}
+
+	// Les versions scalaires suivent exactement les calculs des versions SSE de SampleRotation/SampleVector
+	NzQuaternionf InterpolateRotation(const NzQuaternionf& from, const NzQuaternionf& to, float interpolation)
+	{
+		// Interpolation linéaire normalisée entre deux clés, bien moins coûteuse que Slerp, l'écart avec les frames
+		// d'origine étant contrôlé à la compression
+		float dot = (from.w*to.w + from.y*to.y) + (from.x*to.x + from.z*to.z);
+		float sign = (dot < 0.f) ? -1.f : 1.f;
+
+		NzQuaternionf interpolated(from.w + (to.w*sign - from.w)*interpolation,
+		                           from.x + (to.x*sign - from.x)*interpolation,
+		                           from.y + (to.y*sign - from.y)*interpolation,
+		                           from.z + (to.z*sign - from.z)*interpolation);
+
+		float length = std::sqrt((interpolated.w*interpolated.w + interpolated.y*interpolated.y) + (interpolated.x*interpolated.x + interpolated.z*interpolated.z));
+		interpolated.w /= length;
+		interpolated.x /= length;
+		interpolated.y /= length;
+		interpolated.z /= length;
+
+		return interpolated;
+	}
+
+	NzVector3f InterpolateVector(const NzVector3f& from, const NzVector3f& to, float interpolation)
+	{
+		return NzVector3f(from.x + (to.x - from.x)*interpolation,
+		                  from.y + (to.y - from.y)*interpolation,
+		                  from.z + (to.z - from.z)*interpolation);
+	}
+
+	float RotationDistance(const NzQuaternionf& a, const NzQuaternionf& b)
+	{
+		// Angle (en radians) de la rotation menant de l'une à l'autre, calculé à partir de la corde plutôt que du
+		// produit scalaire dont l'arc cosinus manque de précision pour de petits angles
+		float difference = std::sqrt((a.w-b.w)*(a.w-b.w) + (a.x-b.x)*(a.x-b.x) + (a.y-b.y)*(a.y-b.y) + (a.z-b.z)*(a.z-b.z));
+		float sum = std::sqrt((a.w+b.w)*(a.w+b.w) + (a.x+b.x)*(a.x+b.x) + (a.y+b.y)*(a.y+b.y) + (a.z+b.z)*(a.z+b.z));
+
+		return 4.f*std::asin(std::min(std::min(difference, sum)*0.5f, 1.f));
+	}
+
+	float VectorDistance(const NzVector3f& a, const NzVector3f& b)
+	{
+		return a.Distance(b);
+	}
+
+	// La quantification d'une piste couvre toute son étendue, l'erreur de décodage peut donc dépasser la tolérance
+	// lorsque celle-ci est grande, la piste garde alors ses valeurs d'origine
+	template<typename T, typename Distance>
+	bool IsQuantizationAccurate(const std::vector<T>& original, const std::vector<T>& decoded, float tolerance, Distance distance)
+	{
+		unsigned int frameCount = original.size();
+		for (unsigned int i = 0; i < frameCount; ++i)
+		{
+			if (distance(decoded[i], original[i]) > tolerance)
+				return false;
+		}
+
+		return true;
+	}
+
+	// Réduction gloutonne: chaque clé est suivie de la frame la plus lointaine permettant de retrouver toutes les
+	// frames intermédiaires par interpolation des clés décodées, à la tolérance près
+	template<typename T, typename Interpolate, typename Distance>
+	void SelectKeys(const std::vector<T>& original, const std::vector<T>& decoded, float tolerance, bool reduce, Interpolate interpolate, Distance distance, std::vector<unsigned int>* keys)
+	{
+		unsigned int frameCount = original.size();
+
+		keys->clear();
+		keys->push_back(0);
+
+		T constant = interpolate(decoded[0], decoded[0], 0.f);
+
+		bool isConstant = true;
+		for (unsigned int i = 1; i < frameCount; ++i)
+		{
+			if (distance(constant, original[i]) > tolerance)
+			{
+				isConstant = false;
+				break;
+			}
+		}
+
+		if (isConstant)
+			return;
+
+		unsigned int start = 0;
+		while (start < frameCount-1)
+		{
+			unsigned int end = start+1;
+			if (reduce)
+			{
+				while (end+1 < frameCount && end+1 - start <= maxKeyInterval)
+				{
+					unsigned int candidate = end+1;
+
+					bool fits = true;
+					for (unsigned int i = start+1; i < candidate; ++i)
+					{
+						float interpolation = static_cast<float>(i - start)/(candidate - start);
+						if (distance(interpolate(decoded[start], decoded[candidate], interpolation), original[i]) > tolerance)
+						{
+							fits = false;
+							break;
+						}
+					}
+
+					if (!fits)
+						break;
+
+					end = candidate;
+				}
+			}
+
+			keys->push_back(end);
+			start = end;
+		}
+	}
+
+	template<typename T>
+	void AppendKeys(const std::vector<unsigned int>& keys, const std::vector<T>& values, CompressedTrack* track, std::vector<T>* keyValues, std::vector<nzUInt16>* keyFrames)
+	{
+		track->firstKey = keyFrames->size();
+		track->firstValue = keyValues->size()/4;
+		track->keyCount = keys.size();
+
+		for (unsigned int frame : keys)
+		{
+			keyValues->insert(keyValues->end(), &values[frame*4], &values[frame*4] + 4);
+			keyFrames->push_back(static_cast<nzUInt16>(frame));
+		}
+	}
+
+	// Renvoie l'indice (dans la piste) de la clé précédant ou correspondant à la frame, ainsi que celui de la suivante et
+	// le facteur d'interpolation vers celle-ci, la dernière clé étant sa propre suivante (avec un facteur nul)
+	inline unsigned int FindKey(const NzAnimationImpl* impl, const CompressedTrack& track, unsigned int frame, unsigned int* nextKey, float* interpolation)
+	{
+		*interpolation = 0.f;
+		if (track.keyCount == 1)
+		{
+			*nextKey = 0;
+			return 0;
+		}
+
+		// La première clé est toujours la frame 0, et la dernière clé la dernière frame
+		// Recherche dichotomique sans branchement (compilée en déplacements conditionnels), les frames échantillonnées
+		// étant imprévisibles d'une piste à l'autre
+		const nzUInt16* begin = &impl->keyFrames[track.firstKey];
+		const nzUInt16* key = begin;
+		unsigned int count = track.keyCount;
+		while (count > 1)
+		{
+			unsigned int half = count/2;
+			key = (key[half] <= frame) ? key + half : key;
+			count -= half;
+		}
+
+		unsigned int index = key - begin;
+		if (index == track.keyCount-1)
+		{
+			*nextKey = index;
+			return index;
+		}
+
+		*interpolation = static_cast<float>(frame - key[0])/(key[1] - key[0]);
+		*nextKey = index+1;
+
+		return index;
+	}
+
+	#if NAZARA_SIMD_SSE2
+	inline __m128 DecodeKey(const nzInt16* data, const CompressedTrack& track)
+	{
+		__m128i packed = _mm_loadl_epi64(reinterpret_cast<const __m128i*>(data));
+		__m128i values = _mm_srai_epi32(_mm_unpacklo_epi16(packed, packed), 16);
+
+		return _mm_add_ps(_mm_loadu_ps(track.offset), _mm_mul_ps(_mm_cvtepi32_ps(values), _mm_loadu_ps(track.step)));
+	}
+
+	inline __m128 LoadKey(const NzAnimationImpl* impl, const CompressedTrack& track, unsigned int key)
+	{
+		unsigned int index = (track.firstValue + key)*4;
+		if (track.quantized)
+			return DecodeKey(&impl->keyData[index], track);
+		else
+			return _mm_loadu_ps(&impl->keyValues[index]);
+	}
+
+	// Somme des quatre composantes, répétée sur chacune d'elles (Même ordre d'addition que la version scalaire)
+	inline __m128 HorizontalSum(__m128 v)
+	{
+		v = _mm_add_ps(v, _mm_shuffle_ps(v, v, _MM_SHUFFLE(1, 0, 3, 2)));
+		return _mm_add_ps(v, _mm_shuffle_ps(v, v, _MM_SHUFFLE(2, 3, 0, 1)));
+	}
+	#else
+	inline void LoadKey(const NzAnimationImpl* impl, const CompressedTrack& track, unsigned int key, float* values)
+	{
+		unsigned int index = (track.firstValue + key)*4;
+		if (track.quantized)
+			DecodeKey(&impl->keyData[index], track, values);
+		else
+			std::copy(&impl->keyValues[index], &impl->keyValues[index] + 4, values);
+	}
+	#endif
+
+	inline void SampleRotation(const NzAnimationImpl* impl, const CompressedTrack& track, unsigned int frame, NzQuaternionf* rotation)
+	{
+		unsigned int nextKey;
+		float interpolation;
+		unsigned int key = FindKey(impl, track, frame, &nextKey, &interpolation);
+
+		#if NAZARA_SIMD_SSE2
+		__m128 from = LoadKey(impl, track, key);
+		__m128 to = LoadKey(impl, track, nextKey);
+
+		__m128 negative = _mm_cmplt_ps(HorizontalSum(_mm_mul_ps(from, to)), _mm_setzero_ps());
+		to = _mm_xor_ps(to, _mm_and_ps(negative, _mm_set1_ps(-0.f)));
+
+		__m128 interpolated = _mm_add_ps(from, _mm_mul_ps(_mm_sub_ps(to, from), _mm_set1_ps(interpolation)));
+		interpolated = _mm_div_ps(interpolated, _mm_sqrt_ps(HorizontalSum(_mm_mul_ps(interpolated, interpolated))));
+
+		_mm_storeu_ps(&rotation->w, interpolated);
+		#else
+		float from[4];
+		float to[4];
+		LoadKey(impl, track, key, from);
+		LoadKey(impl, track, nextKey, to);
+
+		*rotation = InterpolateRotation(NzQuaternionf(from[0], from[1], from[2], from[3]), NzQuaternionf(to[0], to[1], to[2], to[3]), interpolation);
+		#endif
+	}
+
+	inline void SampleVector(const NzAnimationImpl* impl, const CompressedTrack& track, unsigned int frame, NzVector3f* vector)
+	{
+		unsigned int nextKey;
+		float interpolation;
+		unsigned int key = FindKey(impl, track, frame, &nextKey, &interpolation);
+
+		#if NAZARA_SIMD_SSE2
+		__m128 from = LoadKey(impl, track, key);
+		__m128 to = LoadKey(impl, track, nextKey);
+		__m128 interpolated = _mm_add_ps(from, _mm_mul_ps(_mm_sub_ps(to, from), _mm_set1_ps(interpolation)));
+
+		_mm_storel_pi(reinterpret_cast<__m64*>(&vector->x), interpolated);
+		_mm_store_ss(&vector->z, _mm_movehl_ps(interpolated, interpolated));
+		#else
+		float from[4];
+		float to[4];
+		LoadKey(impl, track, key, from);
+		LoadKey(impl, track, nextKey, to);
+
+		*vector = InterpolateVector(NzVector3f(from), NzVector3f(to), interpolation);
+		#endif
+	}
+
+	inline void SampleJoint(const NzAnimationImpl* impl, unsigned int frame, unsigned int jointIndex, NzSequenceJoint* joint)
+	{
+		const CompressedTrack* track = &impl->tracks[jointIndex*(TrackChannel_Max+1)];
+
+		SampleRotation(impl, track[TrackChannel_Rotation], frame, &joint->rotation);
+		SampleVector(impl, track[TrackChannel_Position], frame, &joint->position);
+		SampleVector(impl, track[TrackChannel_Scale], frame, &joint->scale);
+	}
+
+	// Accès aux joints des deux frames interpolées par AnimateSkeleton et AnimatePose
+	// Les personnages jouant une même animation (ou une animation dont la cadence est inférieure à celle du jeu)
+	// échantillonnent souvent les mêmes frames, les dernières frames décodées d'une animation compressée sont donc
+	// conservées ; une frame absente du cache est décodée dans un emplacement libre si fillCache est vrai, et
+	// échantillonnée joint par joint sinon (ou si tous les emplacements sont utilisés par d'autres threads)
+	class FrameSampler
+	{
+		public:
+			FrameSampler(NzAnimationImpl* impl, unsigned int frameA, unsigned int frameB, bool fillCache) :
+			m_impl(impl),
+			m_poseA(nullptr),
+			m_poseB(nullptr),
+			m_frameA(frameA),
+			m_frameB(frameB)
+			{
+				if (!m_impl->compressed)
+					return;
+
+				bool decodeA, decodeB;
+				{
+					NzSpinlockGuard lock(m_impl->poseCacheLock);
+
+					unsigned int lastUse = ++m_impl->poseCacheCounter;
+					m_poseA = Acquire(frameA, fillCache, lastUse, &decodeA);
+					if (frameB != frameA)
+						m_poseB = Acquire(frameB, fillCache, lastUse, &decodeB);
+				}
+
+				// Le décodage se fait hors du verrou, l'emplacement étant épinglé
+				if (m_poseA && decodeA)
+					Decode(m_poseA, frameA);
+
+				if (m_poseB && decodeB)
+					Decode(m_poseB, frameB);
+			}
+
+			~FrameSampler()
+			{
+				if (m_poseA)
+					m_poseA->pinCount.fetch_sub(1, std::memory_order_release);
+
+				if (m_poseB)
+					m_poseB->pinCount.fetch_sub(1, std::memory_order_release);
+			}
+
+			void GetJoints(unsigned int index, const NzSequenceJoint** jointA, const NzSequenceJoint** jointB)
+			{
+				if (!m_impl->compressed)
+				{
+					*jointA = &m_impl->sequenceJoints[m_frameA*m_impl->jointCount + index];
+					*jointB = &m_impl->sequenceJoints[m_frameB*m_impl->jointCount + index];
+					return;
+				}
+
+				*jointA = GetJoint(m_poseA, m_frameA, index, &m_jointA);
+				if (m_frameB != m_frameA)
+					*jointB = GetJoint(m_poseB, m_frameB, index, &m_jointB);
+				else
+					*jointB = *jointA;
+			}
+
+		private:
+			CachedPose* Acquire(unsigned int frame, bool fillCache, unsigned int lastUse, bool* decode)
+			{
+				*decode = false;
+
+				for (CachedPose& cachedPose : m_impl->poseCache)
+				{
+					if (cachedPose.frame.load(std::memory_order_acquire) == frame)
+					{
+						cachedPose.pinCount.fetch_add(1, std::memory_order_relaxed);
+						cachedPose.lastUse = lastUse;
+
+						return &cachedPose;
+					}
+				}
+
+				if (!fillCache)
+					return nullptr;
+
+				CachedPose* leastRecentlyUsed = nullptr;
+				for (CachedPose& cachedPose : m_impl->poseCache)
+				{
+					if (cachedPose.pinCount.load(std::memory_order_acquire) == 0 && (!leastRecentlyUsed || cachedPose.lastUse < leastRecentlyUsed->lastUse))
+						leastRecentlyUsed = &cachedPose;
+				}
+
+				if (leastRecentlyUsed)
+				{
+					leastRecentlyUsed->frame.store(invalidFrame, std::memory_order_relaxed);
+					leastRecentlyUsed->pinCount.store(1, std::memory_order_relaxed);
+					leastRecentlyUsed->lastUse = lastUse;
+
+					*decode = true;
+				}
+
+				return leastRecentlyUsed;
+			}
+
+			void Decode(CachedPose* cachedPose, unsigned int frame)
+			{
+				NzSequenceJoint* joints = cachedPose->joints.data();
+				for (unsigned int i = 0; i < m_impl->jointCount; ++i)
+					SampleJoint(m_impl, frame, i, &joints[i]);
+
+				cachedPose->frame.store(frame, std::memory_order_release);
+			}
+
+			const NzSequenceJoint* GetJoint(const CachedPose* cachedPose, unsigned int frame, unsigned int index, NzSequenceJoint* joint)
+			{
+				if (cachedPose)
+					return &cachedPose->joints[index];
+
+				SampleJoint(m_impl, frame, index, joint);
+				return joint;
+			}
+
+			NzAnimationImpl* m_impl;
+			CachedPose* m_poseA;
+			CachedPose* m_poseB;
+			NzSequenceJoint m_jointA;
+			NzSequenceJoint m_jointB;
+			unsigned int m_frameA;
+			unsigned int m_frameB;
+	};
+}
+
+bool NzAnimationCompressionParams::IsValid() const
+{
+	if (positionTolerance < 0.f || rotationTolerance < 0.f || scaleTolerance < 0.f)
+	{
+		NazaraError("Tolerances must be positive");
+		return false;
+	}
+
+	return true;
+}
+
+bool NzAnimationCompressionParams::operator==(const NzAnimationCompressionParams& params) const
+{
+	return positionTolerance == params.positionTolerance &&
+	       rotationTolerance == params.rotationTolerance &&
+	       scaleTolerance == params.scaleTolerance &&
+	       keyframeReduction == params.keyframeReduction;
+}
+
+bool NzAnimationCompressionParams::operator!=(const NzAnimationCompressionParams& params) const
+{
+	return !operator==(params);
+}
+
 bool NzAnimationParams::IsValid() const
 {
 	if (startFrame > endFrame)
@@ -29,9 +514,28 @@ bool NzAnimationParams::IsValid() const
 		return false;
 	}
 
+	if (compress && !compressionParams.IsValid())
+	{
+		NazaraError("Invalid compression parameters");
+		return false;
+	}
+
 	return true;
 }
 
+bool NzAnimationParams::operator==(const NzAnimationParams& params) const
+{
+	return endFrame == params.endFrame &&
+	       startFrame == params.startFrame &&
+	       compress == params.compress &&
+	       (!compress || compressionParams == params.compressionParams);
+}
+
+bool NzAnimationParams::operator!=(const NzAnimationParams& params) const
+{
+	return !operator==(params);
+}
+
 NzAnimation::~NzAnimation()
 {
 	Destroy();
@@ -58,6 +562,12 @@ bool NzAnimation::AddSequence(const NzSequence& sequence)
 		unsigned int endFrame = sequence.firstFrame + sequence.frameCount - 1;
 		if (endFrame >= m_impl->frameCount)
 		{
+			if (m_impl->compressed)
+			{
+				NazaraError("Compressed animation frame count cannot be extended");
+				return false;
+			}
+
 			m_impl->frameCount = endFrame+1;
 			m_impl->sequenceJoints.resize(m_impl->frameCount*m_impl->jointCount);
 		}
@@ -141,19 +651,259 @@ void NzAnimation::AnimateSkeleton(NzSkeleton* targetSkeleton, unsigned int frame
 	}
 	#endif
 
+	FrameSampler sampler(m_impl, frameA, frameB, true);
 	for (unsigned int i = 0; i < m_impl->jointCount; ++i)
 	{
 		NzJoint* joint = targetSkeleton->GetJoint(i);
 
-		NzSequenceJoint& sequenceJointA = m_impl->sequenceJoints[frameA*m_impl->jointCount + i];
-		NzSequenceJoint& sequenceJointB = m_impl->sequenceJoints[frameB*m_impl->jointCount + i];
+		const NzSequenceJoint* sequenceJointA;
+		const NzSequenceJoint* sequenceJointB;
+		sampler.GetJoints(i, &sequenceJointA, &sequenceJointB);
+
+		joint->SetPosition(NzVector3f::Lerp(sequenceJointA->position, sequenceJointB->position, interpolation));
+		joint->SetRotation(NzQuaternionf::Slerp(sequenceJointA->rotation, sequenceJointB->rotation, interpolation));
+		joint->SetScale(NzVector3f::Lerp(sequenceJointA->scale, sequenceJointB->scale, interpolation));
+	}
+}
+
+void NzAnimation::AnimatePose(NzSkeletalPose* targetPose, unsigned int frameA, unsigned int frameB, float interpolation) const
+{
+	///DOC: Équivalent de AnimateSkeleton sans passer par les noeuds des joints, l'animation pouvant être échantillonnée
+	///DOC: depuis plusieurs threads à la fois
+	#if NAZARA_UTILITY_SAFE
+	if (!m_impl)
+	{
+		NazaraError("Animation not created");
+		return;
+	}
+
+	if (m_impl->type != nzAnimationType_Skeletal)
+	{
+		NazaraError("Animation is not skeletal");
+		return;
+	}
+
+	if (!targetPose || !targetPose->IsValid())
+	{
+		NazaraError("Target pose is invalid");
+		return;
+	}
+
+	if (targetPose->GetJointCount() != m_impl->jointCount)
+	{
+		NazaraError("Target pose joint count must match animation joint count");
+		return;
+	}
 
-		joint->SetPosition(NzVector3f::Lerp(sequenceJointA.position, sequenceJointB.position, interpolation));
-		joint->SetRotation(NzQuaternionf::Slerp(sequenceJointA.rotation, sequenceJointB.rotation, interpolation));
-		joint->SetScale(NzVector3f::Lerp(sequenceJointA.scale, sequenceJointB.scale, interpolation));
+	if (frameA >= m_impl->frameCount)
+	{
+		NazaraError("Frame A is out of range (" + NzString::Number(frameA) + " >= " + NzString::Number(m_impl->frameCount) + ')');
+		return;
+	}
+
+	if (frameB >= m_impl->frameCount)
+	{
+		NazaraError("Frame B is out of range (" + NzString::Number(frameB) + " >= " + NzString::Number(m_impl->frameCount) + ')');
+		return;
+	}
+	#endif
+
+	#ifdef NAZARA_DEBUG
+	if (interpolation < 0.f || interpolation > 1.f)
+	{
+		NazaraError("Interpolation must be in range [0..1] (Got " + NzString::Number(interpolation) + ')');
+		return;
+	}
+	#endif
+
+	// Une frame absente du cache est échantillonnée directement vers la pose, sans passer par le cache
+	FrameSampler sampler(m_impl, frameA, frameB, false);
+
+	NzVector3f* positions = targetPose->GetPositions();
+	NzQuaternionf* rotations = targetPose->GetRotations();
+	NzVector3f* scales = targetPose->GetScales();
+	for (unsigned int i = 0; i < m_impl->jointCount; ++i)
+	{
+		const NzSequenceJoint* sequenceJointA;
+		const NzSequenceJoint* sequenceJointB;
+		sampler.GetJoints(i, &sequenceJointA, &sequenceJointB);
+
+		positions[i] = NzVector3f::Lerp(sequenceJointA->position, sequenceJointB->position, interpolation);
+		rotations[i] = NzQuaternionf::Slerp(sequenceJointA->rotation, sequenceJointB->rotation, interpolation);
+		scales[i] = NzVector3f::Lerp(sequenceJointA->scale, sequenceJointB->scale, interpolation);
 	}
 }
 
+bool NzAnimation::Compress(const NzAnimationCompressionParams& params)
+{
+	///DOC: Les frames ne sont alors plus accessibles via GetSequenceJoints, la compression ne peut être annulée
+	#if NAZARA_UTILITY_SAFE
+	if (!m_impl)
+	{
+		NazaraError("Animation not created");
+		return false;
+	}
+
+	if (m_impl->type != nzAnimationType_Skeletal)
+	{
+		NazaraError("Animation is not skeletal");
+		return false;
+	}
+
+	if (!params.IsValid())
+	{
+		NazaraError("Invalid compression parameters");
+		return false;
+	}
+	#endif
+
+	if (m_impl->compressed)
+		return true;
+
+	if (m_impl->frameCount > 65536)
+	{
+		NazaraError("Frame count is too high to be compressed (" + NzString::Number(m_impl->frameCount) + " > 65536)");
+		return false;
+	}
+
+	#if NAZARA_MATH_ANGLE_RADIAN
+	float rotationTolerance = params.rotationTolerance;
+	#else
+	float rotationTolerance = NzDegreeToRadian(params.rotationTolerance);
+	#endif
+
+	unsigned int frameCount = m_impl->frameCount;
+	unsigned int jointCount = m_impl->jointCount;
+
+	std::vector<CompressedTrack> tracks(jointCount*(TrackChannel_Max+1));
+	std::vector<float> keyValues;
+	std::vector<nzInt16> keyData;
+	std::vector<nzUInt16> keyFrames;
+
+	std::vector<NzQuaternionf> rotations(frameCount);
+	std::vector<NzQuaternionf> decodedRotations(frameCount);
+	std::vector<NzVector3f> vectors(frameCount);
+	std::vector<NzVector3f> decodedVectors(frameCount);
+	std::vector<float> values(frameCount*4);
+	std::vector<nzInt16> encoded(frameCount*4);
+	std::vector<unsigned int> keys;
+
+	auto compressVectors = [&](CompressedTrack* track, float tolerance)
+	{
+		// Les bornes de la piste sont réparties sur [-32767, 32767]
+		NzVector3f minimum = vectors[0];
+		NzVector3f maximum = vectors[0];
+		for (const NzVector3f& vector : vectors)
+		{
+			minimum.Minimize(vector);
+			maximum.Maximize(vector);
+		}
+
+		for (unsigned int i = 0; i < 3; ++i)
+		{
+			track->offset[i] = (minimum[i] + maximum[i])*0.5f;
+			track->step[i] = (maximum[i] - minimum[i])/65534.f;
+		}
+
+		track->offset[3] = 0.f;
+		track->step[3] = 0.f;
+
+		for (unsigned int i = 0; i < frameCount; ++i)
+		{
+			float* value = &values[i*4];
+			value[0] = vectors[i].x;
+			value[1] = vectors[i].y;
+			value[2] = vectors[i].z;
+			value[3] = 0.f;
+
+			float decoded[4];
+			EncodeKey(value, *track, &encoded[i*4]);
+			DecodeKey(&encoded[i*4], *track, decoded);
+
+			decodedVectors[i].Set(decoded);
+		}
+
+		track->quantized = IsQuantizationAccurate(vectors, decodedVectors, tolerance, VectorDistance);
+		if (!track->quantized)
+			decodedVectors = vectors;
+
+		SelectKeys(vectors, decodedVectors, tolerance, params.keyframeReduction, InterpolateVector, VectorDistance, &keys);
+		if (track->quantized)
+			AppendKeys(keys, encoded, track, &keyData, &keyFrames);
+		else
+			AppendKeys(keys, values, track, &keyValues, &keyFrames);
+	};
+
+	for (unsigned int i = 0; i < jointCount; ++i)
+	{
+		CompressedTrack* track = &tracks[i*(TrackChannel_Max+1)];
+
+		// Les composantes d'un quaternion unitaire sont bornées par ±1
+		CompressedTrack& rotationTrack = track[TrackChannel_Rotation];
+		for (unsigned int j = 0; j < 4; ++j)
+		{
+			rotationTrack.offset[j] = 0.f;
+			rotationTrack.step[j] = 1.f/32767.f;
+		}
+
+		for (unsigned int j = 0; j < frameCount; ++j)
+		{
+			rotations[j] = m_impl->sequenceJoints[j*jointCount + i].rotation.GetNormal();
+
+			float* value = &values[j*4];
+			value[0] = rotations[j].w;
+			value[1] = rotations[j].x;
+			value[2] = rotations[j].y;
+			value[3] = rotations[j].z;
+
+			float decoded[4];
+			EncodeKey(value, rotationTrack, &encoded[j*4]);
+			DecodeKey(&encoded[j*4], rotationTrack, decoded);
+
+			decodedRotations[j].Set(decoded[0], decoded[1], decoded[2], decoded[3]);
+		}
+
+		// Le pas des rotations est fixe (Environ 0.0035°), seule une tolérance plus fine impose des clés flottantes
+		rotationTrack.quantized = IsQuantizationAccurate(rotations, decodedRotations, rotationTolerance, RotationDistance);
+		if (!rotationTrack.quantized)
+			decodedRotations = rotations;
+
+		SelectKeys(rotations, decodedRotations, rotationTolerance, params.keyframeReduction, InterpolateRotation, RotationDistance, &keys);
+		if (rotationTrack.quantized)
+			AppendKeys(keys, encoded, &rotationTrack, &keyData, &keyFrames);
+		else
+			AppendKeys(keys, values, &rotationTrack, &keyValues, &keyFrames);
+
+		for (unsigned int j = 0; j < frameCount; ++j)
+			vectors[j] = m_impl->sequenceJoints[j*jointCount + i].position;
+
+		compressVectors(&track[TrackChannel_Position], params.positionTolerance);
+
+		for (unsigned int j = 0; j < frameCount; ++j)
+			vectors[j] = m_impl->sequenceJoints[j*jointCount + i].scale;
+
+		compressVectors(&track[TrackChannel_Scale], params.scaleTolerance);
+	}
+
+	keyData.shrink_to_fit();
+	keyFrames.shrink_to_fit();
+	keyValues.shrink_to_fit();
+
+	m_impl->keyValues = std::move(keyValues);
+	m_impl->keyData = std::move(keyData);
+	m_impl->keyFrames = std::move(keyFrames);
+	m_impl->tracks = std::move(tracks);
+	m_impl->compressed = true;
+
+	for (CachedPose& cachedPose : m_impl->poseCache)
+		cachedPose.joints.resize(jointCount);
+
+	// Les frames d'origine ne sont plus nécessaires
+	std::vector<NzSequenceJoint>().swap(m_impl->sequenceJoints);
+
+	return true;
+}
+
 bool NzAnimation::CreateSkeletal(unsigned int frameCount, unsigned int jointCount)
 {
 	Destroy();
@@ -232,6 +982,24 @@ unsigned int NzAnimation::GetJointCount() const
 	return m_impl->jointCount;
 }
 
+unsigned int NzAnimation::GetMemoryUsage() const
+{
+	///DOC: Taille (en octets) des données des frames, hors cache de poses
+	#if NAZARA_UTILITY_SAFE
+	if (!m_impl)
+	{
+		NazaraError("Animation not created");
+		return 0;
+	}
+	#endif
+
+	return m_impl->sequenceJoints.size()*sizeof(NzSequenceJoint) +
+	       m_impl->tracks.size()*sizeof(CompressedTrack) +
+	       m_impl->keyValues.size()*sizeof(float) +
+	       m_impl->keyData.size()*sizeof(nzInt16) +
+	       m_impl->keyFrames.size()*sizeof(nzUInt16);
+}
+
 NzSequence* NzAnimation::GetSequence(const NzString& sequenceName)
 {
 	#if NAZARA_UTILITY_SAFE
@@ -366,6 +1134,12 @@ NzSequenceJoint* NzAnimation::GetSequenceJoints(unsigned int frameIndex)
 		NazaraError("Animation is not skeletal");
 		return nullptr;
 	}
+
+	if (m_impl->compressed)
+	{
+		NazaraError("Animation is compressed");
+		return nullptr;
+	}
 	#endif
 
 	return &m_impl->sequenceJoints[frameIndex*m_impl->jointCount];
@@ -385,6 +1159,12 @@ const NzSequenceJoint* NzAnimation::GetSequenceJoints(unsigned int frameIndex) c
 		NazaraError("Animation is not skeletal");
 		return nullptr;
 	}
+
+	if (m_impl->compressed)
+	{
+		NazaraError("Animation is compressed");
+		return nullptr;
+	}
 	#endif
 
 	return &m_impl->sequenceJoints[frameIndex*m_impl->jointCount];
@@ -429,6 +1209,19 @@ bool NzAnimation::HasSequence(unsigned int index) const
 	return index >= m_impl->sequences.size();
 }
 
+bool NzAnimation::IsCompressed() const
+{
+	#if NAZARA_UTILITY_SAFE
+	if (!m_impl)
+	{
+		NazaraError("Animation not created");
+		return false;
+	}
+	#endif
+
+	return m_impl->compressed;
+}
+
 bool NzAnimation::IsLoopPointInterpolationEnabled() const
 {
 	#if NAZARA_UTILITY_SAFE
@@ -0,0 +1,210 @@
+// Copyright (C) 2014 Jérôme Leclercq
+// This file is part of the "Nazara Engine - Utility module"
+// For conditions of distribution and use, see copyright notice in Config.hpp
+
+#include <Nazara/Utility/AnimationInstancer.hpp>
+#include <Nazara/Core/Error.hpp>
+#include <Nazara/Utility/Animation.hpp>
+#include <Nazara/Utility/SkeletalMesh.hpp>
+#include <algorithm>
+#include <cmath>
+#include <functional>
+#include <Nazara/Utility/Debug.hpp>
+
+NzAnimationInstancer::NzAnimationInstancer(unsigned int subdivisionCount) :
+m_subdivisionCount(std::max(subdivisionCount, 1U))
+{
+}
+
+NzAnimationInstancer::~NzAnimationInstancer()
+{
+	#ifdef NAZARA_DEBUG
+	if (!m_instances.empty())
+		NazaraWarning(NzString::Number(m_instances.size()) + " instance(s) still referenced");
+	#endif
+
+	for (auto& pair : m_instances)
+		delete pair.second;
+
+	Clear();
+}
+
+NzAnimationInstancer::Instance* NzAnimationInstancer::Acquire(const NzMesh* mesh, const NzAnimation* animation, unsigned int frameA, unsigned int frameB, float interpolation)
+{
+	///DOC: L'instance renvoyée doit être rendue via Release lorsque le modèle change de frame ou n'est plus animé
+	#if NAZARA_UTILITY_SAFE
+	if (!mesh || !mesh->IsValid() || mesh->GetAnimationType() != nzAnimationType_Skeletal)
+	{
+		NazaraError("Mesh must be a valid skeletal mesh");
+		return nullptr;
+	}
+
+	if (!animation || !animation->IsValid() || animation->GetType() != nzAnimationType_Skeletal)
+	{
+		NazaraError("Animation must be a valid skeletal animation");
+		return nullptr;
+	}
+
+	if (animation->GetJointCount() != mesh->GetJointCount())
+	{
+		NazaraError("Animation joint count must match mesh joint count");
+		return nullptr;
+	}
+	#endif
+
+	Instance::Key key;
+	key.animation = animation;
+	key.mesh = mesh;
+	key.frameA = frameA;
+	key.frameB = frameB;
+	key.subdivision = static_cast<unsigned int>(std::floor(interpolation*m_subdivisionCount + 0.5f));
+
+	// Les extrémités de l'intervalle ne dépendent que d'une frame, ce qui permet de les partager davantage
+	if (key.subdivision == 0)
+		key.frameB = frameA;
+	else if (key.subdivision >= m_subdivisionCount)
+	{
+		key.frameA = frameB;
+		key.subdivision = 0;
+	}
+
+	auto it = m_instances.find(key);
+	if (it != m_instances.end())
+	{
+		it->second->m_referenceCount++;
+		return it->second;
+	}
+
+	Instance* instance;
+	if (m_freeInstances.empty())
+		instance = new Instance;
+	else
+	{
+		instance = m_freeInstances.back();
+		m_freeInstances.pop_back();
+	}
+
+	// La copie du squelette (Et de sa hiérarchie) n'est refaite que si l'instance servait un autre mesh
+	if (instance->m_mesh != mesh)
+	{
+		instance->m_mesh = mesh;
+		instance->m_skeleton = *mesh->GetSkeleton();
+	}
+
+	instance->m_key = key;
+	instance->m_referenceCount = 1;
+	instance->m_skinned.assign(mesh->GetSubMeshCount(), false);
+	instance->m_skinnedVertices.resize(mesh->GetSubMeshCount());
+
+	animation->AnimateSkeleton(&instance->m_skeleton, key.frameA, key.frameB, static_cast<float>(key.subdivision)/m_subdivisionCount);
+
+	m_instances[key] = instance;
+
+	return instance;
+}
+
+void NzAnimationInstancer::Clear()
+{
+	///DOC: Libère les instances inutilisées conservées pour être recyclées (Ainsi que les meshs qu'elles retiennent)
+	for (Instance* instance : m_freeInstances)
+		delete instance;
+
+	m_freeInstances.clear();
+}
+
+unsigned int NzAnimationInstancer::GetInstanceCount() const
+{
+	return m_instances.size();
+}
+
+unsigned int NzAnimationInstancer::GetSubdivisionCount() const
+{
+	return m_subdivisionCount;
+}
+
+void NzAnimationInstancer::Release(Instance* instance)
+{
+	#if NAZARA_UTILITY_SAFE
+	if (!instance || instance->m_referenceCount == 0)
+	{
+		NazaraError("Invalid instance");
+		return;
+	}
+	#endif
+
+	if (--instance->m_referenceCount == 0)
+	{
+		m_instances.erase(instance->m_key);
+		m_freeInstances.push_back(instance);
+	}
+}
+
+void NzAnimationInstancer::SetSubdivisionCount(unsigned int subdivisionCount)
+{
+	///DOC: Ne concerne que les instances acquises par la suite
+	#if NAZARA_UTILITY_SAFE
+	if (subdivisionCount == 0)
+	{
+		NazaraError("Subdivision count must be over 0");
+		return;
+	}
+	#endif
+
+	m_subdivisionCount = subdivisionCount;
+}
+
+NzSkeleton* NzAnimationInstancer::Instance::GetSkeleton()
+{
+	return &m_skeleton;
+}
+
+const NzSkeleton* NzAnimationInstancer::Instance::GetSkeleton() const
+{
+	return &m_skeleton;
+}
+
+const NzMeshVertex* NzAnimationInstancer::Instance::GetSkinnedVertices(unsigned int subMeshIndex) const
+{
+	///DOC: Le skinning n'est effectué qu'à la première demande, pour l'ensemble des modèles partageant l'instance
+	#if NAZARA_UTILITY_SAFE
+	if (subMeshIndex >= m_skinned.size())
+	{
+		NazaraError("Submesh index out of range (" + NzString::Number(subMeshIndex) + " >= " + NzString::Number(m_skinned.size()) + ')');
+		return nullptr;
+	}
+	#endif
+
+	if (!m_skinned[subMeshIndex])
+	{
+		const NzSkeletalMesh* subMesh = static_cast<const NzSkeletalMesh*>(m_mesh->GetSubMesh(subMeshIndex));
+
+		std::vector<NzMeshVertex>& vertices = m_skinnedVertices[subMeshIndex];
+		vertices.resize(subMesh->GetVertexCount());
+
+		subMesh->Skin(vertices.data(), &m_skeleton);
+		m_skinned[subMeshIndex] = true;
+	}
+
+	return m_skinnedVertices[subMeshIndex].data();
+}
+
+unsigned int NzAnimationInstancer::Instance::GetReferenceCount() const
+{
+	return m_referenceCount;
+}
+
+bool NzAnimationInstancer::Instance::Key::operator==(const Key& key) const
+{
+	return animation == key.animation && mesh == key.mesh && frameA == key.frameA && frameB == key.frameB && subdivision == key.subdivision;
+}
+
+std::size_t NzAnimationInstancer::Instance::KeyHash::operator()(const Key& key) const
+{
+	std::size_t h = std::hash<const void*>()(key.animation);
+	h = h*31 + std::hash<const void*>()(key.mesh);
+	h = h*31 + key.frameA;
+	h = h*31 + key.frameB;
+	h = h*31 + key.subdivision;
+
+	return h;
+}
@@ -30,6 +30,17 @@ bool NzImageParams::IsValid() const
 	return true;
 }
 
+bool NzImageParams::operator==(const NzImageParams& params) const
+{
+	return loadFormat == params.loadFormat &&
+	       levelCount == params.levelCount;
+}
+
+bool NzImageParams::operator!=(const NzImageParams& params) const
+{
+	return !operator==(params);
+}
+
 NzImage::NzImage() :
 m_sharedImage(&emptyImage)
 {
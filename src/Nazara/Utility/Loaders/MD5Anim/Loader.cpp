@@ -3,6 +3,7 @@
 // For conditions of distribution and use, see copyright notice in Config.hpp
 
 #include <Nazara/Utility/Loaders/MD5Anim.hpp>
+#include <Nazara/Core/Error.hpp>
 #include <Nazara/Utility/Loaders/MD5Anim/Parser.hpp>
 #include <Nazara/Utility/Debug.hpp>
 
@@ -22,7 +23,16 @@ namespace
 	bool Load(NzAnimation* animation, NzInputStream& stream, const NzAnimationParams& parameters)
 	{
 		NzMD5AnimParser parser(stream, parameters);
-		return parser.Parse(animation);
+		if (!parser.Parse(animation))
+			return false;
+
+		if (parameters.compress && !animation->Compress(parameters.compressionParams))
+		{
+			NazaraError("Failed to compress animation");
+			return false;
+		}
+
+		return true;
 	}
 }
 
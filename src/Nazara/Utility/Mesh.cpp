@@ -46,6 +46,20 @@ bool NzMeshParams::IsValid() const
 	return true;
 }
 
+bool NzMeshParams::operator==(const NzMeshParams& params) const
+{
+	return storage == params.storage &&
+	       scale == params.scale &&
+	       animated == params.animated &&
+	       center == params.center &&
+	       optimizeIndexBuffers == params.optimizeIndexBuffers;
+}
+
+bool NzMeshParams::operator!=(const NzMeshParams& params) const
+{
+	return !operator==(params);
+}
+
 struct NzMeshImpl
 {
 	NzMeshImpl()
@@ -833,6 +847,7 @@ void NzMesh::Recenter()
 		aabb.Translate(-center);
 
 		staticMesh->SetAABB(aabb);
+		staticMesh->InvalidateTriangleBVH();
 	}
 
 	// Il ne faut pas oublier d'invalider notre AABB
@@ -993,18 +1008,11 @@ void NzMesh::Transform(const NzMatrix4f& matrix)
 		NzBufferMapper<NzVertexBuffer> mapper(staticMesh->GetVertexBuffer(), nzBufferAccess_ReadWrite);
 		NzMeshVertex* vertices = static_cast<NzMeshVertex*>(mapper.GetPointer());
 
-		NzBoxf aabb(vertices->position.x, vertices->position.y, vertices->position.z, 0.f, 0.f, 0.f);
-
 		unsigned int vertexCount = staticMesh->GetVertexCount();
-		for (unsigned int i = 0; i < vertexCount; ++i)
-		{
-			vertices->position = matrix.Transform(vertices->position);
-			aabb.ExtendTo(vertices->position);
-
-			vertices++;
-		}
+		NzTransformVertices(vertices, vertexCount, matrix);
 
-		staticMesh->SetAABB(aabb);
+		staticMesh->SetAABB(NzComputeVerticesAABB(vertices, vertexCount));
+		staticMesh->InvalidateTriangleBVH();
 	}
 
 	// Il ne faut pas oublier d'invalider notre AABB
@@ -3,6 +3,7 @@
 // For conditions of distribution and use, see copyright notice in Config.hpp
 
 #include <Nazara/Utility/Node.hpp>
+#include <Nazara/Utility/TransformSystem.hpp>
 #include <Nazara/Utility/Debug.hpp>
 
 NzNode::NzNode() :
@@ -13,6 +14,8 @@ m_initialScale(NzVector3f(1.f, 1.f, 1.f)),
 m_position(NzVector3f::Zero()),
 m_scale(NzVector3f(1.f, 1.f, 1.f)),
 m_parent(nullptr),
+m_transformSystem(nullptr),
+m_transformIndex(0),
 m_derivedUpdated(false),
 m_inheritPosition(true),
 m_inheritRotation(true),
@@ -29,6 +32,8 @@ m_initialScale(node.m_initialScale),
 m_position(node.m_position),
 m_scale(node.m_scale),
 m_parent(node.m_parent),
+m_transformSystem(nullptr),
+m_transformIndex(0),
 m_derivedUpdated(false),
 m_inheritPosition(node.m_inheritPosition),
 m_inheritRotation(node.m_inheritRotation),
@@ -45,6 +50,9 @@ NzNode::~NzNode()
 		child->SetParent(nullptr);
 
 	SetParent(nullptr);
+
+	if (m_transformSystem)
+		m_transformSystem->Unregister(this);
 }
 
 void NzNode::EnsureDerivedUpdate() const
@@ -211,6 +219,11 @@ const NzMatrix4f& NzNode::GetTransformMatrix() const
 	return m_transformMatrix;
 }
 
+NzTransformSystem* NzNode::GetTransformSystem() const
+{
+	return m_transformSystem;
+}
+
 NzVector3f NzNode::GetUp() const
 {
 	if (!m_derivedUpdated)
@@ -437,6 +450,11 @@ void NzNode::SetParent(const NzNode* node, bool keepDerived)
 		if (!m_derivedUpdated)
 			UpdateDerived();
 
+		// Les accesseurs du nouveau parent peuvent mettre ce noeud à jour entre deux appels, on en garde donc une copie
+		NzVector3f derivedPosition(m_derivedPosition);
+		NzQuaternionf derivedRotation(m_derivedRotation);
+		NzVector3f derivedScale(m_derivedScale);
+
 		if (m_parent)
 			m_parent->RemoveChild(this);
 
@@ -444,9 +462,9 @@ void NzNode::SetParent(const NzNode* node, bool keepDerived)
 		if (m_parent)
 			m_parent->AddChild(this);
 
-		SetRotation(m_derivedRotation, nzCoordSys_Global);
-		SetScale(m_derivedScale, nzCoordSys_Global);
-		SetPosition(m_derivedPosition, nzCoordSys_Global);
+		SetRotation(derivedRotation, nzCoordSys_Global);
+		SetScale(derivedScale, nzCoordSys_Global);
+		SetPosition(derivedPosition, nzCoordSys_Global);
 	}
 	else
 	{
@@ -460,6 +478,9 @@ void NzNode::SetParent(const NzNode* node, bool keepDerived)
 		Invalidate();
 	}
 
+	if (m_transformSystem)
+		m_transformSystem->InvalidateHierarchy();
+
 	OnParenting(node);
 }
 
@@ -564,6 +585,23 @@ void NzNode::SetTransformMatrix(const NzMatrix4f& matrix)
 	m_transformMatrixUpdated = true;
 }
 
+void NzNode::SetTransformSystem(NzTransformSystem* transformSystem)
+{
+	if (m_transformSystem == transformSystem)
+		return;
+
+	if (m_transformSystem)
+		m_transformSystem->Unregister(this);
+
+	m_transformSystem = transformSystem;
+	if (m_transformSystem)
+		m_transformSystem->Register(this);
+
+	// Le système calcule ses noeuds sans toucher à leurs indicateurs, un descendant peut donc avoir des valeurs calculées
+	// sous un noeud invalide : Invalidate s'arrêterait à ce dernier, tout le sous-arbre est donc invalidé
+	InvalidateSubtree();
+}
+
 NzVector3f NzNode::ToGlobalPosition(const NzVector3f& localPosition) const
 {
 	if (!m_derivedUpdated)
@@ -612,6 +650,43 @@ NzVector3f NzNode::ToLocalScale(const NzVector3f& globalScale) const
 	return globalScale / m_derivedScale;
 }
 
+void NzNode::UpdateTransforms() const
+{
+	// Met à jour ce noeud et tous ses descendants en une passe, plutôt qu'à la demande de chaque accesseur
+	// Le parcours se fait en largeur: un parent est toujours traité avant ses enfants, UpdateDerived ne remonte donc jamais la hiérarchie
+	// et chaque matrice n'est calculée qu'une fois
+	static thread_local std::vector<const NzNode*> queue;
+
+	// On s'approprie la file, au cas où une mise à jour déclencherait une autre passe
+	std::vector<const NzNode*> nodes;
+	nodes.swap(queue);
+
+	nodes.clear();
+	nodes.push_back(this);
+
+	for (unsigned int i = 0; i < nodes.size(); ++i)
+	{
+		const NzNode* node = nodes[i];
+		if (node->m_transformSystem)
+		{
+			// Le système met à jour tous ses noeuds d'un coup, chaque noeud n'en copiera le résultat qu'à la demande
+			node->m_transformSystem->Update();
+		}
+		else
+		{
+			if (!node->m_derivedUpdated)
+				node->UpdateDerived();
+
+			if (!node->m_transformMatrixUpdated)
+				node->UpdateTransformMatrix();
+		}
+
+		nodes.insert(nodes.end(), node->m_childs.begin(), node->m_childs.end());
+	}
+
+	queue.swap(nodes);
+}
+
 NzNode& NzNode::operator=(const NzNode& node)
 {
 	SetParent(node.m_parent);
@@ -647,11 +722,31 @@ void NzNode::AddChild(NzNode* node) const
 
 void NzNode::Invalidate()
 {
+	// Mettre à jour un noeud met d'abord à jour ses parents, un noeud entièrement invalide n'a donc que des descendants invalides
+	// Ceux-ci ont été invalidés en même temps que lui, inutile de parcourir à nouveau le sous-arbre
+	bool wasUpdated = (m_derivedUpdated || m_transformMatrixUpdated);
+
+	// L'emplacement du noeud dans le système de transformation est toujours mis à jour: le système recalcule
+	// indépendamment des indicateurs du noeud
+	if (m_transformSystem)
+		m_transformSystem->Invalidate(this);
+
 	m_derivedUpdated = false;
 	m_transformMatrixUpdated = false;
 
+	if (wasUpdated)
+	{
+		for (NzNode* node : m_childs)
+			node->Invalidate();
+	}
+}
+
+void NzNode::InvalidateSubtree()
+{
+	Invalidate();
+
 	for (NzNode* node : m_childs)
-		node->Invalidate();
+		node->InvalidateSubtree();
 }
 
 void NzNode::OnParenting(const NzNode* parent)
@@ -670,6 +765,21 @@ void NzNode::RemoveChild(NzNode* node) const
 
 void NzNode::UpdateDerived() const
 {
+	if (m_transformSystem)
+	{
+		// Comme sans système, les parents sont mis à jour avant leur enfant : Invalidate ne descend dans les enfants
+		// que d'un noeud à jour, un enfant à jour sous un parent invalide ne serait donc plus jamais invalidé
+		if (m_parent && !m_parent->m_derivedUpdated)
+			m_parent->UpdateDerived();
+
+		// Le système calcule les transformations de tous ses noeuds en un seul parcours, le noeud n'en fait qu'une copie
+		m_transformSystem->Update(this);
+		m_transformSystem->GetDerived(m_transformIndex, &m_derivedPosition, &m_derivedRotation, &m_derivedScale);
+
+		m_derivedUpdated = true;
+		return;
+	}
+
 	if (m_parent)
 	{
 		if (!m_parent->m_derivedUpdated)
@@ -707,6 +817,10 @@ void NzNode::UpdateTransformMatrix() const
 	if (!m_derivedUpdated)
 		UpdateDerived();
 
-	m_transformMatrix.MakeTransform(m_derivedPosition, m_derivedRotation, m_derivedScale);
+	if (m_transformSystem)
+		m_transformMatrix = m_transformSystem->GetTransformMatrix(m_transformIndex);
+	else
+		m_transformMatrix.MakeTransform(m_derivedPosition, m_derivedRotation, m_derivedScale);
+
 	m_transformMatrixUpdated = true;
 }
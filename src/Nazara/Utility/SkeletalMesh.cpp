@@ -5,12 +5,15 @@
 #include <Nazara/Core/Clock.hpp>
 
 #include <Nazara/Utility/SkeletalMesh.hpp>
+#include <Nazara/Core/PerformanceCounters.hpp>
+#include <Nazara/Core/Profiler.hpp>
 #include <Nazara/Core/TaskScheduler.hpp>
 #include <Nazara/Utility/BufferMapper.hpp>
 #include <Nazara/Utility/Config.hpp>
 #include <Nazara/Utility/Mesh.hpp>
 #include <Nazara/Utility/Skeleton.hpp>
 #include <Nazara/Utility/VertexStruct.hpp>
+#include <limits>
 #include <memory>
 #include <vector>
 #include <Nazara/Utility/Debug.hpp>
@@ -26,11 +29,22 @@ namespace
 		const NzWeight* weights;
 	};
 
-	void Skin_Position(const SkinningInfos& skinningInfos, unsigned int startVertex, unsigned int vertexCount)
+	// Les bornes des positions produites sont calculées pendant le skinning, les sommets étant déjà en registres
+	// Chaque tâche dispose des siennes, réunies ensuite
+	struct SkinningBounds
+	{
+		NzVector3f minimum = NzVector3f(std::numeric_limits<float>::infinity());
+		NzVector3f maximum = NzVector3f(-std::numeric_limits<float>::infinity());
+	};
+
+	void Skin_Position(const SkinningInfos& skinningInfos, unsigned int startVertex, unsigned int vertexCount, SkinningBounds* bounds)
 	{
 		const NzMeshVertex* inputVertex = &skinningInfos.inputVertex[startVertex];
 		NzMeshVertex* outputVertex = &skinningInfos.outputVertex[startVertex];
 
+		NzVector3f minimum = bounds->minimum;
+		NzVector3f maximum = bounds->maximum;
+
 		unsigned int endVertex = startVertex + vertexCount - 1;
 		for (unsigned int i = startVertex; i <= endVertex; ++i)
 		{
@@ -51,16 +65,25 @@ namespace
 			outputVertex->position = finalPosition;
 			outputVertex->uv = inputVertex->uv;
 
+			minimum.Minimize(finalPosition);
+			maximum.Maximize(finalPosition);
+
 			inputVertex++;
 			outputVertex++;
 		}
+
+		bounds->minimum = minimum;
+		bounds->maximum = maximum;
 	}
 
-	void Skin_PositionNormal(const SkinningInfos& skinningInfos, unsigned int startVertex, unsigned int vertexCount)
+	void Skin_PositionNormal(const SkinningInfos& skinningInfos, unsigned int startVertex, unsigned int vertexCount, SkinningBounds* bounds)
 	{
 		const NzMeshVertex* inputVertex = &skinningInfos.inputVertex[startVertex];
 		NzMeshVertex* outputVertex = &skinningInfos.outputVertex[startVertex];
 
+		NzVector3f minimum = bounds->minimum;
+		NzVector3f maximum = bounds->maximum;
+
 		unsigned int endVertex = startVertex + vertexCount - 1;
 		for (unsigned int i = startVertex; i <= endVertex; ++i)
 		{
@@ -86,16 +109,25 @@ namespace
 			outputVertex->position = finalPosition;
 			outputVertex->uv = inputVertex->uv;
 
+			minimum.Minimize(finalPosition);
+			maximum.Maximize(finalPosition);
+
 			inputVertex++;
 			outputVertex++;
 		}
+
+		bounds->minimum = minimum;
+		bounds->maximum = maximum;
 	}
 
-	void Skin_PositionNormalTangent(const SkinningInfos& skinningInfos, unsigned int startVertex, unsigned int vertexCount)
+	void Skin_PositionNormalTangent(const SkinningInfos& skinningInfos, unsigned int startVertex, unsigned int vertexCount, SkinningBounds* bounds)
 	{
 		const NzMeshVertex* inputVertex = &skinningInfos.inputVertex[startVertex];
 		NzMeshVertex* outputVertex = &skinningInfos.outputVertex[startVertex];
 
+		NzVector3f minimum = bounds->minimum;
+		NzVector3f maximum = bounds->maximum;
+
 		unsigned int endVertex = startVertex + vertexCount - 1;
 		for (unsigned int i = startVertex; i <= endVertex; ++i)
 		{
@@ -125,9 +157,15 @@ namespace
 			outputVertex->tangent = finalTangent;
 			outputVertex->uv = inputVertex->uv;
 
+			minimum.Minimize(finalPosition);
+			maximum.Maximize(finalPosition);
+
 			inputVertex++;
 			outputVertex++;
 		}
+
+		bounds->minimum = minimum;
+		bounds->maximum = maximum;
 	}
 }
 
@@ -351,6 +389,8 @@ void NzSkeletalMesh::Skin(NzMeshVertex* outputBuffer) const
 
 void NzSkeletalMesh::Skin(NzMeshVertex* outputBuffer, const NzSkeleton* skeleton) const
 {
+	NazaraProfile("NzSkeletalMesh::Skin")
+
 	#if NAZARA_UTILITY_SAFE
 	if (!m_impl)
 	{
@@ -372,18 +412,30 @@ void NzSkeletalMesh::Skin(NzMeshVertex* outputBuffer, const NzSkeleton* skeleton
 		skinningInfos.joints[i].EnsureTransformMatrixUpdate();
 
 	unsigned int workerCount = NzTaskScheduler::GetWorkerCount();
+	std::vector<SkinningBounds> bounds(workerCount);
 
 	std::ldiv_t div = std::ldiv(m_impl->vertexCount, workerCount); // Qui sait, peut-être que ça permet des optimisations plus efficaces
 	for (unsigned int i = 0; i < workerCount; ++i)
-		NzTaskScheduler::AddTask(Skin_PositionNormalTangent, skinningInfos, i*div.quot, (i == workerCount-1) ? div.quot + div.rem : div.quot);
+		NzTaskScheduler::AddTask(Skin_PositionNormalTangent, skinningInfos, i*div.quot, (i == workerCount-1) ? div.quot + div.rem : div.quot, &bounds[i]);
 
 	NzTaskScheduler::Run();
 	NzTaskScheduler::WaitForTasks();
+
+	for (unsigned int i = 1; i < workerCount; ++i)
+	{
+		bounds[0].minimum.Minimize(bounds[i].minimum);
+		bounds[0].maximum.Maximize(bounds[i].maximum);
+	}
+
+	m_impl->aabb.Set(bounds[0].minimum, bounds[0].maximum);
 	#else
-	Skin_PositionNormalTangent(skinningInfos, 0, m_impl->vertexCount);
+	SkinningBounds bounds;
+	Skin_PositionNormalTangent(skinningInfos, 0, m_impl->vertexCount, &bounds);
+
+	m_impl->aabb.Set(bounds.minimum, bounds.maximum);
 	#endif
 
-	m_impl->aabb = skeleton->GetAABB(); ///FIXME: Qu'est-ce que ça fait encore là ça ?
+	NazaraCount(nzPerformanceCounter_SkinnedVertices, m_impl->vertexCount)
 }
 
 void NzSkeletalMesh::SetIndexBuffer(const NzIndexBuffer* indexBuffer)
@@ -0,0 +1,459 @@
+// Copyright (C) 2014 Jérôme Leclercq
+// This file is part of the "Nazara Engine - Utility module"
+// For conditions of distribution and use, see copyright notice in Config.hpp
+
+#include <Nazara/Utility/SkeletalPose.hpp>
+#include <Nazara/Core/Error.hpp>
+#include <Nazara/Utility/SkeletalPosePool.hpp>
+#include <Nazara/Utility/Skeleton.hpp>
+#include <algorithm>
+#include <Nazara/Utility/Debug.hpp>
+
+namespace
+{
+	const unsigned int jointSize = sizeof(NzQuaternionf) + 2*sizeof(NzVector3f);
+
+	// Interpolation linéaire normalisée: contrairement à Slerp, elle reste correcte (et bien moins coûteuse) lorsque
+	// plusieurs mélanges sont enchaînés, le poids de chaque couche n'ayant pas besoin d'être exactement angulaire
+	inline NzQuaternionf BlendRotation(const NzQuaternionf& from, const NzQuaternionf& to, float weight)
+	{
+		// On passe par le plus court chemin
+		float sign = (from.DotProduct(to) < 0.f) ? -1.f : 1.f;
+
+		NzQuaternionf blended(from.w + (to.w*sign - from.w)*weight,
+		                      from.x + (to.x*sign - from.x)*weight,
+		                      from.y + (to.y*sign - from.y)*weight,
+		                      from.z + (to.z*sign - from.z)*weight);
+
+		return blended.Normalize();
+	}
+
+	inline NzVector3f BlendVector(const NzVector3f& from, const NzVector3f& to, float weight)
+	{
+		return from + (to - from)*weight;
+	}
+}
+
+NzSkeletalPose::NzSkeletalPose(unsigned int jointCount)
+{
+	Create(jointCount);
+}
+
+NzSkeletalPose::NzSkeletalPose(NzSkeletalPosePool* pool)
+{
+	Create(pool);
+}
+
+NzSkeletalPose::NzSkeletalPose(const NzSkeletalPose& pose)
+{
+	operator=(pose);
+}
+
+NzSkeletalPose::NzSkeletalPose(NzSkeletalPose&& pose) noexcept :
+m_pool(pose.m_pool),
+m_rotations(pose.m_rotations),
+m_positions(pose.m_positions),
+m_scales(pose.m_scales),
+m_jointCount(pose.m_jointCount)
+{
+	pose.m_pool = nullptr;
+	pose.m_rotations = nullptr;
+	pose.m_positions = nullptr;
+	pose.m_scales = nullptr;
+	pose.m_jointCount = 0;
+}
+
+NzSkeletalPose::~NzSkeletalPose()
+{
+	Destroy();
+}
+
+void NzSkeletalPose::AddAdditive(const NzSkeletalPose& additivePose, float weight, const float* jointWeights)
+{
+	///DOC: La pose additive doit provenir de MakeAdditive, jointWeights (facultatif) pondère le poids de chaque joint
+	#if NAZARA_UTILITY_SAFE
+	if (!IsValid())
+	{
+		NazaraError("Pose not created");
+		return;
+	}
+
+	if (!additivePose.IsValid())
+	{
+		NazaraError("Additive pose is invalid");
+		return;
+	}
+
+	if (additivePose.m_jointCount != m_jointCount)
+	{
+		NazaraError("Poses must have the same joint count");
+		return;
+	}
+	#endif
+
+	for (unsigned int i = 0; i < m_jointCount; ++i)
+	{
+		float jointWeight = (jointWeights) ? weight*jointWeights[i] : weight;
+
+		m_rotations[i] = m_rotations[i] * BlendRotation(NzQuaternionf::Identity(), additivePose.m_rotations[i], jointWeight);
+		m_rotations[i].Normalize();
+
+		m_positions[i] += additivePose.m_positions[i]*jointWeight;
+		m_scales[i] *= BlendVector(NzVector3f::Unit(), additivePose.m_scales[i], jointWeight);
+	}
+}
+
+void NzSkeletalPose::Apply(NzSkeleton* skeleton) const
+{
+	#if NAZARA_UTILITY_SAFE
+	if (!IsValid())
+	{
+		NazaraError("Pose not created");
+		return;
+	}
+
+	if (!skeleton || !skeleton->IsValid())
+	{
+		NazaraError("Invalid skeleton");
+		return;
+	}
+
+	if (skeleton->GetJointCount() != m_jointCount)
+	{
+		NazaraError("Skeleton joint count does not match pose joint count (" + NzString::Number(skeleton->GetJointCount()) + " != " + NzString::Number(m_jointCount) + ')');
+		return;
+	}
+	#endif
+
+	NzJoint* joints = skeleton->GetJoints();
+	for (unsigned int i = 0; i < m_jointCount; ++i)
+	{
+		joints[i].SetPosition(m_positions[i]);
+		joints[i].SetRotation(m_rotations[i]);
+		joints[i].SetScale(m_scales[i]);
+	}
+}
+
+void NzSkeletalPose::Blend(const NzSkeletalPose& poseA, const NzSkeletalPose& poseB, float weight, const float* jointWeights)
+{
+	///DOC: Un poids nul donne la pose A, un poids de 1 la pose B, jointWeights (facultatif) pondère le poids de chaque joint
+	///DOC: La pose peut être l'une des deux sources
+	#if NAZARA_UTILITY_SAFE
+	if (!IsValid())
+	{
+		NazaraError("Pose not created");
+		return;
+	}
+
+	if (!poseA.IsValid())
+	{
+		NazaraError("Pose A is invalid");
+		return;
+	}
+
+	if (!poseB.IsValid())
+	{
+		NazaraError("Pose B is invalid");
+		return;
+	}
+
+	if (poseA.m_jointCount != poseB.m_jointCount || m_jointCount != poseA.m_jointCount)
+	{
+		NazaraError("Poses must have the same joint count");
+		return;
+	}
+	#endif
+
+	for (unsigned int i = 0; i < m_jointCount; ++i)
+	{
+		float jointWeight = (jointWeights) ? weight*jointWeights[i] : weight;
+
+		m_rotations[i] = BlendRotation(poseA.m_rotations[i], poseB.m_rotations[i], jointWeight);
+		m_positions[i] = BlendVector(poseA.m_positions[i], poseB.m_positions[i], jointWeight);
+		m_scales[i] = BlendVector(poseA.m_scales[i], poseB.m_scales[i], jointWeight);
+	}
+}
+
+bool NzSkeletalPose::Create(unsigned int jointCount)
+{
+	Destroy();
+
+	#if NAZARA_UTILITY_SAFE
+	if (jointCount == 0)
+	{
+		NazaraError("Joint count must be over 0");
+		return false;
+	}
+	#endif
+
+	m_jointCount = jointCount;
+	SetBuffer(new nzUInt8[jointCount*jointSize]);
+	MakeIdentity();
+
+	return true;
+}
+
+bool NzSkeletalPose::Create(NzSkeletalPosePool* pool)
+{
+	Destroy();
+
+	#if NAZARA_UTILITY_SAFE
+	if (!pool)
+	{
+		NazaraError("Invalid pool");
+		return false;
+	}
+
+	if (pool->GetJointCount() == 0)
+	{
+		NazaraError("Pool joint count must be over 0");
+		return false;
+	}
+	#endif
+
+	nzUInt8* buffer = pool->Allocate();
+	if (!buffer)
+	{
+		NazaraError("Failed to allocate pose from pool");
+		return false;
+	}
+
+	m_jointCount = pool->GetJointCount();
+	m_pool = pool;
+	SetBuffer(buffer);
+	MakeIdentity();
+
+	return true;
+}
+
+void NzSkeletalPose::Destroy()
+{
+	if (m_rotations)
+	{
+		nzUInt8* buffer = reinterpret_cast<nzUInt8*>(m_rotations);
+		if (m_pool)
+			m_pool->Free(buffer);
+		else
+			delete[] buffer;
+
+		m_pool = nullptr;
+		m_rotations = nullptr;
+		m_positions = nullptr;
+		m_scales = nullptr;
+		m_jointCount = 0;
+	}
+}
+
+unsigned int NzSkeletalPose::GetJointCount() const
+{
+	return m_jointCount;
+}
+
+NzVector3f* NzSkeletalPose::GetPositions()
+{
+	return m_positions;
+}
+
+const NzVector3f* NzSkeletalPose::GetPositions() const
+{
+	return m_positions;
+}
+
+NzQuaternionf* NzSkeletalPose::GetRotations()
+{
+	return m_rotations;
+}
+
+const NzQuaternionf* NzSkeletalPose::GetRotations() const
+{
+	return m_rotations;
+}
+
+NzVector3f* NzSkeletalPose::GetScales()
+{
+	return m_scales;
+}
+
+const NzVector3f* NzSkeletalPose::GetScales() const
+{
+	return m_scales;
+}
+
+bool NzSkeletalPose::IsValid() const
+{
+	return m_rotations != nullptr;
+}
+
+void NzSkeletalPose::MakeAdditive(const NzSkeletalPose& pose, const NzSkeletalPose& referencePose)
+{
+	///DOC: Stocke la différence entre une pose et une pose de référence (Typiquement la première frame de l'animation),
+	///DOC: à ajouter ensuite à n'importe quelle pose via AddAdditive
+	#if NAZARA_UTILITY_SAFE
+	if (!IsValid())
+	{
+		NazaraError("Pose not created");
+		return;
+	}
+
+	if (!pose.IsValid())
+	{
+		NazaraError("Pose is invalid");
+		return;
+	}
+
+	if (!referencePose.IsValid())
+	{
+		NazaraError("Reference pose is invalid");
+		return;
+	}
+
+	if (pose.m_jointCount != referencePose.m_jointCount || m_jointCount != pose.m_jointCount)
+	{
+		NazaraError("Poses must have the same joint count");
+		return;
+	}
+	#endif
+
+	for (unsigned int i = 0; i < m_jointCount; ++i)
+	{
+		// reference * différence = pose
+		m_rotations[i] = referencePose.m_rotations[i].GetConjugate() * pose.m_rotations[i];
+		m_rotations[i].Normalize();
+
+		m_positions[i] = pose.m_positions[i] - referencePose.m_positions[i];
+		m_scales[i] = pose.m_scales[i] / referencePose.m_scales[i];
+	}
+}
+
+void NzSkeletalPose::MakeIdentity()
+{
+	#if NAZARA_UTILITY_SAFE
+	if (!IsValid())
+	{
+		NazaraError("Pose not created");
+		return;
+	}
+	#endif
+
+	std::fill(m_rotations, m_rotations + m_jointCount, NzQuaternionf::Identity());
+	std::fill(m_positions, m_positions + m_jointCount, NzVector3f::Zero());
+	std::fill(m_scales, m_scales + m_jointCount, NzVector3f::Unit());
+}
+
+void NzSkeletalPose::Set(const NzSkeleton& skeleton)
+{
+	///DOC: Capture les transformations locales des joints (La pose de liaison par exemple)
+	#if NAZARA_UTILITY_SAFE
+	if (!IsValid())
+	{
+		NazaraError("Pose not created");
+		return;
+	}
+
+	if (!skeleton.IsValid())
+	{
+		NazaraError("Invalid skeleton");
+		return;
+	}
+
+	if (skeleton.GetJointCount() != m_jointCount)
+	{
+		NazaraError("Skeleton joint count does not match pose joint count (" + NzString::Number(skeleton.GetJointCount()) + " != " + NzString::Number(m_jointCount) + ')');
+		return;
+	}
+	#endif
+
+	const NzJoint* joints = skeleton.GetJoints();
+	for (unsigned int i = 0; i < m_jointCount; ++i)
+	{
+		m_positions[i] = joints[i].GetPosition(nzCoordSys_Local);
+		m_rotations[i] = joints[i].GetRotation(nzCoordSys_Local);
+		m_scales[i] = joints[i].GetScale(nzCoordSys_Local);
+	}
+}
+
+NzSkeletalPose& NzSkeletalPose::operator=(const NzSkeletalPose& pose)
+{
+	if (&pose == this)
+		return *this;
+
+	if (!pose.IsValid())
+	{
+		Destroy();
+		return *this;
+	}
+
+	// La copie provient de la même réserve que l'original
+	if (m_jointCount != pose.m_jointCount || m_pool != pose.m_pool)
+	{
+		bool created = (pose.m_pool) ? Create(pose.m_pool) : Create(pose.m_jointCount);
+		if (!created)
+			return *this;
+	}
+
+	std::copy(pose.m_rotations, pose.m_rotations + m_jointCount, m_rotations);
+	std::copy(pose.m_positions, pose.m_positions + m_jointCount, m_positions);
+	std::copy(pose.m_scales, pose.m_scales + m_jointCount, m_scales);
+
+	return *this;
+}
+
+NzSkeletalPose& NzSkeletalPose::operator=(NzSkeletalPose&& pose) noexcept
+{
+	std::swap(m_pool, pose.m_pool);
+	std::swap(m_rotations, pose.m_rotations);
+	std::swap(m_positions, pose.m_positions);
+	std::swap(m_scales, pose.m_scales);
+	std::swap(m_jointCount, pose.m_jointCount);
+
+	return *this;
+}
+
+bool NzSkeletalPose::BuildJointMask(const NzSkeleton& skeleton, const NzString& rootJointName, float* jointWeights)
+{
+	///DOC: Donne un poids de 1 au joint et à ses descendants, et de 0 aux autres (Couche ne concernant que le haut du corps, ...)
+	///DOC: jointWeights doit pouvoir contenir un poids par joint du squelette
+	#if NAZARA_UTILITY_SAFE
+	if (!skeleton.IsValid())
+	{
+		NazaraError("Invalid skeleton");
+		return false;
+	}
+
+	if (!jointWeights)
+	{
+		NazaraError("Invalid joint weights");
+		return false;
+	}
+	#endif
+
+	int rootIndex = skeleton.GetJointIndex(rootJointName);
+	if (rootIndex < 0)
+	{
+		NazaraError("Joint \"" + rootJointName + "\" not found");
+		return false;
+	}
+
+	const NzJoint* joints = skeleton.GetJoints();
+	const NzNode* root = &joints[rootIndex];
+
+	unsigned int jointCount = skeleton.GetJointCount();
+	for (unsigned int i = 0; i < jointCount; ++i)
+	{
+		const NzNode* node = &joints[i];
+		while (node && node != root)
+			node = node->GetParent();
+
+		jointWeights[i] = (node) ? 1.f : 0.f;
+	}
+
+	return true;
+}
+
+void NzSkeletalPose::SetBuffer(nzUInt8* buffer)
+{
+	// Les rotations sont placées en premier, profitant ainsi de l'alignement du tampon
+	m_rotations = reinterpret_cast<NzQuaternionf*>(buffer);
+	m_positions = reinterpret_cast<NzVector3f*>(buffer + m_jointCount*sizeof(NzQuaternionf));
+	m_scales = m_positions + m_jointCount;
+}
@@ -0,0 +1,34 @@
+// Copyright (C) 2014 Jérôme Leclercq
+// This file is part of the "Nazara Engine - Utility module"
+// For conditions of distribution and use, see copyright notice in Config.hpp
+
+#include <Nazara/Utility/SkeletalPosePool.hpp>
+#include <Nazara/Math/Quaternion.hpp>
+#include <Nazara/Math/Vector3.hpp>
+#include <Nazara/Utility/Debug.hpp>
+
+NzSkeletalPosePool::NzSkeletalPosePool(unsigned int jointCount, unsigned int posesPerChunk) :
+m_pool(jointCount*(sizeof(NzQuaternionf) + 2*sizeof(NzVector3f)), posesPerChunk),
+m_jointCount(jointCount)
+{
+}
+
+unsigned int NzSkeletalPosePool::GetAllocatedPoseCount() const
+{
+	return m_pool.GetAllocatedBlockCount();
+}
+
+unsigned int NzSkeletalPosePool::GetJointCount() const
+{
+	return m_jointCount;
+}
+
+nzUInt8* NzSkeletalPosePool::Allocate()
+{
+	return static_cast<nzUInt8*>(m_pool.Allocate());
+}
+
+void NzSkeletalPosePool::Free(nzUInt8* buffer)
+{
+	m_pool.Free(buffer);
+}
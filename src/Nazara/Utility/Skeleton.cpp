@@ -3,6 +3,7 @@
 // For conditions of distribution and use, see copyright notice in Config.hpp
 
 #include <Nazara/Utility/Skeleton.hpp>
+#include <Nazara/Math/Algorithm.hpp>
 #include <unordered_map>
 #include <Nazara/Utility/Debug.hpp>
 
@@ -10,6 +11,7 @@ struct NzSkeletonImpl
 {
 	std::unordered_map<NzString, unsigned int> jointMap;
 	std::vector<NzJoint> joints;
+	std::vector<NzVector3f> jointPositions;
 	NzBoxf aabb;
 	bool aabbUpdated = false;
 	bool jointMapUpdated = false;
@@ -65,16 +67,13 @@ const NzBoxf& NzSkeleton::GetAABB() const
 
 	if (!m_impl->aabbUpdated)
 	{
+		// Les positions globales sont rassemblées dans un tableau contigu (conservé d'un appel à l'autre) avant la réduction
 		unsigned int jointCount = m_impl->joints.size();
-		if (jointCount > 0)
-		{
-			NzVector3f pos = m_impl->joints[0].GetPosition();
-			m_impl->aabb.Set(pos.x, pos.y, pos.z, 0.f, 0.f, 0.f);
-			for (unsigned int i = 1; i < jointCount; ++i)
-				m_impl->aabb.ExtendTo(m_impl->joints[i].GetPosition());
-		}
-		else
-			m_impl->aabb.MakeZero();
+		m_impl->jointPositions.resize(jointCount);
+		for (unsigned int i = 0; i < jointCount; ++i)
+			m_impl->jointPositions[i] = m_impl->joints[i].GetPosition();
+
+		m_impl->aabb = NzComputeAABB(m_impl->jointPositions.data(), jointCount);
 
 		m_impl->aabbUpdated = true;
 	}
@@ -188,6 +187,9 @@ NzJoint* NzSkeleton::GetJoints()
 	}
 	#endif
 
+	// Invalidation de l'AABB
+	m_impl->aabbUpdated = false;
+
 	return &m_impl->joints[0];
 }
 
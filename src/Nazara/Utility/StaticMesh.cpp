@@ -33,6 +33,8 @@ void NzStaticMesh::Center()
 	m_aabb.x -= offset.x;
 	m_aabb.y -= offset.y;
 	m_aabb.z -= offset.z;
+
+	InvalidateTriangleBVH();
 }
 
 bool NzStaticMesh::Create(NzVertexBuffer* vertexBuffer)
@@ -50,6 +52,8 @@ bool NzStaticMesh::Create(NzVertexBuffer* vertexBuffer)
 	m_vertexBuffer = vertexBuffer;
 	m_vertexBuffer->AddResourceListener(this);
 
+	InvalidateTriangleBVH();
+
 	return true;
 }
 
@@ -67,15 +71,20 @@ void NzStaticMesh::Destroy()
 
 		m_vertexBuffer->RemoveResourceListener(this);
 		m_vertexBuffer = nullptr;
+
+		InvalidateTriangleBVH();
 	}
 }
 
 bool NzStaticMesh::GenerateAABB()
 {
+	///DOC: Les positions ayant changé, la hiérarchie de triangles est également invalidée
 	// On lock le buffer pour itérer sur toutes les positions et composer notre AABB
 	NzBufferMapper<NzVertexBuffer> mapper(m_vertexBuffer, nzBufferAccess_ReadOnly);
 	m_aabb = NzComputeVerticesAABB(static_cast<const NzMeshVertex*>(mapper.GetPointer()), m_vertexBuffer->GetVertexCount());
 
+	InvalidateTriangleBVH();
+
 	return true;
 }
 
@@ -99,6 +108,32 @@ NzVertexBuffer* NzStaticMesh::GetVertexBuffer()
 	return m_vertexBuffer;
 }
 
+const NzTriangleBVH* NzStaticMesh::GetTriangleBVH() const
+{
+	///DOC: La hiérarchie est construite au premier appel puis conservée jusqu'à l'invalidation
+	///DOC: La construction n'étant pas protégée, elle doit être forcée par un appel avant des requêtes concurrentes
+	#if NAZARA_UTILITY_SAFE
+	if (!m_vertexBuffer)
+	{
+		NazaraError("Static mesh not created");
+		return nullptr;
+	}
+	#endif
+
+	if (!m_triangleBVHUpdated)
+	{
+		if (!m_triangleBVH.Build(this))
+		{
+			NazaraError("Failed to build triangle BVH");
+			return nullptr;
+		}
+
+		m_triangleBVHUpdated = true;
+	}
+
+	return &m_triangleBVH;
+}
+
 const NzVertexBuffer* NzStaticMesh::GetVertexBuffer() const
 {
 	return m_vertexBuffer;
@@ -109,6 +144,13 @@ unsigned int NzStaticMesh::GetVertexCount() const
 	return m_vertexBuffer->GetVertexCount();
 }
 
+void NzStaticMesh::InvalidateTriangleBVH()
+{
+	///DOC: À appeler après une modification des positions ou des indices au travers d'un mapper
+	m_triangleBVH.Destroy();
+	m_triangleBVHUpdated = false;
+}
+
 bool NzStaticMesh::IsAnimated() const
 {
 	return false;
@@ -119,6 +161,25 @@ bool NzStaticMesh::IsValid() const
 	return m_vertexBuffer != nullptr;
 }
 
+bool NzStaticMesh::Raycast(const NzVector3f& origin, const NzVector3f& direction, float maxDistance, NzTriangleHit* hit) const
+{
+	///DOC: Le rayon est exprimé dans le repère du mesh
+	const NzTriangleBVH* triangleBVH = GetTriangleBVH();
+	if (!triangleBVH)
+		return false;
+
+	return triangleBVH->Raycast(origin, direction, maxDistance, hit);
+}
+
+bool NzStaticMesh::RaycastAny(const NzVector3f& origin, const NzVector3f& direction, float maxDistance) const
+{
+	const NzTriangleBVH* triangleBVH = GetTriangleBVH();
+	if (!triangleBVH)
+		return false;
+
+	return triangleBVH->RaycastAny(origin, direction, maxDistance);
+}
+
 void NzStaticMesh::SetAABB(const NzBoxf& aabb)
 {
 	m_aabb = aabb;
@@ -133,6 +194,8 @@ void NzStaticMesh::SetIndexBuffer(const NzIndexBuffer* indexBuffer)
 		indexBuffer->AddResourceListener(this);
 
 	m_indexBuffer = indexBuffer;
+
+	InvalidateTriangleBVH();
 }
 
 void NzStaticMesh::OnResourceReleased(const NzResource* resource, int index)
@@ -144,5 +207,10 @@ void NzStaticMesh::OnResourceReleased(const NzResource* resource, int index)
 	else if (resource == m_vertexBuffer)
 		m_vertexBuffer = nullptr;
 	else
+	{
 		NazaraInternalError("Not listening to " + NzString::Pointer(resource));
+		return;
+	}
+
+	InvalidateTriangleBVH();
 }
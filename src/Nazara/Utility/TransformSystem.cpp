@@ -0,0 +1,344 @@
+// Copyright (C) 2014 Jérôme Leclercq
+// This file is part of the "Nazara Engine - Utility module"
+// For conditions of distribution and use, see copyright notice in Config.hpp
+
+#include <Nazara/Utility/TransformSystem.hpp>
+#include <Nazara/Utility/Node.hpp>
+#include <algorithm>
+#include <limits>
+#include <Nazara/Utility/Debug.hpp>
+
+namespace
+{
+	template<typename T>
+	void Permute(std::vector<T>& values, const std::vector<unsigned int>& order)
+	{
+		std::vector<T> permuted;
+		permuted.reserve(values.size());
+
+		for (unsigned int index : order)
+			permuted.push_back(values[index]);
+
+		values.swap(permuted);
+	}
+}
+
+NzTransformSystem::NzTransformSystem() :
+m_updateStamp(0),
+m_dirty(false),
+m_hierarchyDirty(false)
+{
+}
+
+NzTransformSystem::~NzTransformSystem()
+{
+	// Les noeuds conservent leurs propres valeurs locales et reprennent simplement le calcul à leur charge
+	for (NzNode* node : m_nodes)
+	{
+		node->m_transformSystem = nullptr;
+		node->Invalidate();
+	}
+}
+
+unsigned int NzTransformSystem::GetNodeCount() const
+{
+	return m_nodes.size();
+}
+
+void NzTransformSystem::Update()
+{
+	if (!m_dirty)
+		return;
+
+	if (m_hierarchyDirty)
+		SortByDepth();
+
+	// Un noeud est recalculé s'il a été invalidé, ou si son parent vient de l'être durant ce même parcours
+	if (++m_updateStamp == 0)
+	{
+		std::fill(m_updateStamps.begin(), m_updateStamps.end(), 0);
+		m_updateStamp = 1;
+	}
+
+	unsigned int nodeCount = m_nodes.size();
+	for (unsigned int i = 0; i < nodeCount; ++i)
+	{
+		int parent = m_parents[i];
+		if ((m_flags[i] & Flag_Dirty) == 0 && (parent < 0 || m_updateStamps[parent] != m_updateStamp))
+			continue;
+
+		// Le parcours ne met jamais à jour un noeud extérieur (Ce qui pourrait modifier des noeuds en cours de calcul),
+		// un noeud dont le parent extérieur n'est pas à jour reste donc invalide avec ses descendants du système,
+		// et sera calculé à la demande (Voir Update(node))
+		bool parentReady;
+		if (parent == ExternalParent)
+			parentReady = m_nodes[i]->m_parent->m_derivedUpdated;
+		else
+			parentReady = (parent == NoParent || (m_flags[parent] & Flag_Dirty) == 0);
+
+		if (parentReady)
+			UpdateNode(i);
+		else
+		{
+			// Le marquage permet aux enfants d'être eux aussi invalidés
+			m_flags[i] |= Flag_Dirty;
+			m_updateStamps[i] = m_updateStamp;
+		}
+	}
+
+	m_dirty = false;
+}
+
+void NzTransformSystem::GetDerived(unsigned int index, NzVector3f* position, NzQuaternionf* rotation, NzVector3f* scale) const
+{
+	*position = m_derivedPositions[index];
+	*rotation = m_derivedRotations[index];
+	*scale = m_derivedScales[index];
+}
+
+const NzMatrix4f& NzTransformSystem::GetTransformMatrix(unsigned int index) const
+{
+	return m_transformMatrices[index];
+}
+
+void NzTransformSystem::Invalidate(const NzNode* node)
+{
+	unsigned int index = node->m_transformIndex;
+
+	// Les valeurs initiales et relatives sont combinées une fois pour toutes
+	m_localPositions[index] = node->m_initialPosition + node->m_position;
+	m_localRotations[index] = node->m_initialRotation * node->m_rotation;
+	m_localScales[index] = node->m_initialScale * node->m_scale;
+
+	nzUInt8 flags = Flag_Dirty;
+	if (node->m_inheritPosition)
+		flags |= Flag_InheritPosition;
+
+	if (node->m_inheritRotation)
+		flags |= Flag_InheritRotation;
+
+	if (node->m_inheritScale)
+		flags |= Flag_InheritScale;
+
+	m_flags[index] = flags;
+	m_dirty = true;
+}
+
+void NzTransformSystem::InvalidateHierarchy()
+{
+	m_dirty = true;
+	m_hierarchyDirty = true;
+}
+
+void NzTransformSystem::Register(NzNode* node)
+{
+	node->m_transformIndex = m_nodes.size();
+
+	m_derivedPositions.push_back(NzVector3f::Zero());
+	m_derivedRotations.push_back(NzQuaternionf::Identity());
+	m_derivedScales.push_back(NzVector3f::Unit());
+	m_flags.push_back(0);
+	m_localPositions.push_back(NzVector3f::Zero());
+	m_localRotations.push_back(NzQuaternionf::Identity());
+	m_localScales.push_back(NzVector3f::Unit());
+	m_nodes.push_back(node);
+	m_parents.push_back(NoParent);
+	m_transformMatrices.push_back(NzMatrix4f::Identity());
+	m_updateStamps.push_back(0);
+
+	Invalidate(node);
+	InvalidateHierarchy();
+}
+
+void NzTransformSystem::SortByDepth()
+{
+	unsigned int nodeCount = m_nodes.size();
+
+	// Résolution des parents à l'intérieur du système
+	for (unsigned int i = 0; i < nodeCount; ++i)
+	{
+		const NzNode* parent = m_nodes[i]->m_parent;
+		if (!parent)
+			m_parents[i] = NoParent;
+		else if (parent->m_transformSystem == this)
+			m_parents[i] = parent->m_transformIndex;
+		else
+			m_parents[i] = ExternalParent;
+	}
+
+	// Calcul de la profondeur de chaque noeud, en remontant jusqu'au premier ancêtre déjà connu
+	const unsigned int unknownDepth = std::numeric_limits<unsigned int>::max();
+
+	std::vector<unsigned int> depths(nodeCount, unknownDepth);
+	std::vector<unsigned int> chain;
+	for (unsigned int i = 0; i < nodeCount; ++i)
+	{
+		int index = i;
+		while (index >= 0 && depths[index] == unknownDepth)
+		{
+			chain.push_back(index);
+			index = m_parents[index];
+		}
+
+		unsigned int depth = (index >= 0) ? depths[index] + 1 : 0;
+		while (!chain.empty())
+		{
+			depths[chain.back()] = depth++;
+			chain.pop_back();
+		}
+	}
+
+	std::vector<unsigned int> order(nodeCount);
+	for (unsigned int i = 0; i < nodeCount; ++i)
+		order[i] = i;
+
+	std::stable_sort(order.begin(), order.end(), [&depths](unsigned int a, unsigned int b)
+	{
+		return depths[a] < depths[b];
+	});
+
+	std::vector<int> newIndices(nodeCount);
+	for (unsigned int i = 0; i < nodeCount; ++i)
+		newIndices[order[i]] = i;
+
+	Permute(m_derivedPositions, order);
+	Permute(m_derivedRotations, order);
+	Permute(m_derivedScales, order);
+	Permute(m_flags, order);
+	Permute(m_localPositions, order);
+	Permute(m_localRotations, order);
+	Permute(m_localScales, order);
+	Permute(m_nodes, order);
+	Permute(m_parents, order);
+	Permute(m_transformMatrices, order);
+	Permute(m_updateStamps, order);
+
+	for (unsigned int i = 0; i < nodeCount; ++i)
+	{
+		m_nodes[i]->m_transformIndex = i;
+
+		int& parent = m_parents[i];
+		if (parent >= 0)
+			parent = newIndices[parent];
+	}
+
+	m_hierarchyDirty = false;
+}
+
+void NzTransformSystem::Unregister(NzNode* node)
+{
+	// L'emplacement libéré est comblé par le dernier, l'ordre sera rétabli à la prochaine mise à jour
+	unsigned int index = node->m_transformIndex;
+	unsigned int last = m_nodes.size()-1;
+	if (index != last)
+	{
+		m_derivedPositions[index] = m_derivedPositions[last];
+		m_derivedRotations[index] = m_derivedRotations[last];
+		m_derivedScales[index] = m_derivedScales[last];
+		m_flags[index] = m_flags[last] | Flag_Dirty;
+		m_localPositions[index] = m_localPositions[last];
+		m_localRotations[index] = m_localRotations[last];
+		m_localScales[index] = m_localScales[last];
+		m_nodes[index] = m_nodes[last];
+		m_transformMatrices[index] = m_transformMatrices[last];
+		m_updateStamps[index] = m_updateStamps[last];
+
+		m_nodes[index]->m_transformIndex = index;
+	}
+
+	m_derivedPositions.pop_back();
+	m_derivedRotations.pop_back();
+	m_derivedScales.pop_back();
+	m_flags.pop_back();
+	m_localPositions.pop_back();
+	m_localRotations.pop_back();
+	m_localScales.pop_back();
+	m_nodes.pop_back();
+	m_parents.pop_back();
+	m_transformMatrices.pop_back();
+	m_updateStamps.pop_back();
+
+	InvalidateHierarchy();
+}
+
+void NzTransformSystem::Update(const NzNode* node)
+{
+	// L'index du noeud peut changer lors du tri, il n'est donc lu qu'après le parcours
+	Update();
+	UpdatePendingNode(node->m_transformIndex);
+}
+
+void NzTransformSystem::UpdateNode(unsigned int index)
+{
+	int parent = m_parents[index];
+	nzUInt8 flags = m_flags[index];
+
+	NzVector3f& position = m_derivedPositions[index];
+	NzQuaternionf& rotation = m_derivedRotations[index];
+	NzVector3f& scale = m_derivedScales[index];
+
+	if (parent == NoParent)
+	{
+		position = m_localPositions[index];
+		rotation = m_localRotations[index];
+		scale = m_localScales[index];
+	}
+	else
+	{
+		const NzVector3f* parentPosition;
+		const NzQuaternionf* parentRotation;
+		const NzVector3f* parentScale;
+		if (parent == ExternalParent)
+		{
+			// Le parent n'appartient pas au système, ses valeurs dérivées sont à jour (Voir Update)
+			const NzNode* parentNode = m_nodes[index]->m_parent;
+
+			parentPosition = &parentNode->m_derivedPosition;
+			parentRotation = &parentNode->m_derivedRotation;
+			parentScale = &parentNode->m_derivedScale;
+		}
+		else
+		{
+			parentPosition = &m_derivedPositions[parent];
+			parentRotation = &m_derivedRotations[parent];
+			parentScale = &m_derivedScales[parent];
+		}
+
+		// Mêmes calculs que NzNode::UpdateDerived
+		if (flags & Flag_InheritPosition)
+			position = (*parentRotation)*((*parentScale) * m_localPositions[index]) + (*parentPosition);
+		else
+			position = m_localPositions[index];
+
+		if (flags & Flag_InheritRotation)
+		{
+			rotation = (*parentRotation) * m_localRotations[index];
+			rotation.Normalize();
+		}
+		else
+			rotation = m_localRotations[index];
+
+		scale = m_localScales[index];
+		if (flags & Flag_InheritScale)
+			scale *= *parentScale;
+	}
+
+	m_transformMatrices[index].MakeTransform(position, rotation, scale);
+
+	m_flags[index] = flags & ~Flag_Dirty;
+	m_updateStamps[index] = m_updateStamp;
+}
+
+void NzTransformSystem::UpdatePendingNode(unsigned int index)
+{
+	// Le noeud dépendait d'un parent extérieur qui n'était pas à jour lors du parcours, NzNode::UpdateDerived vient
+	// cependant de mettre à jour ses parents
+	if (m_flags[index] & Flag_Dirty)
+	{
+		int parent = m_parents[index];
+		if (parent >= 0)
+			UpdatePendingNode(parent);
+
+		UpdateNode(index);
+	}
+}
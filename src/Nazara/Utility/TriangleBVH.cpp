@@ -0,0 +1,248 @@
+// Copyright (C) 2014 Jérôme Leclercq
+// This file is part of the "Nazara Engine - Utility module"
+// For conditions of distribution and use, see copyright notice in Config.hpp
+
+#include <Nazara/Utility/TriangleBVH.hpp>
+#include <Nazara/Core/Error.hpp>
+#include <Nazara/Utility/BufferMapper.hpp>
+#include <Nazara/Utility/Config.hpp>
+#include <Nazara/Utility/IndexMapper.hpp>
+#include <Nazara/Utility/Mesh.hpp>
+#include <Nazara/Utility/StaticMesh.hpp>
+#include <Nazara/Utility/Debug.hpp>
+
+namespace
+{
+	template<typename F>
+	void GetTriangleIndices(nzPrimitiveMode mode, unsigned int triangle, F getIndex, unsigned int* indices)
+	{
+		switch (mode)
+		{
+			case nzPrimitiveMode_TriangleFan:
+				indices[0] = getIndex(0);
+				indices[1] = getIndex(triangle + 1);
+				indices[2] = getIndex(triangle + 2);
+				break;
+
+			case nzPrimitiveMode_TriangleList:
+				indices[0] = getIndex(triangle*3);
+				indices[1] = getIndex(triangle*3 + 1);
+				indices[2] = getIndex(triangle*3 + 2);
+				break;
+
+			case nzPrimitiveMode_TriangleStrip:
+				// Un triangle sur deux est inversé pour conserver le sens de la face
+				indices[0] = getIndex(triangle);
+				indices[1] = getIndex(triangle + 1 + (triangle & 1));
+				indices[2] = getIndex(triangle + 2 - (triangle & 1));
+				break;
+
+			default:
+				NazaraInternalError("Primitive mode not handled (0x" + NzString::Number(mode, 16) + ')');
+				break;
+		}
+	}
+
+	bool IntersectTriangle(const NzVector3f& vertex, const NzVector3f& edge1, const NzVector3f& edge2, const NzVector3f& origin, const NzVector3f& direction, float maxDistance, float* distance, float* u, float* v)
+	{
+		// Möller-Trumbore, sans élimination des faces arrières
+		NzVector3f p = direction.CrossProduct(edge2);
+		float determinant = edge1.DotProduct(p);
+		if (determinant == 0.f) // Rayon parallèle au triangle
+			return false;
+
+		float invDeterminant = 1.f/determinant;
+
+		NzVector3f s = origin - vertex;
+		float hitU = s.DotProduct(p)*invDeterminant;
+		if (hitU < 0.f || hitU > 1.f)
+			return false;
+
+		NzVector3f q = s.CrossProduct(edge1);
+		float hitV = direction.DotProduct(q)*invDeterminant;
+		if (hitV < 0.f || hitU + hitV > 1.f)
+			return false;
+
+		float hitDistance = edge2.DotProduct(q)*invDeterminant;
+		if (hitDistance < 0.f || hitDistance > maxDistance)
+			return false;
+
+		*distance = hitDistance;
+		*u = hitU;
+		*v = hitV;
+
+		return true;
+	}
+}
+
+bool NzTriangleBVH::Build(const NzStaticMesh* subMesh)
+{
+	#if NAZARA_UTILITY_SAFE
+	if (!subMesh || !subMesh->IsValid())
+	{
+		NazaraError("Invalid submesh");
+		return false;
+	}
+	#endif
+
+	Destroy();
+
+	const NzIndexBuffer* indexBuffer = subMesh->GetIndexBuffer();
+	unsigned int indexCount = (indexBuffer) ? indexBuffer->GetIndexCount() : subMesh->GetVertexCount();
+
+	nzPrimitiveMode mode = subMesh->GetPrimitiveMode();
+	unsigned int triangleCount;
+	switch (mode)
+	{
+		case nzPrimitiveMode_TriangleFan:
+		case nzPrimitiveMode_TriangleStrip:
+			triangleCount = (indexCount >= 3) ? indexCount - 2 : 0;
+			break;
+
+		case nzPrimitiveMode_TriangleList:
+			triangleCount = indexCount/3;
+			break;
+
+		case nzPrimitiveMode_LineList:
+		case nzPrimitiveMode_LineStrip:
+		case nzPrimitiveMode_PointList:
+		default:
+			NazaraError("Submesh primitive mode must be a triangle mode");
+			return false;
+	}
+
+	std::vector<unsigned int> indices(triangleCount*3);
+	if (indexBuffer)
+	{
+		NzIndexMapper indexMapper(indexBuffer);
+		for (unsigned int i = 0; i < triangleCount; ++i)
+			GetTriangleIndices(mode, i, [&indexMapper](unsigned int index) { return indexMapper.Get(index); }, &indices[i*3]);
+	}
+	else
+	{
+		for (unsigned int i = 0; i < triangleCount; ++i)
+			GetTriangleIndices(mode, i, [](unsigned int index) { return index; }, &indices[i*3]);
+	}
+
+	NzBufferMapper<NzVertexBuffer> vertexMapper(subMesh->GetVertexBuffer(), nzBufferAccess_ReadOnly);
+	const NzMeshVertex* vertices = static_cast<const NzMeshVertex*>(vertexMapper.GetPointer());
+	if (!vertices)
+	{
+		NazaraError("Failed to map vertex buffer");
+		return false;
+	}
+
+	#if NAZARA_UTILITY_SAFE
+	unsigned int vertexCount = subMesh->GetVertexCount();
+	#endif
+
+	std::vector<NzBoxf> boxes(triangleCount);
+	m_triangles.resize(triangleCount);
+
+	for (unsigned int i = 0; i < triangleCount; ++i)
+	{
+		const unsigned int* triangleIndices = &indices[i*3];
+
+		#if NAZARA_UTILITY_SAFE
+		if (triangleIndices[0] >= vertexCount || triangleIndices[1] >= vertexCount || triangleIndices[2] >= vertexCount)
+		{
+			NazaraError("Triangle #" + NzString::Number(i) + " references a vertex out of range (vertex count: " + NzString::Number(vertexCount) + ')');
+			m_triangles.clear();
+
+			return false;
+		}
+		#endif
+
+		const NzVector3f& position0 = vertices[triangleIndices[0]].position;
+		const NzVector3f& position1 = vertices[triangleIndices[1]].position;
+		const NzVector3f& position2 = vertices[triangleIndices[2]].position;
+
+		Triangle& triangle = m_triangles[i];
+		triangle.vertex = position0;
+		triangle.edge1 = position1 - position0;
+		triangle.edge2 = position2 - position0;
+
+		boxes[i].Set(position0, position1);
+		boxes[i].ExtendTo(position2);
+	}
+
+	vertexMapper.Unmap();
+
+	m_bvh.BuildParallel(boxes.data(), triangleCount);
+
+	return true;
+}
+
+void NzTriangleBVH::Destroy()
+{
+	m_bvh.Clear();
+	m_triangles.clear();
+}
+
+const NzBVHf& NzTriangleBVH::GetBVH() const
+{
+	return m_bvh;
+}
+
+unsigned int NzTriangleBVH::GetTriangleCount() const
+{
+	return m_triangles.size();
+}
+
+bool NzTriangleBVH::IsValid() const
+{
+	return m_bvh.IsValid();
+}
+
+bool NzTriangleBVH::Raycast(const NzVector3f& origin, const NzVector3f& direction, float maxDistance, NzTriangleHit* hit) const
+{
+	///DOC: Renvoie l'intersection la plus proche, hit n'est rempli qu'en cas de succès
+	float hitU, hitV;
+	unsigned int hitTriangle;
+
+	float distance;
+	bool found = m_bvh.Raycast(origin, direction, maxDistance, [&](unsigned int triangle, float* triangleDistance)
+	{
+		const Triangle& data = m_triangles[triangle];
+
+		float u, v;
+		if (!IntersectTriangle(data.vertex, data.edge1, data.edge2, origin, direction, *triangleDistance, triangleDistance, &u, &v))
+			return false;
+
+		hitTriangle = triangle;
+		hitU = u;
+		hitV = v;
+
+		return true;
+	}, &distance);
+
+	if (found && hit)
+	{
+		const Triangle& data = m_triangles[hitTriangle];
+
+		hit->distance = distance;
+		hit->normal = data.edge1.CrossProduct(data.edge2);
+		hit->normal.Normalize();
+		if (hit->normal.DotProduct(direction) > 0.f)
+			hit->normal = -hit->normal;
+
+		hit->position = origin + distance*direction;
+		hit->triangle = hitTriangle;
+		hit->u = hitU;
+		hit->v = hitV;
+	}
+
+	return found;
+}
+
+bool NzTriangleBVH::RaycastAny(const NzVector3f& origin, const NzVector3f& direction, float maxDistance) const
+{
+	///DOC: S'arrête au premier triangle touché (Tests de ligne de vue)
+	return m_bvh.RaycastAny(origin, direction, maxDistance, [&](unsigned int triangle, float* triangleDistance)
+	{
+		const Triangle& data = m_triangles[triangle];
+
+		float distance, u, v;
+		return IntersectTriangle(data.vertex, data.edge1, data.edge2, origin, direction, *triangleDistance, &distance, &u, &v);
+	});
+}